@@ -0,0 +1,134 @@
+#include <chrono>
+#include <cstdio>
+#include <optional>
+#include <rfl.hpp>
+#include <rfl/bin.hpp>
+#include <rfl/json.hpp>
+#include <rfl/msgpack.hpp>
+#include <string>
+#include <vector>
+
+#ifdef RFL_BENCHMARK_FLEXBUF
+#include <rfl/flexbuf.hpp>
+#endif
+
+struct Address {
+  rfl::Field<"street", std::string> street;
+  rfl::Field<"city", std::string> city;
+  rfl::Field<"zip", int> zip;
+};
+
+struct Person {
+  rfl::Field<"firstName", std::string> first_name;
+  rfl::Field<"lastName", std::string> last_name;
+  rfl::Field<"age", int> age;
+  rfl::Field<"height", double> height;
+  rfl::Field<"email", std::optional<std::string>> email;
+  rfl::Field<"address", Address> address;
+  rfl::Field<"scores", std::vector<double>> scores;
+  rfl::Field<"children", std::vector<Person>> children;
+};
+
+/// Generates a family tree of the given depth, so that the data contains
+/// nested arrays and objects as well as scalars.
+Person make_person(const int _depth, const int _i) {
+  auto children = std::vector<Person>();
+  if (_depth > 0) {
+    for (int j = 0; j < 4; ++j) {
+      children.push_back(make_person(_depth - 1, _i * 4 + j));
+    }
+  }
+  return Person{
+      .first_name = "Person" + std::to_string(_i),
+      .last_name = "Simpson",
+      .age = 10 + _i % 70,
+      .height = 1.2 + 0.01 * (_i % 80),
+      .email = _i % 2 == 0
+                   ? std::optional<std::string>("p" + std::to_string(_i) +
+                                                "@springfield.com")
+                   : std::nullopt,
+      .address = Address{.street = "742 Evergreen Terrace",
+                         .city = "Springfield",
+                         .zip = 49007 + _i},
+      .scores = std::vector<double>(8, 0.5 * _i),
+      .children = std::move(children)};
+}
+
+/// Runs _f _iterations times and returns the average time in microseconds.
+template <class F>
+double measure(const int _iterations, const F& _f) {
+  const auto begin = std::chrono::steady_clock::now();
+  for (int i = 0; i < _iterations; ++i) {
+    _f();
+  }
+  const auto end = std::chrono::steady_clock::now();
+  return std::chrono::duration<double, std::micro>(end - begin).count() /
+         _iterations;
+}
+
+template <class WriteF, class ReadF>
+void benchmark(const char* _name, const int _iterations,
+               const std::vector<Person>& _people, const WriteF& _write,
+               const ReadF& _read) {
+  const auto serialized = _write(_people);
+
+  if (!_read(serialized)) {
+    std::printf("%-10s could not read its own output\n", _name);
+    return;
+  }
+
+  size_t sink = 0;
+
+  const auto write_time =
+      measure(_iterations, [&]() { sink += _write(_people).size(); });
+
+  const auto read_time =
+      measure(_iterations, [&]() { sink += _read(serialized) ? 1 : 0; });
+
+  std::printf("%-10s %12zu %14.1f %14.1f\n", _name, serialized.size(),
+              write_time, read_time);
+
+  if (sink == 0) {
+    std::printf("\n");
+  }
+}
+
+int main(int argc, char* argv[]) {
+  const int iterations = argc > 1 ? std::stoi(argv[1]) : 20;
+
+  auto people = std::vector<Person>();
+  for (int i = 0; i < 10; ++i) {
+    people.push_back(make_person(4, i));
+  }
+
+  std::printf("%-10s %12s %14s %14s\n", "format", "bytes", "write (us)",
+              "read (us)");
+
+  benchmark(
+      "json", iterations, people,
+      [](const auto& _p) { return rfl::json::write(_p); },
+      [](const auto& _s) { return rfl::json::read<std::vector<Person>>(_s); });
+
+#ifdef RFL_BENCHMARK_FLEXBUF
+  benchmark(
+      "flexbuf", iterations, people,
+      [](const auto& _p) { return rfl::flexbuf::write(_p); },
+      [](const auto& _b) {
+        return rfl::flexbuf::read<std::vector<Person>>(_b);
+      });
+#endif
+
+  benchmark(
+      "msgpack", iterations, people,
+      [](const auto& _p) { return rfl::msgpack::write(_p); },
+      [](const auto& _b) {
+        return rfl::msgpack::read<std::vector<Person>>(_b);
+      });
+
+  benchmark(
+      "bin", iterations, people,
+      [](const auto& _p) { return rfl::bin::write(_p); },
+      [](const auto& _b) { return rfl::bin::read<std::vector<Person>>(_b); });
+
+  return 0;
+}
@@ -5,9 +5,11 @@
 #include "rfl/AnyOf.hpp"
 #include "rfl/Box.hpp"
 #include "rfl/Field.hpp"
+#include "rfl/FlatMap.hpp"
 #include "rfl/Flatten.hpp"
 #include "rfl/Literal.hpp"
 #include "rfl/NamedTuple.hpp"
+#include "rfl/ObjectMap.hpp"
 #include "rfl/OneOf.hpp"
 #include "rfl/Pattern.hpp"
 #include "rfl/PatternValidator.hpp"
@@ -19,23 +21,29 @@
 #include "rfl/Variant.hpp"
 #include "rfl/always_false.hpp"
 #include "rfl/as.hpp"
+#include "rfl/columns_t.hpp"
 #include "rfl/comparisons.hpp"
 #include "rfl/default.hpp"
 #include "rfl/define_literal.hpp"
 #include "rfl/define_named_tuple.hpp"
 #include "rfl/define_tagged_union.hpp"
 #include "rfl/define_variant.hpp"
+#include "rfl/equal.hpp"
 #include "rfl/extract_discriminators.hpp"
 #include "rfl/field_type.hpp"
+#include "rfl/from_columns.hpp"
 #include "rfl/from_named_tuple.hpp"
 #include "rfl/get.hpp"
+#include "rfl/hash.hpp"
 #include "rfl/make_named_tuple.hpp"
 #include "rfl/name_t.hpp"
 #include "rfl/named_tuple_t.hpp"
 #include "rfl/parsing/CustomParser.hpp"
 #include "rfl/patterns.hpp"
+#include "rfl/prepare.hpp"
 #include "rfl/remove_fields.hpp"
 #include "rfl/replace.hpp"
+#include "rfl/to_columns.hpp"
 #include "rfl/to_named_tuple.hpp"
 #include "rfl/visit.hpp"
 
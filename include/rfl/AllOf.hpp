@@ -1,7 +1,11 @@
 #ifndef RFL_ALLOF_HPP_
 #define RFL_ALLOF_HPP_
 
+#include <span>
+#include <utility>
+
 #include "rfl/Result.hpp"
+#include "rfl/internal/HasValidation.hpp"
 
 namespace rfl {
 
@@ -9,17 +13,51 @@ namespace rfl {
 template <class C, class... Cs>
 struct AllOf {
   template <class T>
-  static rfl::Result<T> validate(T _value) noexcept {
-    return validate_impl<T, C, Cs...>(_value);
+  static rfl::Result<Nothing> check(const T& _value) noexcept {
+    return check_impl<T, C, Cs...>(_value);
+  }
+
+  /// Returns the value, if all of the validators pass.
+  template <class T>
+  static Result<T> validate(T _value) noexcept {
+    return internal::validate_by_check<AllOf>(std::move(_value));
+  }
+
+  /// A value fails, if it fails any of the validators.
+  template <class T>
+  requires(internal::HasFailPredicate<C, T> &&
+           (internal::HasFailPredicate<Cs, T> && ...))
+  static bool fails(const T& _value) noexcept {
+    return (C::fails(_value) | ... | Cs::fails(_value));
+  }
+
+  /// Checks the values in a single loop, if all of the validators provide a
+  /// predicate, and one loop per validator otherwise.
+  template <class T>
+  static bool check_all(const std::span<const T>& _values) noexcept {
+    if constexpr (internal::HasFailPredicate<AllOf, T>) {
+      return internal::none_of_values(
+          _values, [](const T& _v) { return fails(_v); });
+    } else {
+      return internal::check_all<C>(_values) &&
+             (internal::check_all<Cs>(_values) && ...);
+    }
+  }
+
+  /// Prepares all of the underlying validators.
+  static void prepare() {
+    internal::prepare_validator<C>();
+    (internal::prepare_validator<Cs>(), ...);
   }
 
  private:
   template <class T, class Head, class... Tail>
-  static rfl::Result<T> validate_impl(T _value) noexcept {
+  static rfl::Result<Nothing> check_impl(const T& _value) noexcept {
     if constexpr (sizeof...(Tail) == 0) {
-      return Head::validate(_value);
+      return internal::check_value<Head>(_value);
     } else {
-      return Head::validate(_value).and_then(validate_impl<T, Tail...>);
+      return internal::check_value<Head>(_value).and_then(
+          [&](const Nothing&) { return check_impl<T, Tail...>(_value); });
     }
   }
 };
@@ -1,11 +1,13 @@
 #ifndef RFL_ANYOF_HPP_
 #define RFL_ANYOF_HPP_
 
+#include <span>
 #include <string>
 #include <utility>
 #include <vector>
 
 #include "rfl/Result.hpp"
+#include "rfl/internal/HasValidation.hpp"
 
 namespace rfl {
 
@@ -13,8 +15,43 @@ namespace rfl {
 template <class C, class... Cs>
 struct AnyOf {
   template <class T>
-  static rfl::Result<T> validate(const T& _value) noexcept {
-    return validate_impl<T, C, Cs...>(_value, {});
+  static rfl::Result<Nothing> check(const T& _value) noexcept {
+    return check_impl<T, C, Cs...>(_value, {});
+  }
+
+  /// Returns the value, if at least one of the validators passes.
+  template <class T>
+  static Result<T> validate(T _value) noexcept {
+    return internal::validate_by_check<AnyOf>(std::move(_value));
+  }
+
+  /// A value fails, only if it fails all of the validators.
+  template <class T>
+  requires(internal::HasFailPredicate<C, T> &&
+           (internal::HasFailPredicate<Cs, T> && ...))
+  static bool fails(const T& _value) noexcept {
+    return (C::fails(_value) & ... & Cs::fails(_value));
+  }
+
+  /// If all of the validators provide a predicate, every value is tested
+  /// against all of them in a single loop. Otherwise, AnyOf passes all values,
+  /// if any of the validators does, and the values have to be checked
+  /// individually, if none does.
+  template <class T>
+  static bool check_all(const std::span<const T>& _values) noexcept {
+    if constexpr (internal::HasFailPredicate<AnyOf, T>) {
+      return internal::none_of_values(
+          _values, [](const T& _v) { return fails(_v); });
+    } else {
+      return internal::check_all<C>(_values) ||
+             (internal::check_all<Cs>(_values) || ...);
+    }
+  }
+
+  /// Prepares all of the underlying validators.
+  static void prepare() {
+    internal::prepare_validator<C>();
+    (internal::prepare_validator<Cs>(), ...);
   }
 
  private:
@@ -29,18 +66,18 @@ struct AnyOf {
   }
 
   template <class T, class Head, class... Tail>
-  static rfl::Result<T> validate_impl(const T& _value,
-                                      std::vector<Error> _errors) {
-    const auto handle_err = [&](Error&& _err) {
+  static rfl::Result<Nothing> check_impl(const T& _value,
+                                         std::vector<Error> _errors) {
+    const auto handle_err = [&](Error&& _err) -> rfl::Result<Nothing> {
       _errors.push_back(std::forward<Error>(_err));
       if constexpr (sizeof...(Tail) == 0) {
         return make_error_message(_errors);
       } else {
-        return validate_impl<T, Tail...>(
+        return check_impl<T, Tail...>(
             _value, std::forward<std::vector<Error>>(_errors));
       }
     };
-    return Head::validate(_value).or_else(handle_err);
+    return internal::check_value<Head>(_value).or_else(handle_err);
   }
 };
 
@@ -22,6 +22,13 @@ struct Field {
   /// The name of the field.
   using Name = rfl::Literal<_name>;
 
+  /// Value-initializes the underlying object. This allows structs to be
+  /// default-constructed, so they can be parsed in place. The constructor is
+  /// explicit, so fields cannot be forgotten in designated initializers.
+  explicit Field() noexcept(std::is_nothrow_default_constructible_v<Type>)
+  requires std::is_default_constructible_v<Type>
+      : value_() {}
+
   Field(const Type& _value) : value_(_value) {}
 
   Field(Type&& _value) noexcept : value_(std::move(_value)) {}
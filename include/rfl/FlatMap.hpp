@@ -0,0 +1,178 @@
+#ifndef RFL_FLATMAP_HPP_
+#define RFL_FLATMAP_HPP_
+
+#include <algorithm>
+#include <functional>
+#include <initializer_list>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+
+#include "rfl/internal/sort_unique.hpp"
+
+namespace rfl {
+
+/// A map that keeps its entries in a single vector, sorted by key. Lookups
+/// are binary searches over contiguous memory, which is much more
+/// cache-friendly than chasing the pointers of a std::map. Inserting a single
+/// entry is linear in the size of the map, so FlatMap is best suited for maps
+/// that are built once and then queried often, like configurations. It can be
+/// used where std::flat_map, which requires C++23, is not available.
+template <class K, class V, class Compare = std::less<K>>
+class FlatMap {
+ public:
+  using key_type = K;
+  using mapped_type = V;
+  using value_type = std::pair<K, V>;
+  using key_compare = Compare;
+  using container_type = std::vector<value_type>;
+  using size_type = typename container_type::size_type;
+  using iterator = typename container_type::iterator;
+  using const_iterator = typename container_type::const_iterator;
+
+  FlatMap() = default;
+
+  FlatMap(std::initializer_list<value_type> _entries)
+      : FlatMap(container_type(_entries)) {}
+
+  /// Sorts the entries in one go, unless they are already sorted. Of several
+  /// entries with the same key, only the first is kept.
+  explicit FlatMap(container_type&& _entries, const Compare& _comp = Compare())
+      : comp_(_comp), entries_(std::move(_entries)) {
+    internal::sort_unique(&entries_, comp_, &value_type::first);
+  }
+
+  FlatMap(const FlatMap<K, V, Compare>& _other) = default;
+
+  FlatMap(FlatMap<K, V, Compare>&& _other) noexcept = default;
+
+  ~FlatMap() = default;
+
+  /// Returns the value for _key. Throws an exception, if there is none.
+  V& at(const K& _key) {
+    const auto it = find(_key);
+    if (it == end()) {
+      throw std::out_of_range("FlatMap::at: Key not found.");
+    }
+    return it->second;
+  }
+
+  /// Returns the value for _key. Throws an exception, if there is none.
+  const V& at(const K& _key) const {
+    const auto it = find(_key);
+    if (it == end()) {
+      throw std::out_of_range("FlatMap::at: Key not found.");
+    }
+    return it->second;
+  }
+
+  iterator begin() noexcept { return entries_.begin(); }
+
+  const_iterator begin() const noexcept { return entries_.begin(); }
+
+  const_iterator cbegin() const noexcept { return entries_.cbegin(); }
+
+  const_iterator cend() const noexcept { return entries_.cend(); }
+
+  void clear() noexcept { entries_.clear(); }
+
+  bool contains(const K& _key) const { return find(_key) != end(); }
+
+  size_type count(const K& _key) const { return contains(_key) ? 1 : 0; }
+
+  /// Constructs a new entry, unless there already is one for the key.
+  template <class... Args>
+  std::pair<iterator, bool> emplace(Args&&... _args) {
+    return insert(value_type(std::forward<Args>(_args)...));
+  }
+
+  bool empty() const noexcept { return entries_.empty(); }
+
+  iterator end() noexcept { return entries_.end(); }
+
+  const_iterator end() const noexcept { return entries_.end(); }
+
+  /// The underlying entries, sorted by key.
+  const container_type& entries() const noexcept { return entries_; }
+
+  /// Removes the entry for _key, if there is one.
+  size_type erase(const K& _key) {
+    const auto it = find(_key);
+    if (it == end()) {
+      return 0;
+    }
+    entries_.erase(it);
+    return 1;
+  }
+
+  iterator erase(const_iterator _it) { return entries_.erase(_it); }
+
+  iterator find(const K& _key) {
+    const auto it = lower_bound(_key);
+    return it != end() && !comp_(_key, it->first) ? it : end();
+  }
+
+  const_iterator find(const K& _key) const {
+    const auto it = lower_bound(_key);
+    return it != end() && !comp_(_key, it->first) ? it : end();
+  }
+
+  /// Inserts _entry, unless there already is an entry for the key.
+  std::pair<iterator, bool> insert(const value_type& _entry) {
+    return insert(value_type(_entry));
+  }
+
+  /// Inserts _entry, unless there already is an entry for the key.
+  std::pair<iterator, bool> insert(value_type&& _entry) {
+    const auto it = lower_bound(_entry.first);
+    if (it != end() && !comp_(_entry.first, it->first)) {
+      return std::make_pair(it, false);
+    }
+    return std::make_pair(entries_.insert(it, std::move(_entry)), true);
+  }
+
+  key_compare key_comp() const { return comp_; }
+
+  iterator lower_bound(const K& _key) {
+    return std::ranges::lower_bound(entries_, _key, comp_, &value_type::first);
+  }
+
+  const_iterator lower_bound(const K& _key) const {
+    return std::ranges::lower_bound(entries_, _key, comp_, &value_type::first);
+  }
+
+  FlatMap<K, V, Compare>& operator=(const FlatMap<K, V, Compare>& _other) =
+      default;
+
+  FlatMap<K, V, Compare>& operator=(FlatMap<K, V, Compare>&& _other) noexcept =
+      default;
+
+  /// Returns the value for _key, inserting a default-constructed one, if
+  /// there is none.
+  V& operator[](const K& _key) {
+    const auto it = lower_bound(_key);
+    if (it != end() && !comp_(_key, it->first)) {
+      return it->second;
+    }
+    return entries_.insert(it, value_type(_key, V()))->second;
+  }
+
+  bool operator==(const FlatMap<K, V, Compare>& _other) const {
+    return entries_ == _other.entries_;
+  }
+
+  void reserve(const size_type _size) { entries_.reserve(_size); }
+
+  size_type size() const noexcept { return entries_.size(); }
+
+ private:
+  /// Compares the keys.
+  Compare comp_;
+
+  /// The entries, sorted by key and without duplicate keys.
+  container_type entries_;
+};
+
+}  // namespace rfl
+
+#endif
@@ -148,6 +148,12 @@ class Literal {
         return !(*this == _other);
     }
 
+    /// Orders Literals by their position in the template, so they can be
+    /// used as keys in ordered maps.
+    bool operator<(const Literal<fields_...>& _other) const {
+        return value() < _other.value();
+    }
+
     /// Equality operator for strings.
     bool operator==(const std::string& _str) const { return name() == _str; }
 
@@ -0,0 +1,76 @@
+#ifndef RFL_OBJECTMAP_HPP_
+#define RFL_OBJECTMAP_HPP_
+
+#include <type_traits>
+#include <utility>
+
+namespace rfl {
+
+/// Maps with keys other than strings are usually written as arrays of
+/// key-value pairs. Wrapping a map with integral or rfl::Literal keys in an
+/// ObjectMap writes it as an object instead, with the keys converted to
+/// strings. This is more compact and faster to read.
+template <class T>
+struct ObjectMap {
+  /// The underlying type.
+  using Type = std::decay_t<T>;
+
+  ObjectMap() = default;
+
+  ObjectMap(const Type& _value) : value_(_value) {}
+
+  ObjectMap(Type&& _value) noexcept : value_(std::forward<Type>(_value)) {}
+
+  ObjectMap(const ObjectMap<T>& _m) = default;
+
+  ObjectMap(ObjectMap<T>&& _m) noexcept = default;
+
+  ~ObjectMap() = default;
+
+  /// Returns the underlying map.
+  Type& get() { return value_; }
+
+  /// Returns the underlying map.
+  const Type& get() const { return value_; }
+
+  /// Returns the underlying map.
+  Type& operator()() { return value_; }
+
+  /// Returns the underlying map.
+  const Type& operator()() const { return value_; }
+
+  /// Assigns the underlying map.
+  ObjectMap<T>& operator=(const Type& _value) {
+    value_ = _value;
+    return *this;
+  }
+
+  /// Assigns the underlying map.
+  ObjectMap<T>& operator=(Type&& _value) {
+    value_ = std::forward<Type>(_value);
+    return *this;
+  }
+
+  /// Assigns the underlying map.
+  ObjectMap<T>& operator=(const ObjectMap<T>& _m) = default;
+
+  /// Assigns the underlying map.
+  ObjectMap<T>& operator=(ObjectMap<T>&& _m) = default;
+
+  bool operator==(const ObjectMap<T>& _other) const {
+    return value_ == _other.value_;
+  }
+
+  /// Assigns the underlying map.
+  void set(const Type& _value) { value_ = _value; }
+
+  /// Assigns the underlying map.
+  void set(Type&& _value) { value_ = std::forward<Type>(_value); }
+
+  /// The underlying map.
+  Type value_;
+};
+
+}  // namespace rfl
+
+#endif
@@ -6,6 +6,7 @@
 #include <vector>
 
 #include "rfl/Result.hpp"
+#include "rfl/internal/HasValidation.hpp"
 
 namespace rfl {
 
@@ -13,8 +14,20 @@ namespace rfl {
 template <class C, class... Cs>
 struct OneOf {
   template <class T>
-  static rfl::Result<T> validate(const T& _value) noexcept {
-    return validate_impl<T, C, Cs...>(_value, {});
+  static rfl::Result<Nothing> check(const T& _value) noexcept {
+    return check_impl<T, C, Cs...>(_value, {});
+  }
+
+  /// Returns the value, if exactly one of the validators passes.
+  template <class T>
+  static Result<T> validate(T _value) noexcept {
+    return internal::validate_by_check<OneOf>(std::move(_value));
+  }
+
+  /// Prepares all of the underlying validators.
+  static void prepare() {
+    internal::prepare_validator<C>();
+    (internal::prepare_validator<Cs>(), ...);
   }
 
  private:
@@ -31,30 +44,20 @@ struct OneOf {
   }
 
   template <class T, class Head, class... Tail>
-  static rfl::Result<T> validate_impl(const T& _value,
-                                      std::vector<Error> _errors) {
-    const auto push_back = [&](Error&& _err) -> rfl::Result<T> {
-      _errors.emplace_back(std::forward<Error>(_err));
-      return _err;
-    };
-
-    const auto next_validation = [&](rfl::Result<T>&& _r) -> rfl::Result<T> {
-      _r.or_else(push_back);
-
-      if constexpr (sizeof...(Tail) == 0) {
-        if (_errors.size() == sizeof...(Cs)) {
-          return _value;
-        }
-        return make_error_message(_errors);
-      } else {
-        return validate_impl<T, Tail...>(
-            _value, std::forward<std::vector<Error>>(_errors));
+  static rfl::Result<Nothing> check_impl(const T& _value,
+                                         std::vector<Error> _errors) {
+    const auto err = internal::check_value<Head>(_value).error();
+    if (err) {
+      _errors.emplace_back(*err);
+    }
+    if constexpr (sizeof...(Tail) == 0) {
+      if (_errors.size() == sizeof...(Cs)) {
+        return Nothing{};
       }
-    };
-
-    return Head::validate(_value)
-        .and_then(next_validation)
-        .or_else(next_validation);
+      return make_error_message(_errors);
+    } else {
+      return check_impl<T, Tail...>(_value, std::move(_errors));
+    }
   }
 };
 
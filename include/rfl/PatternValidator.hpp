@@ -1,55 +1,71 @@
 #ifndef RFL_PATTERNVALIDATOR_HPP_
 #define RFL_PATTERNVALIDATOR_HPP_
 
-#include <ctime>
-#include <iterator>
 #include <optional>
-#include <regex>
-#include <stdexcept>
 #include <string>
+#include <string_view>
 
+#include "internal/HasValidation.hpp"
 #include "internal/Memoization.hpp"
 #include "internal/StringLiteral.hpp"
+#include "internal/regex/Matcher.hpp"
 #include "rfl/Literal.hpp"
 #include "rfl/Result.hpp"
 
 namespace rfl {
 
+/// Decides whether a string matches _regex. By default, the regex is compiled
+/// into a DFA on first use. Can be specialized to provide a hand-written
+/// matcher for a particular regex, as is done for the patterns in
+/// patterns.hpp.
+template <internal::StringLiteral _regex>
+struct PatternMatcher {
+  static Result<bool> match(const std::string_view& _str) noexcept {
+    const auto& m = matcher();
+    if (!m) {
+      return Error("Regex pattern '" + _regex.str() + "' failed to compile.");
+    }
+    return m->match(_str);
+  }
+
+  /// Compiles the regex ahead of its first use.
+  static void prepare() { matcher(); }
+
+ private:
+  static const std::optional<internal::regex::Matcher>& matcher() noexcept {
+    return matcher_.value(
+        [](std::optional<internal::regex::Matcher>* _matcher) {
+          *_matcher = internal::regex::Matcher::make(_regex.str());
+        });
+  }
+
+  /// The compiled regex.
+  static inline internal::Memoization<std::optional<internal::regex::Matcher>>
+      matcher_;
+};
+
 template <internal::StringLiteral _regex, internal::StringLiteral _name>
 struct PatternValidator {
-  static Result<std::string> validate(const std::string& _str) noexcept {
-    const auto check_pattern =
-        [&](const auto _regex_pattern) -> rfl::Result<std::string> {
-      if (!std::regex_match(_str, *_regex_pattern)) {
+  static Result<Nothing> check(const std::string& _str) noexcept {
+    const auto check_match = [&](const bool _matches) -> Result<Nothing> {
+      if (!_matches) {
         return rfl::Error("String '" + _str + "' did not match format '" +
                           _name.str() + "': '" + _regex.str() + "'.");
       }
-      return _str;
+      return Nothing{};
     };
-
-    return regex_pattern().and_then(check_pattern);
+    return PatternMatcher<_regex>::match(_str).and_then(check_match);
   }
 
- private:
-  /// Uses a memoization pattern to init the pattern.
-  static rfl::Result<const std::regex*> regex_pattern() noexcept {
-    const auto compile_pattern = [](std::optional<std::regex>* _regex_pattern) {
-      try {
-        *_regex_pattern = std::regex(_regex.str());
-      } catch (std::exception& e) {
-        return;
-      }
-    };
-    const auto& r = regex_pattern_.value(compile_pattern);
-    if (!r) {
-      return Error("Regex pattern '" + _regex.str() + "' failed to compile.");
-    }
-    return &(*r);
+  /// Returns the string, if it matches.
+  static Result<std::string> validate(const std::string& _str) noexcept {
+    return internal::validate_by_check<PatternValidator>(std::string(_str));
   }
 
- private:
-  /// The underlying regex pattern.
-  static inline internal::Memoization<std::optional<std::regex>> regex_pattern_;
+  /// Compiles the regex, unless it is matched by hand-written code.
+  static void prepare() {
+    internal::prepare_validator<PatternMatcher<_regex>>();
+  }
 };
 
 }  // namespace rfl
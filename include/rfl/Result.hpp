@@ -1,12 +1,15 @@
 #ifndef RFL_RESULT_HPP_
 #define RFL_RESULT_HPP_
 
+#include <memory>
+#include <new>
 #include <optional>
 #include <ranges>
 #include <stdexcept>
+#include <string>
 #include <tuple>
 #include <type_traits>
-#include <variant>
+#include <utility>
 #include <vector>
 
 namespace rfl {
@@ -14,16 +17,44 @@ namespace rfl {
 /// To be returned
 class Error {
  public:
-  Error(const std::string& _what) : what_(_what) {}
+  Error(const std::string& _what)
+      : what_(std::make_unique<std::string>(_what)) {}
+
+  Error(std::string&& _what)
+      : what_(std::make_unique<std::string>(std::move(_what))) {}
+
+  Error(const Error& _other)
+      : what_(std::make_unique<std::string>(_other.what())) {}
+
+  Error(Error&& _other) noexcept = default;
 
   ~Error() = default;
 
   /// Returns the error message, equivalent to .what() in std::exception.
-  const std::string& what() const { return what_; }
+  const std::string& what() const {
+    if (!what_) [[unlikely]] {
+      static const std::string empty;
+      return empty;
+    }
+    return *what_;
+  }
+
+  /// Assigns the underlying object.
+  Error& operator=(const Error& _other) {
+    if (this != &_other) {
+      what_ = std::make_unique<std::string>(_other.what());
+    }
+    return *this;
+  }
+
+  /// Assigns the underlying object.
+  Error& operator=(Error&& _other) noexcept = default;
 
  private:
-  /// Documents what went wrong
-  std::string what_;
+  /// Documents what went wrong. The message is kept on the heap, so that
+  /// an Error is no larger than a pointer, which keeps results of small
+  /// types small.
+  std::unique_ptr<std::string> what_;
 };
 
 /// Can be used when we are simply interested in whether an operation was
@@ -31,37 +62,78 @@ class Error {
 struct Nothing {};
 
 /// The Result class is used for monadic error handling.
+///
+/// The monadic operations (and_then, or_else, transform) are overloaded on
+/// the value category of the result: Called on an rvalue, such as the return
+/// value of another function, they move the value into the continuation.
+/// Called on an lvalue, they pass it by reference and leave it intact.
 template <class T>
 class Result {
   static_assert(!std::is_same<T, Error>(), "The result type cannot be Error.");
 
+  static_assert(!std::is_reference_v<T>,
+                "The result type cannot be a reference.");
+
+  template <class U>
+  friend class Result;
+
+  /// Tag type for constructing the value from the return value of a function
+  /// without moving it.
+  struct FromCall {};
+
  public:
-  Result(const T& _val) : t_or_err_(_val) {}
+  Result(const T& _val) : success_(true) { new (&t_) T(_val); }
 
-  Result(T&& _val) noexcept : t_or_err_(std::move(_val)) {}
+  Result(T&& _val) noexcept(std::is_nothrow_move_constructible_v<T>)
+      : success_(true) {
+    new (&t_) T(std::move(_val));
+  }
 
-  Result(const Error& _err) : t_or_err_(_err) {}
+  Result(const Error& _err) : success_(false) { new (&err_) Error(_err); }
 
-  Result(Error&& _err) noexcept : t_or_err_(std::move(_err)) {}
+  Result(Error&& _err) noexcept : success_(false) {
+    new (&err_) Error(std::move(_err));
+  }
 
-  Result(Result<T>&& _other) noexcept = default;
+  Result(Result<T>&& _other) noexcept(
+      std::is_nothrow_move_constructible_v<T>)
+      : success_(_other.success_) {
+    if (success_) [[likely]] {
+      new (&t_) T(std::move(_other.t_));
+    } else {
+      new (&err_) Error(std::move(_other.err_));
+    }
+  }
 
-  Result(const Result<T>& _other) = default;
+  Result(const Result<T>& _other) : success_(_other.success_) {
+    if (success_) [[likely]] {
+      new (&t_) T(_other.t_);
+    } else {
+      new (&err_) Error(_other.err_);
+    }
+  }
 
   template <class U, typename std::enable_if<std::is_convertible_v<U, T>,
                                              bool>::type = true>
-  Result(Result<U>&& _other)
-      : t_or_err_(std::forward<Result<U>>(_other)
-                      .transform([](U&& _u) { return T(std::forward<U>(_u)); })
-                      .t_or_err_) {}
+  Result(Result<U>&& _other) : success_(_other.success_) {
+    if (success_) [[likely]] {
+      new (&t_) T(std::move(_other.t_));
+    } else {
+      new (&err_) Error(std::move(_other.err_));
+    }
+  }
 
   template <class U, typename std::enable_if<std::is_convertible_v<U, T>,
                                              bool>::type = true>
-  Result(const Result<U>& _other)
-      : t_or_err_(
-            _other.transform([](const U& _u) { return T(_u); }).t_or_err_) {}
+  Result(const Result<U>& _other) : success_(_other.success_) {
+    if (success_) [[likely]] {
+      new (&t_) T(_other.t_);
+    } else {
+      new (&err_) Error(_other.err_);
+    }
+  }
 
-  ~Result() = default;
+  ~Result() { destroy(); }
 
   /// Returns Result<U>, if successful and error otherwise.
   /// Inspired by .and(...) in the Rust std::result type.
@@ -73,168 +145,117 @@ class Result {
 
   /// Monadic operation - F must be a function of type T -> Result<U>.
   template <class F>
-  auto and_then(const F& _f) {
-    /// Result_U is expected to be of type Result<U>.
-    using Result_U = typename std::invoke_result<F, T>::type;
-
-    const auto handle_variant =
-        [&]<class TOrError>(TOrError&& _t_or_err) -> Result_U {
-      if constexpr (!std::is_same<std::decay_t<TOrError>, Error>()) {
-        return _f(std::forward<TOrError>(_t_or_err));
-      } else {
-        return std::forward<TOrError>(_t_or_err);
-      }
-    };
-
-    return std::visit(handle_variant,
-                      std::forward<std::variant<T, Error>>(t_or_err_));
+  auto and_then(const F& _f) & {
+    return and_then_impl(*this, _f);
   }
 
   /// Monadic operation - F must be a function of type T -> Result<U>.
   template <class F>
-  auto and_then(const F& _f) const {
-    /// Result_U is expected to be of type Result<U>.
-    using Result_U = typename std::invoke_result<F, T>::type;
-
-    const auto handle_variant =
-        [&]<class TOrError>(const TOrError& _t_or_err) -> Result_U {
-      if constexpr (!std::is_same<TOrError, Error>()) {
-        return _f(_t_or_err);
-      } else {
-        return _t_or_err;
-      }
-    };
+  auto and_then(const F& _f) const& {
+    return and_then_impl(*this, _f);
+  }
 
-    return std::visit(handle_variant, t_or_err_);
+  /// Monadic operation - F must be a function of type T -> Result<U>. The
+  /// value is moved into _f.
+  template <class F>
+  auto and_then(const F& _f) && {
+    return and_then_impl(std::move(*this), _f);
   }
 
   /// Results types can be iterated over, which even make it possible to use
   /// them within a std::range.
-  T* begin() noexcept {
-    const auto get_ptr =
-        [this]<class TOrError>(const TOrError& _t_or_err) -> T* {
-      if constexpr (!std::is_same<TOrError, Error>()) {
-        return &_t_or_err;
-      } else {
-        return nullptr;
-      }
-    };
-    return std::visit(get_ptr, t_or_err_);
-  }
+  T* begin() noexcept { return success_ ? &t_ : nullptr; }
 
   /// Results types can be iterated over, which even make it possible to use
   /// them within a std::range.
-  const T* begin() const noexcept {
-    const auto get_ptr =
-        [this]<class TOrError>(const TOrError& _t_or_err) -> const T* {
-      if constexpr (!std::is_same<TOrError, Error>()) {
-        return &_t_or_err;
-      } else {
-        return nullptr;
-      }
-    };
-    return std::visit(get_ptr, t_or_err_);
-  }
+  const T* begin() const noexcept { return success_ ? &t_ : nullptr; }
 
   /// Results types can be iterated over, which even make it possible to use
   /// them within a std::range.
-  T* end() noexcept {
-    const auto get_ptr =
-        [this]<class TOrError>(const TOrError& _t_or_err) -> T* {
-      if constexpr (!std::is_same<TOrError, Error>()) {
-        return &_t_or_err + 1;
-      } else {
-        return nullptr;
-      }
-    };
-    return std::visit(get_ptr, t_or_err_);
-  }
+  T* end() noexcept { return success_ ? &t_ + 1 : nullptr; }
 
   /// Results types can be iterated over, which even make it possible to use
   /// them within a std::range.
-  const T* end() const noexcept {
-    const auto get_ptr =
-        []<class TOrError>(const TOrError& _t_or_err) -> const T* {
-      if constexpr (!std::is_same<TOrError, Error>()) {
-        return &_t_or_err + 1;
-      } else {
-        return nullptr;
-      }
-    };
-    return std::visit(get_ptr, t_or_err_);
-  }
+  const T* end() const noexcept { return success_ ? &t_ + 1 : nullptr; }
 
   /// Returns an std::optional<error> if this does in fact contain an error
   /// or std::nullopt otherwise.
   std::optional<Error> error() const noexcept {
-    const auto get_err =
-        []<class TOrError>(const TOrError& _t_or_err) -> std::optional<Error> {
-      if constexpr (!std::is_same<TOrError, Error>()) {
-        return std::nullopt;
-      } else {
-        return _t_or_err;
-      }
-    };
-    return std::visit(get_err, t_or_err_);
+    if (success_) [[likely]] {
+      return std::nullopt;
+    }
+    return err_;
   }
 
   /// Returns true if the result contains a value, false otherwise.
-  operator bool() const noexcept {
-    return !std::holds_alternative<Error>(t_or_err_);
-  }
+  operator bool() const noexcept { return success_; }
 
   /// Allows access to the underlying value. Careful: Will result in undefined
   /// behavior, if the result contains an error.
-  T& operator*() { return *std::get_if<T>(&t_or_err_); }
+  T& operator*() & { return t_; }
 
   /// Allows read access to the underlying value. Careful: Will result in
   /// undefined behavior, if the result contains an error.
-  const T& operator*() const { return *std::get_if<T>(&t_or_err_); }
+  const T& operator*() const& { return t_; }
+
+  /// Allows access to the underlying value. Careful: Will result in undefined
+  /// behavior, if the result contains an error.
+  T&& operator*() && { return std::move(t_); }
 
   /// Assigns the underlying object.
-  Result<T>& operator=(const Result<T>& _other) = default;
+  Result<T>& operator=(const Result<T>& _other) {
+    if (this != &_other) {
+      assign(_other);
+    }
+    return *this;
+  }
 
   /// Assigns the underlying object.
-  Result<T>& operator=(Result<T>&& _other) = default;
+  Result<T>& operator=(Result<T>&& _other) noexcept(
+      std::is_nothrow_move_constructible_v<T> &&
+      std::is_nothrow_move_assignable_v<T>) {
+    if (this != &_other) {
+      assign(std::move(_other));
+    }
+    return *this;
+  }
 
   /// Assigns the underlying object.
   template <class U, typename std::enable_if<std::is_convertible_v<U, T>,
                                              bool>::type = true>
   auto& operator=(const Result<U>& _other) {
-    const auto to_t = [](const U& _u) -> T { return _u; };
-    t_or_err_ = _other.transform(to_t).t_or_err_;
+    assign(_other);
     return *this;
   }
 
   /// Expects a function that takes of type Error -> Result<T> and returns
   /// Result<T>.
   template <class F>
-  Result<T> or_else(const F& _f) {
-    const auto handle_variant =
-        [&]<class TOrError>(TOrError&& _t_or_err) -> Result<T> {
-      if constexpr (std::is_same<std::decay_t<TOrError>, Error>()) {
-        return _f(std::forward<Error>(_t_or_err));
-      } else {
-        return std::forward<T>(_t_or_err);
-      }
-    };
-    return std::visit(handle_variant,
-                      std::forward<std::variant<T, Error>>(t_or_err_));
+  Result<T> or_else(const F& _f) & {
+    if (success_) [[likely]] {
+      return *this;
+    }
+    return _f(err_);
   }
 
   /// Expects a function that takes of type Error -> Result<T> and returns
   /// Result<T>.
   template <class F>
-  Result<T> or_else(const F& _f) const {
-    const auto handle_variant =
-        [&_f]<class TOrError>(const TOrError& _t_or_err) -> Result<T> {
-      if constexpr (std::is_same<TOrError, Error>()) {
-        return _f(_t_or_err);
-      } else {
-        return _t_or_err;
-      }
-    };
-    return std::visit(handle_variant, t_or_err_);
+  Result<T> or_else(const F& _f) const& {
+    if (success_) [[likely]] {
+      return *this;
+    }
+    return _f(err_);
+  }
+
+  /// Expects a function that takes of type Error -> Result<T> and returns
+  /// Result<T>. The error is moved into _f.
+  template <class F>
+  Result<T> or_else(const F& _f) && {
+    if (success_) [[likely]] {
+      return std::move(*this);
+    }
+    return _f(std::move(err_));
   }
 
   /// Returns the value contained if successful or the provided result r if
@@ -246,100 +267,154 @@ class Result {
 
   /// Functor operation - F must be a function of type T -> U.
   template <class F>
-  auto transform(const F& _f) {
-    /// Result_U is expected to be of type Result<U>.
-    using U = typename std::invoke_result<F, T>::type;
-
-    const auto handle_variant =
-        [&]<class TOrError>(TOrError&& _t_or_err) -> rfl::Result<U> {
-      if constexpr (!std::is_same<std::decay_t<TOrError>, Error>()) {
-        return _f(std::forward<TOrError>(_t_or_err));
-      } else {
-        return std::forward<TOrError>(_t_or_err);
-      }
-    };
-
-    return std::visit(handle_variant,
-                      std::forward<std::variant<T, Error>>(t_or_err_));
+  auto transform(const F& _f) & {
+    return transform_impl(*this, _f);
   }
 
   /// Functor operation - F must be a function of type T -> U.
   template <class F>
-  auto transform(const F& _f) const {
-    /// Result_U is expected to be of type Result<U>.
-    using U = typename std::invoke_result<F, T>::type;
-
-    const auto handle_variant =
-        [&]<class TOrError>(const TOrError& _t_or_err) -> rfl::Result<U> {
-      if constexpr (!std::is_same<TOrError, Error>()) {
-        return _f(_t_or_err);
-      } else {
-        return _t_or_err;
-      }
-    };
+  auto transform(const F& _f) const& {
+    return transform_impl(*this, _f);
+  }
 
-    return std::visit(handle_variant, t_or_err_);
+  /// Functor operation - F must be a function of type T -> U. The value is
+  /// moved into _f.
+  template <class F>
+  auto transform(const F& _f) && {
+    return transform_impl(std::move(*this), _f);
   }
 
   /// Returns the value if the result does not contain an error, throws an
   /// exceptions if not. Similar to .unwrap() in Rust.
-  T value() {
-    const auto handle_variant = [&]<class TOrError>(TOrError& _t_or_err) -> T {
-      if constexpr (!std::is_same<TOrError, Error>()) {
-        return std::forward<T>(_t_or_err);
-      } else {
-        throw std::runtime_error(_t_or_err.what());
-      }
-    };
-    return std::visit(handle_variant, t_or_err_);
+  T& value() & {
+    throw_if_error();
+    return t_;
   }
 
   /// Returns the value if the result does not contain an error, throws an
   /// exceptions if not. Similar to .unwrap() in Rust.
-  const T& value() const {
-    const auto handle_variant =
-        [&]<class TOrError>(const TOrError& _t_or_err) -> const T& {
-      if constexpr (!std::is_same<TOrError, Error>()) {
-        return _t_or_err;
-      } else {
-        throw std::runtime_error(_t_or_err.what());
-      }
-    };
-    return std::visit(handle_variant, t_or_err_);
+  const T& value() const& {
+    throw_if_error();
+    return t_;
   }
 
-  /// Returns the value or a default.
-  T value_or(const T& _default) noexcept {
-    const auto handle_variant =
-        [&]<class TOrError>(const TOrError& _t_or_err) -> T {
-      if constexpr (!std::is_same<TOrError, Error>()) {
-        return std::forward<T>(_t_or_err);
-      } else {
-        return _default;
-      }
-    };
-    return std::visit(handle_variant, t_or_err_);
+  /// Returns the value if the result does not contain an error, throws an
+  /// exceptions if not. Similar to .unwrap() in Rust. The value is moved out
+  /// of the result.
+  T value() && {
+    throw_if_error();
+    return std::move(t_);
   }
 
   /// Returns the value or a default.
-  T value_or(const T& _default) const noexcept {
-    const auto handle_variant =
-        [&]<class TOrError>(const TOrError& _t_or_err) -> T {
-      if constexpr (!std::is_same<TOrError, Error>()) {
-        return _t_or_err;
-      } else {
-        return _default;
+  T value_or(const T& _default) const& noexcept {
+    if (success_) [[likely]] {
+      return t_;
+    }
+    return _default;
+  }
+
+  /// Returns the value or a default. The value is moved out of the result.
+  T value_or(T&& _default) && noexcept {
+    if (success_) [[likely]] {
+      return std::move(t_);
+    }
+    return std::move(_default);
+  }
+
+ private:
+  /// Constructs the value directly from the return value of _f, so it does
+  /// not have to be moved into the result.
+  template <class F, class Arg>
+  Result(FromCall, const F& _f, Arg&& _arg) : success_(true) {
+    new (&t_) T(_f(std::forward<Arg>(_arg)));
+  }
+
+  /// Implements and_then for all value categories.
+  template <class Self, class F>
+  static auto and_then_impl(Self&& _self, const F& _f) {
+    /// T&, const T& or T&&, depending on the value category of _self.
+    using ArgType = decltype((std::forward<Self>(_self).t_));
+
+    /// Result_U is expected to be of type Result<U>.
+    using Result_U = std::invoke_result_t<F, ArgType>;
+
+    if (_self.success_) [[likely]] {
+      return _f(std::forward<Self>(_self).t_);
+    }
+    return Result_U(std::forward<Self>(_self).err_);
+  }
+
+  /// Implements transform for all value categories.
+  template <class Self, class F>
+  static auto transform_impl(Self&& _self, const F& _f) {
+    /// T&, const T& or T&&, depending on the value category of _self.
+    using ArgType = decltype((std::forward<Self>(_self).t_));
+
+    using U = std::invoke_result_t<F, ArgType>;
+
+    if (_self.success_) [[likely]] {
+      return Result<U>(typename Result<U>::FromCall{}, _f,
+                       std::forward<Self>(_self).t_);
+    }
+    return Result<U>(std::forward<Self>(_self).err_);
+  }
+
+  /// Replaces the content with the content of another result. If
+  /// constructing the new value throws, the result keeps its old error, so
+  /// success_ never refers to storage that has not been constructed.
+  template <class Other>
+  void assign(Other&& _other) {
+    if (success_ && _other.success_) {
+      t_ = std::forward<Other>(_other).t_;
+    } else if (!success_ && !_other.success_) {
+      err_ = std::forward<Other>(_other).err_;
+    } else if (_other.success_) {
+      Error old_err(std::move(err_));
+      err_.~Error();
+      try {
+        new (&t_) T(std::forward<Other>(_other).t_);
+      } catch (...) {
+        new (&err_) Error(std::move(old_err));
+        throw;
       }
-    };
-    return std::visit(handle_variant, t_or_err_);
+      success_ = true;
+    } else {
+      // Copying the error may throw, moving it does not.
+      Error new_err(std::forward<Other>(_other).err_);
+      t_.~T();
+      new (&err_) Error(std::move(new_err));
+      success_ = false;
+    }
+  }
+
+  /// Destroys whatever the result currently contains.
+  void destroy() noexcept {
+    if (success_) [[likely]] {
+      t_.~T();
+    } else {
+      err_.~Error();
+    }
+  }
+
+  /// Throws the error as an exception, if there is one.
+  void throw_if_error() const {
+    if (!success_) [[unlikely]] {
+      throw std::runtime_error(err_.what());
+    }
   }
 
  private:
-  /// The underlying variant, can either be T or Error.
-  std::variant<T, Error> t_or_err_;
+  /// Either the value or the error, depending on success_.
+  union {
+    T t_;
+    Error err_;
+  };
+
+  /// Whether the result contains a value.
+  bool success_;
 };
 
 }  // namespace rfl
 
 #endif
-
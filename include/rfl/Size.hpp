@@ -2,19 +2,28 @@
 #define RFL_SIZE_HPP_
 
 #include "rfl/Result.hpp"
+#include "rfl/internal/HasValidation.hpp"
 
 namespace rfl {
 
 template <class V>
 struct Size {
   template <class T>
-  static rfl::Result<T> validate(const T& _t) {
-    const auto to_t = [&](const auto& _v) { return _t; };
+  static rfl::Result<Nothing> check(const T& _t) noexcept {
     const auto embellish_error = [](const auto& _err) {
       return Error("Size validation failed: " + _err.what());
     };
-    return V::validate(_t.size()).transform(to_t).or_else(embellish_error);
+    return internal::check_value<V>(_t.size()).or_else(embellish_error);
   }
+
+  /// Returns the value, if its size passes.
+  template <class T>
+  static rfl::Result<T> validate(const T& _t) noexcept {
+    return internal::validate_by_check<Size>(T(_t));
+  }
+
+  /// Prepares the underlying validator.
+  static void prepare() { internal::prepare_validator<V>(); }
 };
 
 }  // namespace rfl
@@ -1,76 +1,118 @@
 #ifndef RFL_TIMESTAMP_HPP_
 #define RFL_TIMESTAMP_HPP_
 
+#include <chrono>
+#include <compare>
+#include <cstddef>
 #include <ctime>
-#include <iterator>
 #include <stdexcept>
 #include <string>
 
 #include "internal/StringLiteral.hpp"
+#include "internal/TimestampFormat.hpp"
+#include "rfl/Literal.hpp"
 #include "rfl/Result.hpp"
 
 namespace rfl {
 
-/// For serializing and deserializing time stamps.
+/// For serializing and deserializing time stamps. The time stamp is stored
+/// as the number of seconds since the epoch (UTC). The format is compiled at
+/// compile time, so that common formats like "%Y-%m-%dT%H:%M:%S" are parsed
+/// and formatted without strptime or strftime.
 template <internal::StringLiteral _format>
 class Timestamp {
     constexpr static const internal::StringLiteral format_ = _format;
 
+    using CompiledFormat = internal::TimestampFormat<_format>;
+
    public:
     using Format = rfl::Literal<_format>;
 
     using ReflectionType = std::string;
 
-    Timestamp(const char* _str) {
-        const auto r = strptime(_str, format_.value_, &tm_);
-        if (r == NULL) {
-            throw std::runtime_error("String '" + std::string(_str) +
-                                     "' did not match format '" +
-                                     Format().str() + "'.");
-        }
-    }
+    /// The maximum length of the string representation.
+    static constexpr size_t max_size_ = CompiledFormat::max_size_;
 
-    Timestamp(const std::string& _str) : Timestamp(_str.c_str()) {}
+    Timestamp(const char* _str) : Timestamp(std::string(_str)) {}
 
-    Timestamp(const std::tm& _tm) : tm_(_tm) {}
+    Timestamp(const std::string& _str) : time_point_(parse(_str)) {}
+
+    Timestamp(const std::tm& _tm)
+        : time_point_(internal::tm_to_time_point(_tm)) {}
+
+    Timestamp(const std::chrono::sys_seconds& _time_point)
+        : time_point_(_time_point) {}
 
     ~Timestamp() = default;
 
     /// Returns a result containing the timestamp when successful or an Error
     /// otherwise.
     static Result<Timestamp> from_string(const char* _str) noexcept {
-        try {
-            return Timestamp(_str);
-        } catch (std::exception& e) {
-            return Error(e.what());
-        }
+        return from_string(std::string(_str));
     }
 
     /// Returns a result containing the timestamp when successful or an Error
     /// otherwise.
-    static Result<Timestamp> from_string(const std::string& _str) {
-        return from_string(_str.c_str());
+    static Result<Timestamp> from_string(const std::string& _str) noexcept {
+        const auto time_point = CompiledFormat::parse(_str);
+        if (!time_point) {
+            return Error(make_error_message(_str));
+        }
+        return Timestamp(*time_point);
     }
 
     /// Necessary for the serialization to work.
     ReflectionType reflection() const {
-        char outstr[200];
-        strftime(outstr, 200, format_.value_, &tm_);
-        return std::string(outstr);
+        char outstr[max_size_];
+        return std::string(outstr, write_to(outstr));
+    }
+
+    /// Writes the string representation into _buf, which must be at least
+    /// max_size_ bytes long, and returns the number of bytes written. The
+    /// parsers use this to write time stamps without allocating.
+    size_t write_to(char* _buf) const noexcept {
+        return CompiledFormat::format(time_point_, _buf);
     }
 
     /// Expresses the underlying timestamp as a string.
     std::string str() const { return reflection(); }
 
-    /// Trivial accessor to the underlying time stamp.
-    std::tm& tm() { return tm_; }
+    /// The underlying time stamp.
+    const std::chrono::sys_seconds& time_point() const { return time_point_; }
+
+    /// The underlying time stamp expressed as a std::tm in UTC. This is a
+    /// copy, so changes must be written back using set_tm(...).
+    std::tm tm() const { return internal::time_point_to_tm(time_point_); }
 
-    /// Trivial (const) accessor to the underlying time stamp.
-    const std::tm& tm() const { return tm_; }
+    /// Replaces the underlying time stamp, interpreting _tm as UTC.
+    void set_tm(const std::tm& _tm) noexcept {
+        time_point_ = internal::tm_to_time_point(_tm);
+    }
+
+    /// Replaces the underlying time stamp.
+    void set_time_point(const std::chrono::sys_seconds& _time_point) noexcept {
+        time_point_ = _time_point;
+    }
+
+    auto operator<=>(const Timestamp& _other) const = default;
+
+   private:
+    static std::string make_error_message(const std::string& _str) {
+        return "String '" + _str + "' did not match format '" +
+               Format().str() + "'.";
+    }
+
+    static std::chrono::sys_seconds parse(const std::string& _str) {
+        const auto time_point = CompiledFormat::parse(_str);
+        if (!time_point) {
+            throw std::runtime_error(make_error_message(_str));
+        }
+        return *time_point;
+    }
 
    private:
     /// The underlying time stamp.
-    std::tm tm_;
+    std::chrono::sys_seconds time_point_;
 };
 
 }  // namespace rfl
@@ -4,9 +4,11 @@
 #include <concepts>
 #include <optional>
 #include <regex>
+#include <span>
 #include <string>
 #include <type_traits>
 #include <utility>
+#include <vector>
 
 #include "internal/HasValidation.hpp"
 #include "internal/StringLiteral.hpp"
@@ -22,43 +24,91 @@ struct Validator {
 
   /// Exception-free validation.
   static Result<Validator<T, V>> from_value(const T& _value) noexcept {
-    try {
-      return Validator<T, V>(_value);
-    } catch (std::exception& e) {
-      return Error(e.what());
+    return from_value(T(_value));
+  }
+
+  /// Exception-free validation. The value is checked in place and then moved
+  /// into the validator, so it is never copied.
+  static Result<Validator<T, V>> from_value(T&& _value) noexcept {
+    const auto res = internal::check_value<V>(_value);
+    if (!res) {
+      return *res.error();
+    }
+    return Validator<T, V>(std::move(_value), Checked{});
+  }
+
+  /// Validates all values at once and moves them into validators. Validators
+  /// that support batch checks, such as the comparisons, check the entire
+  /// range in a single pass. Errors for individual values are only generated
+  /// if that fails.
+  static Result<std::vector<Validator<T, V>>> from_values(
+      std::vector<T>&& _values) noexcept {
+    auto validators = std::vector<Validator<T, V>>();
+    const auto res = assign_values(std::span<T>(_values), &validators);
+    if (!res) {
+      return *res.error();
+    }
+    return validators;
+  }
+
+  /// Like from_values, but moves the values into an existing vector of
+  /// validators, whose capacity is retained. If any of the values does not
+  /// pass, _validators is left untouched.
+  template <class A>
+  static Result<Nothing> assign_values(
+      const std::span<T> _values,
+      std::vector<Validator<T, V>, A>* _validators) noexcept {
+    if (!internal::check_all<V>(std::span<const T>(_values))) {
+      for (const auto& v : _values) {
+        const auto res = internal::check_value<V>(v);
+        if (!res) {
+          return *res.error();
+        }
+      }
+    }
+    _validators->clear();
+    _validators->reserve(_values.size());
+    for (auto& v : _values) {
+      _validators->emplace_back(Validator<T, V>(std::move(v), Checked{}));
     }
+    return Nothing{};
   }
 
-  Validator() : value_(V::validate(T()).value()) {}
+  Validator() : value_() { check(value_); }
 
   Validator(Validator<T, V>&& _other) noexcept = default;
 
   Validator(const Validator<T, V>& _other) = default;
 
-  Validator(T&& _value) : value_(V::validate(_value).value()) {}
+  Validator(T&& _value) : value_(std::move(_value)) { check(value_); }
 
-  Validator(const T& _value) : value_(V::validate(_value).value()) {}
+  Validator(const T& _value) : value_(_value) { check(value_); }
 
   template <class U, typename std::enable_if<std::is_convertible_v<U, T>,
                                              bool>::type = true>
-  Validator(U&& _value)
-      : value_(V::validate(T(std::forward<U>(_value))).value()) {}
+  Validator(U&& _value) : value_(T(std::forward<U>(_value))) {
+    check(value_);
+  }
 
   template <class U, typename std::enable_if<std::is_convertible_v<U, T>,
                                              bool>::type = true>
-  Validator(const U& _value) : value_(V::validate(T(_value)).value()) {}
+  Validator(const U& _value) : value_(T(_value)) {
+    check(value_);
+  }
 
   ~Validator() = default;
 
   /// Assigns the underlying object.
   auto& operator=(const T& _value) {
-    value_ = V::validate(_value).value();
+    check(_value);
+    value_ = _value;
     return *this;
   }
 
   /// Assigns the underlying object.
   auto& operator=(T&& _value) {
-    value_ = V::validate(std::forward<T>(_value)).value();
+    check(_value);
+    value_ = std::move(_value);
     return *this;
   }
 
@@ -71,17 +121,15 @@ struct Validator {
   /// Assigns the underlying object.
   template <class U, typename std::enable_if<std::is_convertible_v<U, T>,
                                              bool>::type = true>
-  auto& operator=(U&& _value) noexcept {
-    value_ = V::validate(T(std::forward<U>(_value))).value();
-    return *this;
+  auto& operator=(U&& _value) {
+    return *this = T(std::forward<U>(_value));
   }
 
   /// Assigns the underlying object.
   template <class U, typename std::enable_if<std::is_convertible_v<U, T>,
                                              bool>::type = true>
   auto& operator=(const U& _value) {
-    value_ = V::validate(T(_value)).value();
-    return *this;
+    return *this = T(_value);
   }
 
   /// Exposes the underlying value.
@@ -93,6 +141,17 @@ struct Validator {
   /// Necessary for the serialization to work.
   const T& reflection() const { return value_; }
 
+ private:
+  /// Signifies that the value has already been checked.
+  struct Checked {};
+
+  Validator(T&& _value, Checked) : value_(std::move(_value)) {}
+
+  /// Throws, if _value does not pass the validation.
+  static void check(const T& _value) {
+    internal::check_value<V>(_value).value();
+  }
+
  private:
   /// The underlying value.
   T value_;
@@ -0,0 +1,14 @@
+#ifndef RFL_BIN_HPP_
+#define RFL_BIN_HPP_
+
+#include "rfl/bin/Parser.hpp"
+#include "rfl/bin/Reader.hpp"
+#include "rfl/bin/Writer.hpp"
+#include "rfl/bin/fingerprint.hpp"
+#include "rfl/bin/load.hpp"
+#include "rfl/bin/read.hpp"
+#include "rfl/bin/save.hpp"
+#include "rfl/bin/serializers.hpp"
+#include "rfl/bin/write.hpp"
+
+#endif
@@ -0,0 +1,257 @@
+#ifndef RFL_BIN_DOCUMENT_HPP_
+#define RFL_BIN_DOCUMENT_HPP_
+
+#include <bit>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include "rfl/Result.hpp"
+#include "rfl/bin/encode.hpp"
+
+namespace rfl {
+namespace bin {
+
+/// A node in the decoded document. The nodes are stored in a flat vector in
+/// the order in which they appear in the input: The children of an array or
+/// map directly follow the node itself (for maps, keys and values alternate)
+/// and next_ points to the first node after the entire subtree.
+struct Node {
+  enum class Type : std::uint8_t {
+    nil,
+    boolean,
+    int64,
+    uint64,
+    float64,
+    str,
+    array,
+    map
+  };
+
+  Type type_;
+
+  /// The number of elements for arrays and maps, the number of bytes for
+  /// strings.
+  std::uint32_t size_;
+
+  /// The index of the next sibling.
+  std::uint32_t next_;
+
+  union {
+    bool bool_;
+    std::int64_t int_;
+    std::uint64_t uint_;
+    double double_;
+    const char* data_;
+  };
+};
+
+/// Decodes the entire buffer in a single pass. The document does not own the
+/// buffer, so the buffer must outlive the document. The header is not part of
+/// the document.
+class Document {
+ public:
+  using NodeType = Node;
+
+  /// Documents more deeply nested than this are rejected, so that malicious
+  /// input cannot overflow the stack.
+  static constexpr size_t max_depth_ = 1024;
+
+  static Result<Document> parse(const unsigned char* _bytes,
+                                const size_t _size) noexcept {
+    auto doc = Document(_bytes, _size);
+    if (!doc.parse_value(0)) {
+      return Error(doc.error_);
+    }
+    if (doc.pos_ != doc.end_) {
+      return Error("Found " + std::to_string(doc.end_ - doc.pos_) +
+                   " unexpected bytes after the end of the document.");
+    }
+    return doc;
+  }
+
+  /// Returns the node at position _ix.
+  const Node& node(const size_t _ix) const noexcept { return nodes_[_ix]; }
+
+  /// The root node is always at position 0.
+  static constexpr size_t root() noexcept { return 0; }
+
+ private:
+  Document(const unsigned char* _bytes, const size_t _size)
+      : pos_(_bytes), end_(_bytes + _size) {
+    // A node is much larger than the smallest value it can represent, so
+    // reserving for the densest possible input would take up several times
+    // the size of the input. We reserve at most 1.5 times the input instead
+    // and let the vector grow geometrically, if there are more nodes.
+    nodes_.reserve(_size / 16 + 1);
+  }
+
+  bool parse_value(const size_t _depth) noexcept {
+    if (_depth > max_depth_) {
+      error_ = "Maximum nesting depth of " + std::to_string(max_depth_) +
+               " exceeded.";
+      return false;
+    }
+    if (pos_ == end_) {
+      error_ = "Unexpected end of input.";
+      return false;
+    }
+    const auto ix = nodes_.size();
+    nodes_.emplace_back();
+    nodes_[ix].size_ = 0;
+    if (!parse_value_at(ix, _depth)) {
+      return false;
+    }
+    nodes_[ix].next_ = static_cast<std::uint32_t>(nodes_.size());
+    return true;
+  }
+
+  bool parse_value_at(const size_t _ix, const size_t _depth) noexcept {
+    const unsigned char byte = *(pos_++);
+    const auto marker = static_cast<Marker>(byte >> 4);
+    std::uint64_t n = byte & 0x0f;
+    if (n == max_inline) {
+      std::uint64_t remainder = 0;
+      if (!read_varint(&remainder)) {
+        return false;
+      }
+      n += remainder;
+    }
+
+    auto* node = &nodes_[_ix];
+
+    switch (marker) {
+      case Marker::nil:
+        node->type_ = Node::Type::nil;
+        return true;
+
+      case Marker::boolean_false:
+      case Marker::boolean_true:
+        node->type_ = Node::Type::boolean;
+        node->bool_ = (marker == Marker::boolean_true);
+        return true;
+
+      case Marker::uint:
+        node->type_ = Node::Type::uint64;
+        node->uint_ = n;
+        return true;
+
+      case Marker::negative_int:
+        node->type_ = Node::Type::int64;
+        node->int_ = static_cast<std::int64_t>(~n);
+        return true;
+
+      case Marker::float32: {
+        std::uint32_t u = 0;
+        if (!read_little_endian(&u)) {
+          return false;
+        }
+        node->type_ = Node::Type::float64;
+        node->double_ = static_cast<double>(std::bit_cast<float>(u));
+        return true;
+      }
+
+      case Marker::float64: {
+        std::uint64_t u = 0;
+        if (!read_little_endian(&u)) {
+          return false;
+        }
+        node->type_ = Node::Type::float64;
+        node->double_ = std::bit_cast<double>(u);
+        return true;
+      }
+
+      case Marker::str:
+        if (n > static_cast<size_t>(end_ - pos_)) {
+          error_ = "Unexpected end of input.";
+          return false;
+        }
+        node->type_ = Node::Type::str;
+        node->size_ = static_cast<std::uint32_t>(n);
+        node->data_ = reinterpret_cast<const char*>(pos_);
+        pos_ += n;
+        return true;
+
+      case Marker::array:
+        return parse_children(_ix, Node::Type::array, n, _depth);
+
+      case Marker::map:
+        return parse_children(_ix, Node::Type::map, n, _depth);
+
+      default:
+        error_ = "Unknown type marker " + std::to_string(byte) + ".";
+        return false;
+    }
+  }
+
+  bool parse_children(const size_t _ix, const Node::Type _type,
+                      const std::uint64_t _size, const size_t _depth) noexcept {
+    // Every child takes up at least one byte, so this rejects bogus sizes
+    // before we try to parse them.
+    const auto remaining = static_cast<std::uint64_t>(end_ - pos_);
+    const auto num_children = _type == Node::Type::map ? 2 * _size : _size;
+    if (_size > remaining || num_children > remaining) {
+      error_ = "Unexpected end of input.";
+      return false;
+    }
+    nodes_[_ix].type_ = _type;
+    nodes_[_ix].size_ = static_cast<std::uint32_t>(_size);
+    for (size_t i = 0; i < num_children; ++i) {
+      if (!parse_value(_depth + 1)) {
+        return false;
+      }
+    }
+    return true;
+  }
+
+  bool read_varint(std::uint64_t* _val) noexcept {
+    std::uint64_t val = 0;
+    for (int shift = 0; shift < 64; shift += 7) {
+      if (pos_ == end_) {
+        error_ = "Unexpected end of input.";
+        return false;
+      }
+      const unsigned char byte = *(pos_++);
+      val |= static_cast<std::uint64_t>(byte & 0x7f) << shift;
+      if ((byte & 0x80) == 0) {
+        *_val = val;
+        return true;
+      }
+    }
+    error_ = "Varint is too long.";
+    return false;
+  }
+
+  /// Reads an unsigned little-endian integer of type T.
+  template <class T>
+  bool read_little_endian(T* _val) noexcept {
+    if (static_cast<size_t>(end_ - pos_) < sizeof(T)) {
+      error_ = "Unexpected end of input.";
+      return false;
+    }
+    T val = 0;
+    for (size_t i = 0; i < sizeof(T); ++i) {
+      val |= static_cast<T>(static_cast<T>(pos_[i]) << (8 * i));
+    }
+    pos_ += sizeof(T);
+    *_val = val;
+    return true;
+  }
+
+  /// The current position in the input.
+  const unsigned char* pos_;
+
+  /// The end of the input.
+  const unsigned char* end_;
+
+  /// The error message, if parsing failed.
+  std::string error_;
+
+  /// The decoded nodes.
+  std::vector<Node> nodes_;
+};
+
+}  // namespace bin
+}  // namespace rfl
+
+#endif
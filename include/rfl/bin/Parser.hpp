@@ -0,0 +1,17 @@
+#ifndef RFL_BIN_PARSER_HPP_
+#define RFL_BIN_PARSER_HPP_
+
+#include "rfl/bin/Reader.hpp"
+#include "rfl/bin/Writer.hpp"
+#include "rfl/parsing/Parser.hpp"
+
+namespace rfl {
+namespace bin {
+
+template <class T>
+using Parser = parsing::Parser<Reader, Writer, T>;
+
+}
+}  // namespace rfl
+
+#endif
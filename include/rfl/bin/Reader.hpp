@@ -0,0 +1,50 @@
+#ifndef RFL_BIN_READER_HPP_
+#define RFL_BIN_READER_HPP_
+
+#include <exception>
+#include <type_traits>
+
+#include "rfl/Result.hpp"
+#include "rfl/bin/Document.hpp"
+#include "rfl/parsing/NodeReader.hpp"
+
+namespace rfl {
+namespace bin {
+
+struct Reader : public parsing::NodeReader<Document> {
+  /// Fields are identified by their position, not their name.
+  static constexpr bool positional = true;
+
+  template <class T, class = void>
+  struct has_from_bin : std::false_type {};
+
+  template <class T>
+  struct has_from_bin<
+      T, std::enable_if_t<std::is_invocable_r<T, decltype(T::from_bin),
+                                              InputVarType>::value>>
+      : std::true_type {};
+
+  template <class T>
+  struct has_from_bin<
+      T, std::enable_if_t<std::is_invocable_r<
+             rfl::Result<T>, decltype(T::from_bin), InputVarType>::value>>
+      : std::true_type {};
+
+  template <class T>
+  static constexpr bool has_custom_constructor = has_from_bin<T>::value;
+
+  template <class T>
+  rfl::Result<T> use_custom_constructor(
+      const InputVarType& _var) const noexcept {
+    try {
+      return T::from_bin(_var);
+    } catch (std::exception& e) {
+      return rfl::Error(e.what());
+    }
+  }
+};
+
+}  // namespace bin
+}  // namespace rfl
+
+#endif
@@ -0,0 +1,21 @@
+#ifndef RFL_BIN_WRITER_HPP_
+#define RFL_BIN_WRITER_HPP_
+
+#include "rfl/bin/encode.hpp"
+#include "rfl/parsing/BufferWriter.hpp"
+
+namespace rfl {
+namespace bin {
+
+/// Writes the binary format into a single buffer. See parsing::BufferWriter.
+struct Writer : public parsing::BufferWriter<Encoder> {
+  /// Fields are identified by their position, not their name.
+  static constexpr bool positional = true;
+
+  using parsing::BufferWriter<Encoder>::BufferWriter;
+};
+
+}  // namespace bin
+}  // namespace rfl
+
+#endif
@@ -0,0 +1,176 @@
+#ifndef RFL_BIN_ENCODE_HPP_
+#define RFL_BIN_ENCODE_HPP_
+
+#include <bit>
+#include <cstdint>
+#include <iterator>
+#include <string_view>
+#include <type_traits>
+#include <vector>
+
+namespace rfl {
+namespace bin {
+
+/// The type of every value is stored in the upper four bits of its first
+/// byte. For integers, strings, arrays and maps the lower four bits contain
+/// the value, length or number of elements, if it is smaller than 15.
+/// Otherwise, they are set to 15 and the remainder is written as a varint.
+enum class Marker : std::uint8_t {
+  nil = 0,
+  boolean_false = 1,
+  boolean_true = 2,
+  uint = 3,
+  negative_int = 4,
+  float32 = 5,
+  float64 = 6,
+  str = 7,
+  array = 8,
+  map = 9
+};
+
+/// Every document starts with these two bytes, followed by the fingerprint.
+inline constexpr unsigned char magic[2] = {'R', 'B'};
+
+/// The size of the header in bytes.
+inline constexpr size_t header_size = sizeof(magic) + sizeof(std::uint64_t);
+
+/// Values smaller than this are stored directly in the marker.
+inline constexpr std::uint64_t max_inline = 15;
+
+/// Appends _val to _bytes using seven bits per byte, least significant group
+/// first. The highest bit signals that more bytes follow.
+inline void encode_varint(std::uint64_t _val,
+                          std::vector<unsigned char>* _bytes) {
+  while (_val >= 0x80) {
+    _bytes->push_back(static_cast<unsigned char>(_val | 0x80));
+    _val >>= 7;
+  }
+  _bytes->push_back(static_cast<unsigned char>(_val));
+}
+
+/// Appends _val to _bytes in little-endian byte order.
+template <class T>
+inline void encode_little_endian(const T _val,
+                                 std::vector<unsigned char>* _bytes) {
+  static_assert(std::is_unsigned_v<T>, "T must be unsigned.");
+  for (size_t i = 0; i < sizeof(T); ++i) {
+    _bytes->push_back(static_cast<unsigned char>(_val >> (8 * i)));
+  }
+}
+
+inline void encode_marker(const Marker _marker, const std::uint64_t _n,
+                          std::vector<unsigned char>* _bytes) {
+  const auto upper = static_cast<unsigned char>(_marker) << 4;
+  if (_n < max_inline) {
+    _bytes->push_back(static_cast<unsigned char>(upper | _n));
+  } else {
+    _bytes->push_back(static_cast<unsigned char>(upper | max_inline));
+    encode_varint(_n - max_inline, _bytes);
+  }
+}
+
+inline void encode_nil(std::vector<unsigned char>* _bytes) {
+  encode_marker(Marker::nil, 0, _bytes);
+}
+
+inline void encode_bool(const bool _b, std::vector<unsigned char>* _bytes) {
+  encode_marker(_b ? Marker::boolean_true : Marker::boolean_false, 0, _bytes);
+}
+
+inline void encode_uint(const std::uint64_t _u,
+                        std::vector<unsigned char>* _bytes) {
+  encode_marker(Marker::uint, _u, _bytes);
+}
+
+/// Negative integers are stored as -(_i + 1), so small absolute values
+/// remain small.
+inline void encode_int(const std::int64_t _i,
+                       std::vector<unsigned char>* _bytes) {
+  if (_i >= 0) {
+    encode_uint(static_cast<std::uint64_t>(_i), _bytes);
+  } else {
+    encode_marker(Marker::negative_int, ~static_cast<std::uint64_t>(_i),
+                  _bytes);
+  }
+}
+
+inline void encode_float(const float _f, std::vector<unsigned char>* _bytes) {
+  encode_marker(Marker::float32, 0, _bytes);
+  encode_little_endian(std::bit_cast<std::uint32_t>(_f), _bytes);
+}
+
+inline void encode_double(const double _d,
+                          std::vector<unsigned char>* _bytes) {
+  encode_marker(Marker::float64, 0, _bytes);
+  encode_little_endian(std::bit_cast<std::uint64_t>(_d), _bytes);
+}
+
+inline void encode_str(const std::string_view& _str,
+                       std::vector<unsigned char>* _bytes) {
+  encode_marker(Marker::str, _str.size(), _bytes);
+  _bytes->insert(_bytes->end(), _str.begin(), _str.end());
+}
+
+inline void encode_array_header(const size_t _size,
+                                std::vector<unsigned char>* _bytes) {
+  encode_marker(Marker::array, _size, _bytes);
+}
+
+inline void encode_map_header(const size_t _size,
+                              std::vector<unsigned char>* _bytes) {
+  encode_marker(Marker::map, _size, _bytes);
+}
+
+inline void encode_header(const std::uint64_t _fingerprint,
+                          std::vector<unsigned char>* _bytes) {
+  _bytes->insert(_bytes->end(), std::begin(magic), std::end(magic));
+  encode_little_endian(_fingerprint, _bytes);
+}
+
+/// Bundles the functions above, so they can be passed to
+/// parsing::BufferWriter.
+struct Encoder {
+  static void nil(std::vector<unsigned char>* _bytes) { encode_nil(_bytes); }
+
+  static void boolean(const bool _b, std::vector<unsigned char>* _bytes) {
+    encode_bool(_b, _bytes);
+  }
+
+  static void uint64(const std::uint64_t _u,
+                     std::vector<unsigned char>* _bytes) {
+    encode_uint(_u, _bytes);
+  }
+
+  static void int64(const std::int64_t _i,
+                    std::vector<unsigned char>* _bytes) {
+    encode_int(_i, _bytes);
+  }
+
+  static void float32(const float _f, std::vector<unsigned char>* _bytes) {
+    encode_float(_f, _bytes);
+  }
+
+  static void float64(const double _d, std::vector<unsigned char>* _bytes) {
+    encode_double(_d, _bytes);
+  }
+
+  static void str(const std::string_view& _str,
+                  std::vector<unsigned char>* _bytes) {
+    encode_str(_str, _bytes);
+  }
+
+  static void array_header(const size_t _size,
+                           std::vector<unsigned char>* _bytes) {
+    encode_array_header(_size, _bytes);
+  }
+
+  static void map_header(const size_t _size,
+                         std::vector<unsigned char>* _bytes) {
+    encode_map_header(_size, _bytes);
+  }
+};
+
+}  // namespace bin
+}  // namespace rfl
+
+#endif
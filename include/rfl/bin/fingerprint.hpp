@@ -0,0 +1,289 @@
+#ifndef RFL_BIN_FINGERPRINT_HPP_
+#define RFL_BIN_FINGERPRINT_HPP_
+
+#include <cstddef>
+#include <cstdint>
+#include <map>
+#include <memory>
+#include <memory_resource>
+#include <optional>
+#include <ranges>
+#include <string>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+#include <variant>
+
+#include "rfl/Box.hpp"
+#include "rfl/Field.hpp"
+#include "rfl/Literal.hpp"
+#include "rfl/NamedTuple.hpp"
+#include "rfl/ObjectMap.hpp"
+#include "rfl/Ref.hpp"
+#include "rfl/Result.hpp"
+#include "rfl/TaggedUnion.hpp"
+#include "rfl/Variant.hpp"
+#include "rfl/always_false.hpp"
+#include "rfl/bin/Reader.hpp"
+#include "rfl/bin/Writer.hpp"
+#include "rfl/internal/StringLiteral.hpp"
+#include "rfl/internal/has_fields.hpp"
+#include "rfl/internal/has_reflection_type_v.hpp"
+#include "rfl/internal/hash_combine.hpp"
+#include "rfl/internal/tuple_t.hpp"
+#include "rfl/named_tuple_t.hpp"
+#include "rfl/parsing/CustomParser.hpp"
+#include "rfl/parsing/Parser.hpp"
+#include "rfl/parsing/is_map_like.hpp"
+
+namespace rfl {
+namespace bin {
+
+/// The types that are currently being fingerprinted. Used to detect
+/// recursive types.
+template <class... Ts>
+struct TypeList {};
+
+/// Calculates a hash over the structure of T at compile time: The names and
+/// types of all fields, the alternatives of all variants and so on. Since the
+/// binary format does not contain any field names, the fingerprint is written
+/// into the header and used to reject data that was written for a different
+/// type.
+template <class T, class VisitedTypes>
+struct Fingerprint;
+
+/// Returns the fingerprint of T.
+template <class T>
+constexpr std::uint64_t fingerprint() noexcept {
+  return Fingerprint<std::remove_cvref_t<T>, TypeList<>>::value;
+}
+
+namespace fingerprint_internal {
+
+/// FNV-1a, which is simple enough to be evaluated at compile time.
+constexpr std::uint64_t hash_str(const char* _str, const size_t _size) {
+  std::uint64_t h = 14695981039346656037ULL;
+  for (size_t i = 0; i < _size; ++i) {
+    h ^= static_cast<unsigned char>(_str[i]);
+    h *= 1099511628211ULL;
+  }
+  return h;
+}
+
+template <size_t N>
+constexpr std::uint64_t hash_str(const char (&_str)[N]) {
+  return hash_str(_str, N - 1);
+}
+
+template <size_t N>
+constexpr std::uint64_t hash_str(const internal::StringLiteral<N>& _str) {
+  return hash_str(_str.value_, N - 1);
+}
+
+/// Combines the hashes - the order matters.
+template <class... Hashes>
+constexpr std::uint64_t combine(const std::uint64_t _seed,
+                                const Hashes... _hashes) {
+  auto h = _seed;
+  ((h = internal::hash_mix(h + 0x9e3779b97f4a7c15ULL +
+                           static_cast<std::uint64_t>(_hashes))),
+   ...);
+  return h;
+}
+
+/// The position of T in Ts or sizeof...(Ts), if T is not contained in Ts.
+template <class T, class... Ts>
+constexpr size_t index_of() {
+  constexpr bool is_same[] = {std::is_same_v<T, Ts>..., false};
+  size_t i = 0;
+  while (i < sizeof...(Ts) && !is_same[i]) {
+    ++i;
+  }
+  return i;
+}
+
+/// Deduces the helper struct of a parser derived from parsing::CustomParser.
+template <class ReaderType, class WriterType, class OriginalClass,
+          class HelperStruct>
+HelperStruct custom_parser_helper(
+    const parsing::CustomParser<ReaderType, WriterType, OriginalClass,
+                                HelperStruct>*);
+
+template <class T>
+using custom_parser_helper_t = decltype(custom_parser_helper(
+    static_cast<const parsing::Parser<Reader, Writer, T>*>(nullptr)));
+
+template <class T>
+concept has_custom_parser = requires { typename custom_parser_helper_t<T>; };
+
+template <class T, class... VisitedTypes>
+constexpr std::uint64_t fingerprint_of() {
+  return Fingerprint<std::remove_cvref_t<T>, TypeList<VisitedTypes...>>::value;
+}
+
+}  // namespace fingerprint_internal
+
+/// Default case - basic types, structs and containers.
+template <class T, class... VisitedTypes>
+struct Fingerprint<T, TypeList<VisitedTypes...>> {
+ private:
+  static constexpr std::uint64_t calc() {
+    using namespace fingerprint_internal;
+    constexpr auto ix = index_of<T, VisitedTypes...>();
+    if constexpr (std::is_same<T, bool>()) {
+      return hash_str("bool");
+    } else if constexpr (std::is_integral_v<T>) {
+      return combine(std::is_signed_v<T> ? hash_str("int") : hash_str("uint"),
+                     sizeof(T));
+    } else if constexpr (std::is_floating_point_v<T>) {
+      return combine(hash_str("float"), sizeof(T));
+    } else if constexpr (std::is_same<T, std::string>() ||
+                         std::is_same<T, std::pmr::string>()) {
+      return hash_str("string");
+    } else if constexpr (ix != sizeof...(VisitedTypes)) {
+      // A recursive type refers back to one of the enclosing types.
+      return combine(hash_str("recursive"), ix);
+    } else if constexpr (internal::has_reflection_type_v<T>) {
+      return fingerprint_of<typename T::ReflectionType, VisitedTypes...>();
+    } else if constexpr (parsing::is_map_like<T>::value) {
+      using KeyType = typename T::key_type;
+      using MappedType = typename T::mapped_type;
+      return combine(hash_str("map"),
+                     fingerprint_of<KeyType, VisitedTypes...>(),
+                     fingerprint_of<MappedType, VisitedTypes...>());
+    } else if constexpr (std::ranges::range<T>) {
+      return combine(
+          hash_str("array"),
+          fingerprint_of<std::ranges::range_value_t<T>, VisitedTypes...>());
+    } else if constexpr (std::is_class_v<T> && std::is_aggregate_v<T>) {
+      if constexpr (internal::has_fields<T>()) {
+        return fingerprint_of<named_tuple_t<T>, VisitedTypes..., T>();
+      } else {
+        return fingerprint_of<internal::tuple_t<T>, VisitedTypes..., T>();
+      }
+    } else if constexpr (has_custom_parser<T>) {
+      return fingerprint_of<custom_parser_helper_t<T>, VisitedTypes...>();
+    } else {
+      static_assert(always_false_v<T>,
+                    "Unsupported type. If you have written a custom parser "
+                    "for T, please specialize rfl::bin::Fingerprint as "
+                    "well.");
+      return 0;
+    }
+  }
+
+ public:
+  static constexpr std::uint64_t value = calc();
+};
+
+template <class T, class... VisitedTypes>
+struct Fingerprint<Box<T>, TypeList<VisitedTypes...>> {
+  static constexpr std::uint64_t value =
+      fingerprint_internal::fingerprint_of<T, VisitedTypes...>();
+};
+
+template <internal::StringLiteral _name, class T, class... VisitedTypes>
+struct Fingerprint<Field<_name, T>, TypeList<VisitedTypes...>> {
+  static constexpr std::uint64_t value = fingerprint_internal::combine(
+      fingerprint_internal::hash_str(_name),
+      fingerprint_internal::fingerprint_of<T, VisitedTypes...>());
+};
+
+template <internal::StringLiteral... _fields, class... VisitedTypes>
+struct Fingerprint<Literal<_fields...>, TypeList<VisitedTypes...>> {
+  static constexpr std::uint64_t value = fingerprint_internal::combine(
+      fingerprint_internal::hash_str("literal"),
+      fingerprint_internal::hash_str(_fields)...);
+};
+
+template <class... FieldTypes, class... VisitedTypes>
+struct Fingerprint<NamedTuple<FieldTypes...>, TypeList<VisitedTypes...>> {
+  static constexpr std::uint64_t value = fingerprint_internal::combine(
+      fingerprint_internal::hash_str("object"),
+      fingerprint_internal::fingerprint_of<FieldTypes, VisitedTypes...>()...);
+};
+
+template <class T, class... VisitedTypes>
+struct Fingerprint<ObjectMap<T>, TypeList<VisitedTypes...>> {
+  static constexpr std::uint64_t value = fingerprint_internal::combine(
+      fingerprint_internal::hash_str("object_map"),
+      fingerprint_internal::fingerprint_of<T, VisitedTypes...>());
+};
+
+template <class T, class... VisitedTypes>
+struct Fingerprint<std::optional<T>, TypeList<VisitedTypes...>> {
+  static constexpr std::uint64_t value = fingerprint_internal::combine(
+      fingerprint_internal::hash_str("optional"),
+      fingerprint_internal::fingerprint_of<T, VisitedTypes...>());
+};
+
+template <class T1, class T2, class... VisitedTypes>
+struct Fingerprint<std::pair<T1, T2>, TypeList<VisitedTypes...>> {
+  static constexpr std::uint64_t value =
+      fingerprint_internal::fingerprint_of<std::tuple<T1, T2>,
+                                           VisitedTypes...>();
+};
+
+template <class T, class... VisitedTypes>
+struct Fingerprint<Ref<T>, TypeList<VisitedTypes...>> {
+  static constexpr std::uint64_t value =
+      fingerprint_internal::fingerprint_of<T, VisitedTypes...>();
+};
+
+template <class T, class... VisitedTypes>
+struct Fingerprint<Result<T>, TypeList<VisitedTypes...>> {
+  static constexpr std::uint64_t value = fingerprint_internal::fingerprint_of<
+      std::variant<T, NamedTuple<Field<"error", std::string>>>,
+      VisitedTypes...>();
+};
+
+template <class T, class... VisitedTypes>
+struct Fingerprint<std::shared_ptr<T>, TypeList<VisitedTypes...>> {
+  static constexpr std::uint64_t value =
+      fingerprint_internal::fingerprint_of<std::optional<T>,
+                                           VisitedTypes...>();
+};
+
+template <internal::StringLiteral _discriminator, class... AlternativeTypes,
+          class... VisitedTypes>
+struct Fingerprint<TaggedUnion<_discriminator, AlternativeTypes...>,
+                   TypeList<VisitedTypes...>> {
+  static constexpr std::uint64_t value =
+      fingerprint_internal::fingerprint_of<std::variant<AlternativeTypes...>,
+                                           VisitedTypes...>();
+};
+
+template <class... Ts, class... VisitedTypes>
+struct Fingerprint<std::tuple<Ts...>, TypeList<VisitedTypes...>> {
+  static constexpr std::uint64_t value = fingerprint_internal::combine(
+      fingerprint_internal::hash_str("tuple"),
+      fingerprint_internal::fingerprint_of<Ts, VisitedTypes...>()...);
+};
+
+template <class T, class... VisitedTypes>
+struct Fingerprint<std::unique_ptr<T>, TypeList<VisitedTypes...>> {
+  static constexpr std::uint64_t value =
+      fingerprint_internal::fingerprint_of<std::optional<T>,
+                                           VisitedTypes...>();
+};
+
+template <class... AlternativeTypes, class... VisitedTypes>
+struct Fingerprint<Variant<AlternativeTypes...>, TypeList<VisitedTypes...>> {
+  static constexpr std::uint64_t value =
+      fingerprint_internal::fingerprint_of<std::variant<AlternativeTypes...>,
+                                           VisitedTypes...>();
+};
+
+template <class... AlternativeTypes, class... VisitedTypes>
+struct Fingerprint<std::variant<AlternativeTypes...>,
+                   TypeList<VisitedTypes...>> {
+  static constexpr std::uint64_t value = fingerprint_internal::combine(
+      fingerprint_internal::hash_str("variant"),
+      fingerprint_internal::fingerprint_of<AlternativeTypes,
+                                           VisitedTypes...>()...);
+};
+
+}  // namespace bin
+}  // namespace rfl
+
+#endif
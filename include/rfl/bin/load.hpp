@@ -0,0 +1,20 @@
+#ifndef RFL_BIN_LOAD_HPP_
+#define RFL_BIN_LOAD_HPP_
+
+#include "rfl/Result.hpp"
+#include "rfl/bin/read.hpp"
+#include "rfl/io/load_bytes.hpp"
+
+namespace rfl {
+namespace bin {
+
+template <class T>
+Result<T> load(const std::string& _fname) {
+  const auto read_bytes = [](const auto& _bytes) { return read<T>(_bytes); };
+  return rfl::io::load_bytes(_fname).and_then(read_bytes);
+}
+
+}  // namespace bin
+}  // namespace rfl
+
+#endif
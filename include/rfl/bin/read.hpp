@@ -0,0 +1,62 @@
+#ifndef RFL_BIN_READ_HPP_
+#define RFL_BIN_READ_HPP_
+
+#include <algorithm>
+#include <cstdint>
+#include <iterator>
+#include <string>
+#include <vector>
+
+#include "rfl/Result.hpp"
+#include "rfl/bin/Document.hpp"
+#include "rfl/bin/Parser.hpp"
+#include "rfl/bin/encode.hpp"
+#include "rfl/bin/fingerprint.hpp"
+
+namespace rfl {
+namespace bin {
+
+using InputVarType = typename Reader::InputVarType;
+
+/// Parses an object from a var. Vars do not have a header, so the
+/// fingerprint is not checked.
+template <class T>
+Result<T> read(const InputVarType& _obj) {
+  const auto r = Reader();
+  return Parser<T>::read(r, _obj);
+}
+
+/// Parses an object from the binary format using reflection. Returns an
+/// error, if the data was written for a different type.
+template <class T>
+Result<T> read(const unsigned char* _bytes, const size_t _size) {
+  if (_size < header_size ||
+      !std::equal(std::begin(magic), std::end(magic), _bytes)) {
+    return Error("Could not parse binary format: Header not found.");
+  }
+  std::uint64_t fp = 0;
+  for (size_t i = 0; i < sizeof(fp); ++i) {
+    fp |= static_cast<std::uint64_t>(_bytes[sizeof(magic) + i]) << (8 * i);
+  }
+  if (fp != fingerprint<T>()) {
+    return Error(
+        "Could not parse binary format: The fingerprint in the header does "
+        "not match the type. The data was written for a different schema.");
+  }
+  const auto read_root = [](const Document& _doc) {
+    return read<T>(InputVarType(&_doc, Document::root()));
+  };
+  return Document::parse(_bytes + header_size, _size - header_size)
+      .and_then(read_root);
+}
+
+/// Parses an object from the binary format using reflection.
+template <class T>
+Result<T> read(const std::vector<unsigned char>& _bytes) {
+  return read<T>(_bytes.data(), _bytes.size());
+}
+
+}  // namespace bin
+}  // namespace rfl
+
+#endif
@@ -0,0 +1,21 @@
+#ifndef RFL_BIN_SAVE_HPP_
+#define RFL_BIN_SAVE_HPP_
+
+#include <string>
+
+#include "rfl/Result.hpp"
+#include "rfl/bin/write.hpp"
+#include "rfl/io/save_bytes.hpp"
+
+namespace rfl {
+namespace bin {
+
+template <class T>
+Result<Nothing> save(const std::string& _fname, const T& _obj) {
+  return rfl::io::save_bytes(_fname, write(_obj));
+}
+
+}  // namespace bin
+}  // namespace rfl
+
+#endif
@@ -0,0 +1,29 @@
+#ifndef RFL_BIN_SERIALIZERS_HPP_
+#define RFL_BIN_SERIALIZERS_HPP_
+
+#include <cstddef>
+#include <vector>
+
+#include "rfl/bin/read.hpp"
+#include "rfl/bin/write.hpp"
+#include "rfl/serializers.hpp"
+
+/// The serializers for the binary format, for use by
+/// RFL_DECLARE_SERIALIZERS and RFL_DEFINE_SERIALIZERS.
+#define RFL_SERIALIZERS_bin(_extern, T)                                        \
+  _extern template rfl::Result<T> rfl::bin::read<T>(                           \
+      const rfl::bin::InputVarType&);                                          \
+  _extern template rfl::Result<T> rfl::bin::read<T>(                           \
+      const unsigned char*, const size_t);                                     \
+  _extern template rfl::Result<T> rfl::bin::read<T>(                           \
+      const std::vector<unsigned char>&);                                      \
+  _extern template std::vector<unsigned char> rfl::bin::write<T>(const T&);
+
+/// Ordinary overloads of write, see RFL_DECLARE_SERIALIZERS.
+#define RFL_SERIALIZER_OVERLOADS_bin(T, _body)                                 \
+  namespace rfl::bin {                                                         \
+  std::vector<unsigned char> write(const T& _obj)                              \
+      _body({ return write<T>(_obj); })                                        \
+  }
+
+#endif
@@ -0,0 +1,29 @@
+#ifndef RFL_BIN_WRITE_HPP_
+#define RFL_BIN_WRITE_HPP_
+
+#include <vector>
+
+#include "rfl/bin/Parser.hpp"
+#include "rfl/bin/encode.hpp"
+#include "rfl/bin/fingerprint.hpp"
+
+namespace rfl {
+namespace bin {
+
+/// Writes an object to the binary format. The result starts with a header
+/// containing the fingerprint of T.
+template <class T>
+std::vector<unsigned char> write(const T& _obj) {
+  auto buf = Writer::Buffer();
+  const auto w = Writer(&buf);
+  Parser<T>::write(w, _obj);
+  std::vector<unsigned char> bytes;
+  encode_header(fingerprint<T>(), &bytes);
+  buf.flush(&bytes);
+  return bytes;
+}
+
+}  // namespace bin
+}  // namespace rfl
+
+#endif
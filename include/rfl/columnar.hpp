@@ -0,0 +1,12 @@
+#ifndef RFL_COLUMNAR_HPP_
+#define RFL_COLUMNAR_HPP_
+
+#include "rfl/columnar/Header.hpp"
+#include "rfl/columnar/StringColumn.hpp"
+#include "rfl/columnar/Table.hpp"
+#include "rfl/columnar/load.hpp"
+#include "rfl/columnar/read.hpp"
+#include "rfl/columnar/save.hpp"
+#include "rfl/columnar/write.hpp"
+
+#endif
@@ -0,0 +1,70 @@
+#ifndef RFL_COLUMNAR_HEADER_HPP_
+#define RFL_COLUMNAR_HEADER_HPP_
+
+#include <cstdint>
+#include <string>
+#include <type_traits>
+
+namespace rfl {
+namespace columnar {
+
+/// The bytes "RFLCOL", followed by the version and a zero byte, when written
+/// on a little-endian machine. All integers in the file are written in the
+/// native byte order, so reading a file on a machine with a different byte
+/// order fails when the magic number is checked.
+inline constexpr std::uint64_t magic = 0x00014c4f434c4652ULL;
+
+/// Every column starts at a multiple of this, relative to the beginning of
+/// the file, so columns are aligned to cache lines whenever the file itself
+/// is (which is always true for memory-mapped files).
+inline constexpr size_t alignment = 64;
+
+/// The way a column is encoded.
+enum class Encoding : std::uint64_t {
+  /// Arithmetic types, except bool: The values are copied as they are.
+  raw = 1,
+
+  /// std::string: (number of rows + 1) offsets into the character data,
+  /// followed by the character data.
+  strings = 2,
+
+  /// Everything else: The column is written as an std::vector using rfl::bin.
+  bin = 3
+};
+
+/// Determines the encoding for a column containing values of type T.
+template <class T>
+constexpr Encoding encoding_of() {
+  if constexpr (std::is_arithmetic_v<T> && !std::is_same_v<T, bool>) {
+    return Encoding::raw;
+  } else if constexpr (std::is_same_v<T, std::string>) {
+    return Encoding::strings;
+  } else {
+    return Encoding::bin;
+  }
+}
+
+/// The beginning of every file.
+struct Header {
+  std::uint64_t magic_;
+  std::uint64_t fingerprint_;
+  std::uint64_t num_rows_;
+  std::uint64_t num_columns_;
+};
+
+/// The header is followed by one of these for every column, in the order
+/// in which the fields are declared.
+struct ColumnInfo {
+  Encoding encoding_;
+
+  /// The position of the column relative to the beginning of the file.
+  std::uint64_t offset_;
+
+  /// The size of the column in bytes.
+  std::uint64_t size_;
+};
+
+}  // namespace columnar
+}  // namespace rfl
+
+#endif
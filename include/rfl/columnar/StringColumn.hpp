@@ -0,0 +1,74 @@
+#ifndef RFL_COLUMNAR_STRINGCOLUMN_HPP_
+#define RFL_COLUMNAR_STRINGCOLUMN_HPP_
+
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+#include <string_view>
+
+namespace rfl {
+namespace columnar {
+
+/// A view into a column of strings. Does not own the underlying buffer.
+class StringColumn {
+ public:
+  struct Iterator {
+    using difference_type = std::ptrdiff_t;
+    using value_type = std::string_view;
+
+    std::string_view operator*() const noexcept { return (*col_)[ix_]; }
+
+    Iterator& operator++() noexcept {
+      ++ix_;
+      return *this;
+    }
+
+    Iterator operator++(int) noexcept {
+      auto it = *this;
+      ++ix_;
+      return it;
+    }
+
+    bool operator==(const Iterator& _other) const noexcept {
+      return ix_ == _other.ix_;
+    }
+
+    const StringColumn* col_;
+    size_t ix_;
+  };
+
+  /// _offsets must contain _size + 1 elements, the i-th string starts at
+  /// _offsets[i] and ends at _offsets[i + 1].
+  StringColumn(const std::uint64_t* _offsets, const char* _chars,
+               const size_t _size)
+      : chars_(_chars), offsets_(_offsets), size_(_size) {}
+
+  ~StringColumn() = default;
+
+  std::string_view operator[](const size_t _i) const noexcept {
+    return std::string_view(chars_ + offsets_[_i],
+                            offsets_[_i + 1] - offsets_[_i]);
+  }
+
+  Iterator begin() const noexcept { return Iterator{this, 0}; }
+
+  Iterator end() const noexcept { return Iterator{this, size_}; }
+
+  /// The number of strings in the column.
+  size_t size() const noexcept { return size_; }
+
+ private:
+  /// The character data.
+  const char* chars_;
+
+  /// The offsets of the strings in the character data.
+  const std::uint64_t* offsets_;
+
+  /// The number of strings in the column.
+  size_t size_;
+};
+
+}  // namespace columnar
+}  // namespace rfl
+
+#endif
@@ -0,0 +1,229 @@
+#ifndef RFL_COLUMNAR_TABLE_HPP_
+#define RFL_COLUMNAR_TABLE_HPP_
+
+#include <array>
+#include <cstdint>
+#include <cstring>
+#include <span>
+#include <string>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "rfl/Result.hpp"
+#include "rfl/bin/fingerprint.hpp"
+#include "rfl/bin/read.hpp"
+#include "rfl/columnar/Header.hpp"
+#include "rfl/columnar/StringColumn.hpp"
+#include "rfl/columns_t.hpp"
+#include "rfl/from_columns.hpp"
+#include "rfl/internal/StringLiteral.hpp"
+#include "rfl/internal/find_index.hpp"
+#include "rfl/named_tuple_t.hpp"
+
+namespace rfl {
+namespace columnar {
+
+/// The type returned when retrieving a column containing values of type T:
+/// Arithmetic types and strings are returned as views into the underlying
+/// buffer, everything else has to be decoded.
+template <class T>
+using column_view_t = std::conditional_t<
+    encoding_of<T>() == Encoding::raw, std::span<const T>,
+    std::conditional_t<encoding_of<T>() == Encoding::strings, StringColumn,
+                       std::vector<T>>>;
+
+/// A view into a buffer containing a vector of T in the columnar format, for
+/// instance a memory-mapped file. Only the header is checked when the table
+/// is created, so retrieving a column only touches the bytes that belong to
+/// that column. The buffer must outlive the table.
+template <class T>
+class Table {
+  using Fields = typename named_tuple_t<T>::Fields;
+
+  static constexpr size_t num_columns_ = std::tuple_size_v<Fields>;
+
+ public:
+  /// Creates the table from a buffer. The buffer should be aligned to
+  /// at least 8 bytes, otherwise arithmetic columns cannot be accessed.
+  static Result<Table<T>> from_bytes(const unsigned char* _data,
+                                     const size_t _size) noexcept {
+    auto header = Header{};
+    auto columns = std::array<ColumnInfo, num_columns_>();
+    const auto columns_size = sizeof(ColumnInfo) * num_columns_;
+    if (_size < sizeof(Header) + columns_size) {
+      return Error("Could not read columnar format: Header not found.");
+    }
+    std::memcpy(&header, _data, sizeof(Header));
+    if (header.magic_ != magic) {
+      return Error(
+          "Could not read columnar format: Unknown magic number. Either this "
+          "is not a columnar file or it was written on a machine with a "
+          "different byte order.");
+    }
+    if (header.fingerprint_ != bin::fingerprint<T>() ||
+        header.num_columns_ != num_columns_) {
+      return Error(
+          "Could not read columnar format: The fingerprint in the header does "
+          "not match the type. The data was written for a different schema.");
+    }
+    std::memcpy(columns.data(), _data + sizeof(Header), columns_size);
+    return check_columns(columns, _size).transform([&](const auto&) {
+      return Table<T>(_data, header.num_rows_, columns);
+    });
+  }
+
+  ~Table() = default;
+
+  /// Retrieves the column belonging to the field _name.
+  template <internal::StringLiteral _name>
+  auto column() const noexcept {
+    constexpr auto ix = internal::find_index<_name, Fields>();
+    return column_at<ix>();
+  }
+
+  /// The number of rows.
+  size_t size() const noexcept { return num_rows_; }
+
+  /// Decodes the entire table.
+  Result<std::vector<T>> to_vector() const noexcept {
+    return to_columns(std::make_index_sequence<num_columns_>())
+        .and_then([](auto&& _columns) {
+          return from_columns<T>(std::move(_columns));
+        });
+  }
+
+ private:
+  Table(const unsigned char* _data, const size_t _num_rows,
+        const std::array<ColumnInfo, num_columns_>& _columns)
+      : columns_(_columns), data_(_data), num_rows_(_num_rows) {}
+
+  /// Makes sure that all columns are within the buffer and use the encoding
+  /// we expect.
+  template <size_t _i = 0>
+  static Result<Nothing> check_columns(
+      const std::array<ColumnInfo, num_columns_>& _columns,
+      const size_t _size) noexcept {
+    if constexpr (_i == num_columns_) {
+      return Nothing{};
+    } else {
+      using FieldType = std::tuple_element_t<_i, Fields>;
+      using ValueType = typename FieldType::Type;
+      const auto& col = _columns[_i];
+      if (col.encoding_ != encoding_of<ValueType>()) {
+        return Error("Could not read columnar format: Column '" +
+                     FieldType::name_.str() + "' has an unexpected encoding.");
+      }
+      if (col.offset_ > _size || col.size_ > _size - col.offset_) {
+        return Error("Could not read columnar format: Column '" +
+                     FieldType::name_.str() + "' exceeds the buffer.");
+      }
+      return check_columns<_i + 1>(_columns, _size);
+    }
+  }
+
+  template <size_t _i>
+  auto column_at() const noexcept {
+    using FieldType = std::tuple_element_t<_i, Fields>;
+    using ValueType = typename FieldType::Type;
+    using ResultType = Result<column_view_t<ValueType>>;
+
+    const auto& col = columns_[_i];
+    const auto begin = data_ + col.offset_;
+    const auto embellish_error = [](const Error& _e) -> ResultType {
+      return Error("Could not read column '" + FieldType::name_.str() +
+                   "': " + _e.what());
+    };
+
+    if constexpr (encoding_of<ValueType>() == Encoding::raw) {
+      if (col.size_ % sizeof(ValueType) != 0 ||
+          col.size_ / sizeof(ValueType) != num_rows_) {
+        return embellish_error(Error("Unexpected size."));
+      }
+      if (reinterpret_cast<std::uintptr_t>(begin) % alignof(ValueType) != 0) {
+        return embellish_error(Error("The buffer is not properly aligned."));
+      }
+      return ResultType(std::span<const ValueType>(
+          reinterpret_cast<const ValueType*>(begin), num_rows_));
+
+    } else if constexpr (encoding_of<ValueType>() == Encoding::strings) {
+      if (num_rows_ >= col.size_ / sizeof(std::uint64_t)) {
+        return embellish_error(Error("Unexpected size."));
+      }
+      const auto offsets_size = (num_rows_ + 1) * sizeof(std::uint64_t);
+      if (reinterpret_cast<std::uintptr_t>(begin) % alignof(std::uint64_t) !=
+          0) {
+        return embellish_error(Error("The buffer is not properly aligned."));
+      }
+      const auto offsets = reinterpret_cast<const std::uint64_t*>(begin);
+      const auto chars_size = col.size_ - offsets_size;
+      if (offsets[0] != 0 || offsets[num_rows_] > chars_size) {
+        return embellish_error(Error("Invalid offsets."));
+      }
+      for (size_t i = 0; i < num_rows_; ++i) {
+        if (offsets[i] > offsets[i + 1]) {
+          return embellish_error(Error("Invalid offsets."));
+        }
+      }
+      return ResultType(StringColumn(
+          offsets, reinterpret_cast<const char*>(begin + offsets_size),
+          num_rows_));
+
+    } else {
+      const auto check_size =
+          [this](std::vector<ValueType>&& _vec) -> ResultType {
+        if (_vec.size() != num_rows_) {
+          return Error("Expected " + std::to_string(num_rows_) +
+                       " rows, got " + std::to_string(_vec.size()) + ".");
+        }
+        return std::move(_vec);
+      };
+      return bin::read<std::vector<ValueType>>(begin, col.size_)
+          .and_then(check_size)
+          .or_else(embellish_error);
+    }
+  }
+
+  /// Copies all columns into a named tuple, as expected by from_columns.
+  template <size_t... _is>
+  Result<columns_t<T>> to_columns(std::index_sequence<_is...>) const noexcept {
+    auto columns = typename columns_t<T>::Values();
+    std::vector<Error> errors;
+    (copy_column<_is>(&std::get<_is>(columns), &errors), ...);
+    if (errors.size() != 0) {
+      return errors[0];
+    }
+    return columns_t<T>(std::move(std::get<_is>(columns))...);
+  }
+
+  template <size_t _i, class VecType>
+  void copy_column(VecType* _vec, std::vector<Error>* _errors) const noexcept {
+    auto res = column_at<_i>();
+    if (!res) {
+      _errors->emplace_back(*res.error());
+      return;
+    }
+    using ColumnType = std::decay_t<decltype(*res)>;
+    if constexpr (std::is_same<ColumnType, VecType>()) {
+      *_vec = std::move(*res);
+    } else {
+      *_vec = VecType((*res).begin(), (*res).end());
+    }
+  }
+
+ private:
+  /// Information on where to find the columns.
+  std::array<ColumnInfo, num_columns_> columns_;
+
+  /// The underlying buffer.
+  const unsigned char* data_;
+
+  /// The number of rows.
+  size_t num_rows_;
+};
+
+}  // namespace columnar
+}  // namespace rfl
+
+#endif
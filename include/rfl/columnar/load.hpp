@@ -0,0 +1,23 @@
+#ifndef RFL_COLUMNAR_LOAD_HPP_
+#define RFL_COLUMNAR_LOAD_HPP_
+
+#include <string>
+#include <vector>
+
+#include "rfl/Result.hpp"
+#include "rfl/columnar/read.hpp"
+#include "rfl/io/load_bytes.hpp"
+
+namespace rfl {
+namespace columnar {
+
+template <class T>
+Result<std::vector<T>> load(const std::string& _fname) {
+  const auto read_bytes = [](const auto& _bytes) { return read<T>(_bytes); };
+  return rfl::io::load_bytes(_fname).and_then(read_bytes);
+}
+
+}  // namespace columnar
+}  // namespace rfl
+
+#endif
@@ -0,0 +1,31 @@
+#ifndef RFL_COLUMNAR_READ_HPP_
+#define RFL_COLUMNAR_READ_HPP_
+
+#include <vector>
+
+#include "rfl/Result.hpp"
+#include "rfl/columnar/Table.hpp"
+
+namespace rfl {
+namespace columnar {
+
+/// Reads a vector of structs from the columnar format. If you only need
+/// some of the columns, use Table<T> instead.
+template <class T>
+Result<std::vector<T>> read(const unsigned char* _bytes, const size_t _size) {
+  const auto to_vector = [](const Table<T>& _table) {
+    return _table.to_vector();
+  };
+  return Table<T>::from_bytes(_bytes, _size).and_then(to_vector);
+}
+
+/// Reads a vector of structs from the columnar format.
+template <class T>
+Result<std::vector<T>> read(const std::vector<unsigned char>& _bytes) {
+  return read<T>(_bytes.data(), _bytes.size());
+}
+
+}  // namespace columnar
+}  // namespace rfl
+
+#endif
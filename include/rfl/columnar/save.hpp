@@ -0,0 +1,22 @@
+#ifndef RFL_COLUMNAR_SAVE_HPP_
+#define RFL_COLUMNAR_SAVE_HPP_
+
+#include <string>
+#include <vector>
+
+#include "rfl/Result.hpp"
+#include "rfl/columnar/write.hpp"
+#include "rfl/io/save_bytes.hpp"
+
+namespace rfl {
+namespace columnar {
+
+template <class T>
+Result<Nothing> save(const std::string& _fname, const std::vector<T>& _vec) {
+  return rfl::io::save_bytes(_fname, write(_vec));
+}
+
+}  // namespace columnar
+}  // namespace rfl
+
+#endif
@@ -0,0 +1,107 @@
+#ifndef RFL_COLUMNAR_WRITE_HPP_
+#define RFL_COLUMNAR_WRITE_HPP_
+
+#include <array>
+#include <cstdint>
+#include <cstring>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "rfl/bin/Parser.hpp"
+#include "rfl/bin/encode.hpp"
+#include "rfl/bin/fingerprint.hpp"
+#include "rfl/columnar/Header.hpp"
+#include "rfl/get.hpp"
+#include "rfl/internal/to_ptr_named_tuple.hpp"
+#include "rfl/named_tuple_t.hpp"
+
+namespace rfl {
+namespace columnar {
+
+/// Writes a single column. The column is extracted directly from the
+/// structs, so no intermediate copies of the columns are needed.
+template <size_t _i, class T>
+ColumnInfo write_column(const std::vector<T>& _vec,
+                        std::vector<unsigned char>* _bytes) {
+  using FieldType = std::tuple_element_t<_i, typename named_tuple_t<T>::Fields>;
+  using ValueType = typename FieldType::Type;
+
+  const auto get_value = [](const T& _t) -> const ValueType& {
+    return *rfl::get<_i>(internal::to_ptr_named_tuple(_t));
+  };
+
+  const auto padding = (alignment - _bytes->size() % alignment) % alignment;
+  _bytes->resize(_bytes->size() + padding);
+
+  const auto begin = _bytes->size();
+
+  if constexpr (encoding_of<ValueType>() == Encoding::raw) {
+    _bytes->resize(begin + _vec.size() * sizeof(ValueType));
+    auto ptr = _bytes->data() + begin;
+    for (const auto& t : _vec) {
+      std::memcpy(ptr, &get_value(t), sizeof(ValueType));
+      ptr += sizeof(ValueType);
+    }
+
+  } else if constexpr (encoding_of<ValueType>() == Encoding::strings) {
+    const auto offsets_size = (_vec.size() + 1) * sizeof(std::uint64_t);
+    _bytes->resize(begin + offsets_size);
+    std::uint64_t offset = 0;
+    for (size_t i = 0; i < _vec.size(); ++i) {
+      std::memcpy(_bytes->data() + begin + i * sizeof(std::uint64_t), &offset,
+                  sizeof(std::uint64_t));
+      const auto& str = get_value(_vec[i]);
+      _bytes->insert(_bytes->end(), str.begin(), str.end());
+      offset += str.size();
+    }
+    std::memcpy(_bytes->data() + begin + _vec.size() * sizeof(std::uint64_t),
+                &offset, sizeof(std::uint64_t));
+
+  } else {
+    auto buf = bin::Writer::Buffer();
+    const auto w = bin::Writer(&buf);
+    bin::encode_header(bin::fingerprint<std::vector<ValueType>>(), _bytes);
+    bin::encode_array_header(_vec.size(), _bytes);
+    for (const auto& t : _vec) {
+      bin::Parser<ValueType>::write(w, get_value(t));
+    }
+    buf.flush(_bytes);
+  }
+
+  return ColumnInfo{.encoding_ = encoding_of<ValueType>(),
+                    .offset_ = begin,
+                    .size_ = _bytes->size() - begin};
+}
+
+/// Writes a vector of structs to the columnar format.
+template <class T>
+std::vector<unsigned char> write(const std::vector<T>& _vec) {
+  constexpr auto num_columns =
+      std::tuple_size_v<typename named_tuple_t<T>::Fields>;
+
+  constexpr auto columns_size = sizeof(ColumnInfo) * num_columns;
+
+  const auto header = Header{.magic_ = magic,
+                             .fingerprint_ = bin::fingerprint<T>(),
+                             .num_rows_ = _vec.size(),
+                             .num_columns_ = num_columns};
+
+  auto bytes = std::vector<unsigned char>(sizeof(Header) + columns_size);
+
+  const auto columns = [&]<size_t... _is>(std::index_sequence<_is...>) {
+    return std::array<ColumnInfo, num_columns>(
+        {write_column<_is>(_vec, &bytes)...});
+  }(std::make_index_sequence<num_columns>());
+
+  std::memcpy(bytes.data(), &header, sizeof(Header));
+  std::memcpy(bytes.data() + sizeof(Header), columns.data(), columns_size);
+
+  return bytes;
+}
+
+}  // namespace columnar
+}  // namespace rfl
+
+#endif
@@ -0,0 +1,29 @@
+#ifndef RFL_COLUMNS_T_HPP_
+#define RFL_COLUMNS_T_HPP_
+
+#include <type_traits>
+#include <vector>
+
+#include "rfl/Field.hpp"
+#include "rfl/NamedTuple.hpp"
+#include "rfl/named_tuple_t.hpp"
+
+namespace rfl {
+
+template <class T>
+struct to_columns_nt;
+
+template <class... FieldTypes>
+struct to_columns_nt<NamedTuple<FieldTypes...>> {
+  using ColumnsType = NamedTuple<
+      Field<FieldTypes::name_, std::vector<typename FieldTypes::Type>>...>;
+};
+
+/// Generates the named tuple returned by to_columns(...): A named tuple
+/// containing an std::vector for every field of T.
+template <class T>
+using columns_t = typename to_columns_nt<named_tuple_t<T>>::ColumnsType;
+
+}  // namespace rfl
+
+#endif
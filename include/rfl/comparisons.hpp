@@ -1,91 +1,191 @@
 #ifndef RFL_COMPARISONS_HPP_
 #define RFL_COMPARISONS_HPP_
 
+#include <span>
+#include <utility>
+
 #include "rfl/Result.hpp"
+#include "rfl/internal/HasValidation.hpp"
 
 namespace rfl {
 
 template <auto _threshold>
 struct EqualTo {
   template <class T>
-  static Result<T> validate(T _value) noexcept {
+  static Result<Nothing> check(const T& _value) noexcept {
     constexpr auto threshold = static_cast<T>(_threshold);
     if (_value != threshold) {
       return Error("Value expected to be equal to " +
                    std::to_string(threshold) + ", but got " +
                    std::to_string(_value) + ".");
     }
-    return _value;
+    return Nothing{};
+  }
+
+  template <class T>
+  static Result<T> validate(T _value) noexcept {
+    return internal::validate_by_check<EqualTo>(std::move(_value));
+  }
+
+  template <class T>
+  static bool fails(const T _value) noexcept {
+    return _value != static_cast<T>(_threshold);
+  }
+
+  template <class T>
+  static bool check_all(const std::span<const T>& _values) noexcept {
+    return internal::none_of_values(
+        _values, [](const T _v) { return fails(_v); });
   }
 };
 
 template <auto _threshold>
 struct Minimum {
   template <class T>
-  static Result<T> validate(T _value) noexcept {
+  static Result<Nothing> check(const T& _value) noexcept {
     constexpr auto threshold = static_cast<T>(_threshold);
     if (_value < threshold) {
       return Error("Value expected to be greater than or equal to " +
                    std::to_string(threshold) + ", but got " +
                    std::to_string(_value) + ".");
     }
-    return _value;
+    return Nothing{};
+  }
+
+  template <class T>
+  static Result<T> validate(T _value) noexcept {
+    return internal::validate_by_check<Minimum>(std::move(_value));
+  }
+
+  template <class T>
+  static bool fails(const T _value) noexcept {
+    return _value < static_cast<T>(_threshold);
+  }
+
+  template <class T>
+  static bool check_all(const std::span<const T>& _values) noexcept {
+    return internal::none_of_values(
+        _values, [](const T _v) { return fails(_v); });
   }
 };
 
 template <auto _threshold>
 struct ExclusiveMinimum {
   template <class T>
-  static Result<T> validate(T _value) noexcept {
+  static Result<Nothing> check(const T& _value) noexcept {
     constexpr auto threshold = static_cast<T>(_threshold);
     if (_value <= threshold) {
       return Error("Value expected to be greater than " +
                    std::to_string(threshold) + ", but got " +
                    std::to_string(_value) + ".");
     }
-    return _value;
+    return Nothing{};
+  }
+
+  template <class T>
+  static Result<T> validate(T _value) noexcept {
+    return internal::validate_by_check<ExclusiveMinimum>(std::move(_value));
+  }
+
+  template <class T>
+  static bool fails(const T _value) noexcept {
+    return _value <= static_cast<T>(_threshold);
+  }
+
+  template <class T>
+  static bool check_all(const std::span<const T>& _values) noexcept {
+    return internal::none_of_values(
+        _values, [](const T _v) { return fails(_v); });
   }
 };
 
 template <auto _threshold>
 struct Maximum {
   template <class T>
-  static Result<T> validate(T _value) noexcept {
+  static Result<Nothing> check(const T& _value) noexcept {
     constexpr auto threshold = static_cast<T>(_threshold);
     if (_value > threshold) {
       return Error("Value expected to be less than or equal to " +
                    std::to_string(threshold) + ", but got " +
                    std::to_string(_value) + ".");
     }
-    return _value;
+    return Nothing{};
+  }
+
+  template <class T>
+  static Result<T> validate(T _value) noexcept {
+    return internal::validate_by_check<Maximum>(std::move(_value));
+  }
+
+  template <class T>
+  static bool fails(const T _value) noexcept {
+    return _value > static_cast<T>(_threshold);
+  }
+
+  template <class T>
+  static bool check_all(const std::span<const T>& _values) noexcept {
+    return internal::none_of_values(
+        _values, [](const T _v) { return fails(_v); });
   }
 };
 
 template <auto _threshold>
 struct ExclusiveMaximum {
   template <class T>
-  static Result<T> validate(T _value) noexcept {
+  static Result<Nothing> check(const T& _value) noexcept {
     constexpr auto threshold = static_cast<T>(_threshold);
     if (_value >= threshold) {
       return Error("Value expected to be less than " +
                    std::to_string(threshold) + ", but got " +
                    std::to_string(_value) + ".");
     }
-    return _value;
+    return Nothing{};
+  }
+
+  template <class T>
+  static Result<T> validate(T _value) noexcept {
+    return internal::validate_by_check<ExclusiveMaximum>(std::move(_value));
+  }
+
+  template <class T>
+  static bool fails(const T _value) noexcept {
+    return _value >= static_cast<T>(_threshold);
+  }
+
+  template <class T>
+  static bool check_all(const std::span<const T>& _values) noexcept {
+    return internal::none_of_values(
+        _values, [](const T _v) { return fails(_v); });
   }
 };
 
 template <auto _threshold>
 struct NotEqualTo {
   template <class T>
-  static Result<T> validate(T _value) noexcept {
+  static Result<Nothing> check(const T& _value) noexcept {
     constexpr auto threshold = static_cast<T>(_threshold);
     if (_value == threshold) {
       return Error("Value expected to not be equal to " +
                    std::to_string(threshold) + ", but got " +
                    std::to_string(_value) + ".");
     }
-    return _value;
+    return Nothing{};
+  }
+
+  template <class T>
+  static Result<T> validate(T _value) noexcept {
+    return internal::validate_by_check<NotEqualTo>(std::move(_value));
+  }
+
+  template <class T>
+  static bool fails(const T _value) noexcept {
+    return _value == static_cast<T>(_threshold);
+  }
+
+  template <class T>
+  static bool check_all(const std::span<const T>& _values) noexcept {
+    return internal::none_of_values(
+        _values, [](const T _v) { return fails(_v); });
   }
 };
 
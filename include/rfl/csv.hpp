@@ -0,0 +1,13 @@
+#ifndef RFL_CSV_HPP_
+#define RFL_CSV_HPP_
+
+#include "rfl/csv/Parser.hpp"
+#include "rfl/csv/Reader.hpp"
+#include "rfl/csv/Settings.hpp"
+#include "rfl/csv/Writer.hpp"
+#include "rfl/csv/load.hpp"
+#include "rfl/csv/read.hpp"
+#include "rfl/csv/save.hpp"
+#include "rfl/csv/write.hpp"
+
+#endif
@@ -0,0 +1,17 @@
+#ifndef RFL_CSV_PARSER_HPP_
+#define RFL_CSV_PARSER_HPP_
+
+#include "rfl/csv/Reader.hpp"
+#include "rfl/csv/Writer.hpp"
+#include "rfl/parsing/Parser.hpp"
+
+namespace rfl {
+namespace csv {
+
+template <class T>
+using Parser = parsing::Parser<Reader, Writer, T>;
+
+}
+}  // namespace rfl
+
+#endif
@@ -0,0 +1,168 @@
+#ifndef RFL_CSV_READER_HPP_
+#define RFL_CSV_READER_HPP_
+
+#include <array>
+#include <charconv>
+#include <cstdint>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <system_error>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "rfl/Result.hpp"
+#include "rfl/always_false.hpp"
+#include "rfl/csv/Tokenizer.hpp"
+
+namespace rfl {
+namespace csv {
+
+/// The state shared by all rows of a file.
+struct Row {
+  /// The column names.
+  const std::vector<std::string>* header_;
+
+  /// The cells of the current row.
+  const std::vector<Cell>* cells_;
+
+  /// Maps the columns to the fields of the struct. It is filled in when the
+  /// first row is parsed and then reused for all other rows.
+  std::vector<int>* field_ixs_;
+};
+
+struct Reader {
+  struct CSVInputArray {};
+
+  struct CSVInputObject {
+    const Row* row_;
+  };
+
+  struct CSVInputVar {
+    CSVInputVar() : cell_(nullptr), row_(nullptr) {}
+    CSVInputVar(const Cell* _cell) : cell_(_cell), row_(nullptr) {}
+    CSVInputVar(const Row* _row) : cell_(nullptr), row_(_row) {}
+    const Cell* cell_;
+    const Row* row_;
+  };
+
+  using InputArrayType = CSVInputArray;
+  using InputObjectType = CSVInputObject;
+  using InputVarType = CSVInputVar;
+
+  template <class T>
+  static constexpr bool has_custom_constructor = false;
+
+  rfl::Result<InputVarType> get_field(
+      const std::string& _name, const InputObjectType& _obj) const noexcept {
+    const auto& header = *_obj.row_->header_;
+    for (size_t i = 0; i < header.size(); ++i) {
+      if (header[i] == _name) {
+        return InputVarType(&(*_obj.row_->cells_)[i]);
+      }
+    }
+    return rfl::Error("There is no column called '" + _name + "'.");
+  }
+
+  bool is_empty(const InputVarType& _var) const noexcept {
+    if (_var.row_) {
+      return false;
+    }
+    return !_var.cell_ || (!_var.cell_->quoted_ && _var.cell_->str_.empty());
+  }
+
+  template <class T>
+  rfl::Result<T> to_basic_type(const InputVarType& _var) const noexcept {
+    if (!_var.cell_) {
+      return rfl::Error("Could not cast a row to a basic type.");
+    }
+    const auto str = _var.cell_->str_;
+    if constexpr (std::is_same<std::decay_t<T>, std::string>()) {
+      return std::string(str);
+    } else if constexpr (std::is_same<std::decay_t<T>, bool>()) {
+      if (str == "true" || str == "1") {
+        return true;
+      } else if (str == "false" || str == "0") {
+        return false;
+      }
+      return rfl::Error("Could not cast '" + std::string(str) +
+                        "' to boolean.");
+    } else if constexpr (std::is_floating_point<std::decay_t<T>>() ||
+                         std::is_integral<std::decay_t<T>>()) {
+      auto val = std::decay_t<T>();
+      const auto [ptr, ec] =
+          std::from_chars(str.data(), str.data() + str.size(), val);
+      if (ec != std::errc() || ptr != str.data() + str.size()) {
+        return rfl::Error(
+            "Could not cast '" + std::string(str) + "' to " +
+            (std::is_floating_point<std::decay_t<T>>() ? "double." : "int."));
+      }
+      return val;
+    } else {
+      static_assert(rfl::always_false_v<T>, "Unsupported type.");
+    }
+  }
+
+  rfl::Result<InputArrayType> to_array(
+      const InputVarType& _var) const noexcept {
+    return rfl::Error("CSV does not support arrays.");
+  }
+
+  /// The columns are matched to the fields only once per file.
+  template <size_t size, class FunctionType>
+  std::array<std::optional<InputVarType>, size> to_fields_array(
+      const FunctionType& _fct, const InputObjectType& _obj) const noexcept {
+    const auto& header = *_obj.row_->header_;
+    const auto& cells = *_obj.row_->cells_;
+    auto& field_ixs = *_obj.row_->field_ixs_;
+    if (field_ixs.size() != header.size()) {
+      field_ixs.clear();
+      for (const auto& name : header) {
+        field_ixs.push_back(_fct(std::string_view(name)));
+      }
+    }
+    std::array<std::optional<InputVarType>, size> f_arr;
+    for (size_t i = 0; i < cells.size(); ++i) {
+      if (field_ixs[i] != -1) {
+        f_arr[field_ixs[i]] = InputVarType(&cells[i]);
+      }
+    }
+    return f_arr;
+  }
+
+  std::vector<std::pair<std::string, InputVarType>> to_map(
+      const InputObjectType& _obj) const noexcept {
+    const auto& header = *_obj.row_->header_;
+    const auto& cells = *_obj.row_->cells_;
+    std::vector<std::pair<std::string, InputVarType>> m;
+    m.reserve(cells.size());
+    for (size_t i = 0; i < cells.size(); ++i) {
+      m.emplace_back(std::make_pair(header[i], InputVarType(&cells[i])));
+    }
+    return m;
+  }
+
+  rfl::Result<InputObjectType> to_object(
+      const InputVarType& _var) const noexcept {
+    if (!_var.row_) {
+      return rfl::Error("CSV does not support nested objects.");
+    }
+    return InputObjectType{_var.row_};
+  }
+
+  std::vector<InputVarType> to_vec(const InputArrayType& _arr) const noexcept {
+    return std::vector<InputVarType>();
+  }
+
+  template <class T>
+  rfl::Result<T> use_custom_constructor(
+      const InputVarType& _var) const noexcept {
+    return rfl::Error("CSV does not support custom constructors.");
+  }
+};
+
+}  // namespace csv
+}  // namespace rfl
+
+#endif
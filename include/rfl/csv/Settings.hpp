@@ -0,0 +1,19 @@
+#ifndef RFL_CSV_SETTINGS_HPP_
+#define RFL_CSV_SETTINGS_HPP_
+
+namespace rfl {
+namespace csv {
+
+struct Settings {
+  /// The character separating the cells of a row.
+  char delimiter_ = ',';
+
+  /// The character used to quote cells containing the delimiter, the quote
+  /// character itself or line breaks.
+  char quote_ = '"';
+};
+
+}  // namespace csv
+}  // namespace rfl
+
+#endif
@@ -0,0 +1,265 @@
+#ifndef RFL_CSV_TOKENIZER_HPP_
+#define RFL_CSV_TOKENIZER_HPP_
+
+#include <cstring>
+#include <istream>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "rfl/Result.hpp"
+#include "rfl/csv/Settings.hpp"
+#include "rfl/csv/scan.hpp"
+
+namespace rfl {
+namespace csv {
+
+struct Cell {
+  /// The content of the cell with the quotes removed.
+  std::string_view str_;
+
+  /// Quoted cells are never empty, which is how "" is distinguished from a
+  /// missing value.
+  bool quoted_;
+};
+
+/// Splits a stream into rows. Only one chunk of the stream is held in memory
+/// at any point in time and the cells returned by next_row(...) point into
+/// that chunk, so they are only valid until the next call.
+class Tokenizer {
+  /// The position of a cell, relative to the beginning of the row. Using
+  /// offsets rather than pointers means that nothing needs to be adjusted when
+  /// the buffer is refilled.
+  struct Bounds {
+    size_t begin_;
+    size_t end_;
+    bool quoted_;
+    bool escaped_;
+  };
+
+  static constexpr size_t chunk_size = 1 << 16;
+
+ public:
+  Tokenizer(std::istream* _stream, const Settings& _settings)
+      : begin_(0),
+        buffer_(chunk_size),
+        end_(0),
+        eof_(false),
+        settings_(_settings),
+        stream_(_stream) {}
+
+  ~Tokenizer() = default;
+
+  /// Reads the next non-empty row into _cells, reusing its memory. Returns
+  /// false, if there are no more rows.
+  Result<bool> next_row(std::vector<Cell>* _cells) {
+    while (true) {
+      const auto res = scan_row();
+      if (!res) {
+        return *res.error();
+      }
+      if (!*res) {
+        return false;
+      }
+      if (bounds_.size() == 1 && !bounds_[0].quoted_ &&
+          bounds_[0].begin_ == bounds_[0].end_) {
+        begin_ += row_size_;
+        continue;
+      }
+      _cells->clear();
+      for (const auto& b : bounds_) {
+        _cells->push_back(make_cell(b));
+      }
+      begin_ += row_size_;
+      return true;
+    }
+  }
+
+ private:
+  /// The beginning of the current row.
+  char* data() { return buffer_.data() + begin_; }
+
+  /// The number of bytes of the current row that are in the buffer.
+  size_t size() const { return end_ - begin_; }
+
+  /// Makes sure that at least _n bytes of the current row are in the buffer,
+  /// unless the stream ends before that.
+  bool ensure(const size_t _n) {
+    while (size() < _n) {
+      if (eof_) {
+        return false;
+      }
+      refill();
+    }
+    return true;
+  }
+
+  /// Moves the current row to the beginning of the buffer and reads the next
+  /// chunk from the stream. The buffer only grows for rows that are larger
+  /// than the buffer itself.
+  void refill() {
+    const auto n = size();
+    if (begin_ != 0) {
+      std::memmove(buffer_.data(), buffer_.data() + begin_, n);
+      begin_ = 0;
+      end_ = n;
+    }
+    if (end_ == buffer_.size()) {
+      buffer_.resize(buffer_.size() * 2);
+    }
+    stream_->read(buffer_.data() + end_, buffer_.size() - end_);
+    const auto bytes_read = static_cast<size_t>(stream_->gcount());
+    end_ += bytes_read;
+    eof_ = bytes_read == 0;
+  }
+
+  /// Removes the doubled quotes from an escaped cell, in place. This is safe,
+  /// because the row has been scanned completely at this point.
+  Cell make_cell(const Bounds& _b) {
+    const auto begin = data() + _b.begin_;
+    if (!_b.escaped_) {
+      return Cell{std::string_view(begin, _b.end_ - _b.begin_), _b.quoted_};
+    }
+    size_t j = 0;
+    for (size_t i = 0; i < _b.end_ - _b.begin_; ++i, ++j) {
+      begin[j] = begin[i];
+      if (begin[i] == settings_.quote_) {
+        ++i;
+      }
+    }
+    return Cell{std::string_view(begin, j), true};
+  }
+
+  /// Finds the cells of the next row. Returns false, if there are no more
+  /// rows.
+  Result<bool> scan_row() {
+    bounds_.clear();
+
+    if (!ensure(1)) {
+      return false;
+    }
+
+    size_t p = 0;
+
+    while (true) {
+      auto b = Bounds{p, p, false, false};
+
+      if (data()[p] == settings_.quote_) {
+        const auto res = scan_quoted(p + 1, &b);
+        if (!res) {
+          return *res.error();
+        }
+        p = *res;
+      } else {
+        p = scan_unquoted(p);
+        b.end_ = p;
+      }
+
+      bounds_.push_back(b);
+
+      if (!ensure(p + 1)) {
+        break;
+      }
+
+      const auto c = data()[p];
+
+      if (c == settings_.delimiter_) {
+        ++p;
+        if (!ensure(p + 1)) {
+          bounds_.push_back(Bounds{p, p, false, false});
+          break;
+        }
+        continue;
+      }
+
+      if (c == '\n') {
+        ++p;
+        break;
+      }
+
+      if (c == '\r') {
+        ++p;
+        if (ensure(p + 1) && data()[p] == '\n') {
+          ++p;
+        }
+        break;
+      }
+
+      return Error("Unexpected character '" + std::string(1, c) +
+                   "' after closing quote.");
+    }
+
+    row_size_ = p;
+
+    return true;
+  }
+
+  /// Scans a quoted cell starting after the opening quote and returns the
+  /// position after the closing quote.
+  Result<size_t> scan_quoted(size_t _p, Bounds* _b) {
+    _b->begin_ = _p;
+    _b->quoted_ = true;
+    while (true) {
+      const auto q = static_cast<const char*>(
+          std::memchr(data() + _p, settings_.quote_, size() - _p));
+      if (!q) {
+        _p = size();
+        if (!ensure(_p + 1)) {
+          return Error("Unterminated quote.");
+        }
+        continue;
+      }
+      _p = q - data();
+      if (ensure(_p + 2) && data()[_p + 1] == settings_.quote_) {
+        _b->escaped_ = true;
+        _p += 2;
+        continue;
+      }
+      _b->end_ = _p;
+      return _p + 1;
+    }
+  }
+
+  /// Scans an unquoted cell and returns the position of the delimiter or
+  /// line break that ends it.
+  size_t scan_unquoted(size_t _p) {
+    while (true) {
+      _p = find_delimiter_or_newline(data() + _p, data() + size(),
+                                     settings_.delimiter_) -
+           data();
+      if (_p < size() || !ensure(_p + 1)) {
+        return _p;
+      }
+    }
+  }
+
+ private:
+  /// The beginning of the current row in the buffer.
+  size_t begin_;
+
+  /// The cells of the current row, reused between rows.
+  std::vector<Bounds> bounds_;
+
+  /// The chunk of the stream currently held in memory.
+  std::vector<char> buffer_;
+
+  /// The end of the valid data in the buffer.
+  size_t end_;
+
+  /// Whether the stream has been read completely.
+  bool eof_;
+
+  /// The size of the row found by the last call to scan_row().
+  size_t row_size_ = 0;
+
+  /// The delimiter and quote characters.
+  Settings settings_;
+
+  /// The underlying stream.
+  std::istream* stream_;
+};
+
+}  // namespace csv
+}  // namespace rfl
+
+#endif
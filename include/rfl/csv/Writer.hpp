@@ -0,0 +1,107 @@
+#ifndef RFL_CSV_WRITER_HPP_
+#define RFL_CSV_WRITER_HPP_
+
+#include <charconv>
+#include <string>
+#include <string_view>
+#include <type_traits>
+
+#include "rfl/always_false.hpp"
+#include "rfl/csv/Settings.hpp"
+#include "rfl/csv/scan.hpp"
+
+namespace rfl {
+namespace csv {
+
+/// Writes the cells directly into the row buffer, so no memory is allocated
+/// per cell. The vars only record whether anything was written.
+struct Writer {
+  struct CSVOutputArray {};
+
+  struct CSVOutputObject {};
+
+  struct CSVOutputVar {
+    CSVOutputVar(const bool _null) : null_(_null) {}
+    CSVOutputVar(const CSVOutputArray&) : null_(true) {}
+    CSVOutputVar(const CSVOutputObject&) : null_(true) {}
+    bool null_;
+  };
+
+  using OutputArrayType = CSVOutputArray;
+  using OutputObjectType = CSVOutputObject;
+  using OutputVarType = CSVOutputVar;
+
+  Writer(std::string* _row, const Settings& _settings)
+      : row_(_row), settings_(_settings) {}
+
+  ~Writer() = default;
+
+  void add(const OutputVarType& _var, OutputArrayType* _arr) const noexcept {}
+
+  OutputVarType empty_var() const noexcept { return OutputVarType(true); }
+
+  template <class T>
+  OutputVarType from_basic_type(const T& _var) const noexcept {
+    if constexpr (std::is_same<std::decay_t<T>, std::string>()) {
+      write_str(_var);
+    } else if constexpr (std::is_same<std::decay_t<T>, bool>()) {
+      row_->append(_var ? "true" : "false");
+    } else if constexpr (std::is_floating_point<std::decay_t<T>>() ||
+                         std::is_integral<std::decay_t<T>>()) {
+      char buf[64];
+      const auto res = std::to_chars(buf, buf + sizeof(buf), _var);
+      row_->append(buf, res.ptr);
+    } else {
+      static_assert(rfl::always_false_v<T>, "Unsupported type.");
+    }
+    return OutputVarType(false);
+  }
+
+  OutputVarType from_string_view(const std::string_view _str) const noexcept {
+    write_str(_str);
+    return OutputVarType(false);
+  }
+
+  OutputArrayType new_array() const noexcept { return OutputArrayType(); }
+
+  OutputObjectType new_object() const noexcept { return OutputObjectType(); }
+
+  bool is_empty(const OutputVarType& _var) const noexcept {
+    return _var.null_;
+  }
+
+  void set_field(const std::string& _name, const OutputVarType& _var,
+                 OutputObjectType* _obj) const noexcept {}
+
+  /// Empty strings are quoted as well, to distinguish them from missing
+  /// values.
+  void write_str(const std::string_view _str) const noexcept {
+    const auto begin = _str.data();
+    const auto end = begin + _str.size();
+    if (!_str.empty() &&
+        !needs_quotes(begin, end, settings_.delimiter_, settings_.quote_)) {
+      row_->append(_str);
+      return;
+    }
+    row_->push_back(settings_.quote_);
+    for (const auto c : _str) {
+      if (c == settings_.quote_) {
+        row_->push_back(c);
+      }
+      row_->push_back(c);
+    }
+    row_->push_back(settings_.quote_);
+  }
+
+ private:
+  /// The row currently being written.
+  std::string* row_;
+
+  /// The delimiter and quote characters.
+  Settings settings_;
+};
+
+}  // namespace csv
+}  // namespace rfl
+
+#endif
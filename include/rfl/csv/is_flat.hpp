@@ -0,0 +1,71 @@
+#ifndef RFL_CSV_IS_FLAT_HPP_
+#define RFL_CSV_IS_FLAT_HPP_
+
+#include <memory>
+#include <optional>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+
+#include "rfl/internal/has_reflection_type_v.hpp"
+#include "rfl/internal/is_basic_type.hpp"
+#include "rfl/named_tuple_t.hpp"
+
+namespace rfl {
+namespace csv {
+
+/// Whether T can be written into a single cell: Basic types, optional values
+/// of these and everything that is reflected as a basic type, such as
+/// rfl::Literal, rfl::Validator or rfl::Timestamp.
+template <class T>
+struct is_flat;
+
+template <class T>
+constexpr bool is_flat_v = is_flat<std::remove_cvref_t<T>>::value;
+
+template <class T>
+struct is_flat {
+ private:
+  static constexpr bool calc() {
+    if constexpr (internal::is_basic_type_v<T>) {
+      return true;
+    } else if constexpr (internal::has_reflection_type_v<T>) {
+      return is_flat_v<typename T::ReflectionType>;
+    } else {
+      return false;
+    }
+  }
+
+ public:
+  static constexpr bool value = calc();
+};
+
+template <class T>
+struct is_flat<std::optional<T>> {
+  static constexpr bool value = is_flat_v<T>;
+};
+
+template <class T>
+struct is_flat<std::shared_ptr<T>> {
+  static constexpr bool value = is_flat_v<T>;
+};
+
+template <class T>
+struct is_flat<std::unique_ptr<T>> {
+  static constexpr bool value = is_flat_v<T>;
+};
+
+/// Whether every field of T can be written into a single cell.
+template <class T>
+constexpr bool is_flat_struct() {
+  using Fields = typename named_tuple_t<T>::Fields;
+  return []<size_t... _is>(std::index_sequence<_is...>) {
+    return (true && ... &&
+            is_flat_v<typename std::tuple_element_t<_is, Fields>::Type>);
+  }(std::make_index_sequence<std::tuple_size_v<Fields>>());
+}
+
+}  // namespace csv
+}  // namespace rfl
+
+#endif
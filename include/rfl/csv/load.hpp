@@ -0,0 +1,39 @@
+#ifndef RFL_CSV_LOAD_HPP_
+#define RFL_CSV_LOAD_HPP_
+
+#include <fstream>
+#include <string>
+#include <vector>
+
+#include "rfl/Result.hpp"
+#include "rfl/csv/Settings.hpp"
+#include "rfl/csv/read.hpp"
+
+namespace rfl {
+namespace csv {
+
+/// Streams the rows of a CSV file, calling _f for every row.
+template <class T, class F>
+Result<Nothing> load_rows(const std::string& _fname, const F& _f,
+                          const Settings& _settings = Settings()) {
+  std::ifstream input(_fname, std::ios::binary);
+  if (!input.is_open()) {
+    return rfl::Error("File '" + _fname + "' not found!");
+  }
+  return read_rows<T>(input, _f, _settings);
+}
+
+template <class T>
+Result<std::vector<T>> load(const std::string& _fname,
+                            const Settings& _settings = Settings()) {
+  std::ifstream input(_fname, std::ios::binary);
+  if (!input.is_open()) {
+    return rfl::Error("File '" + _fname + "' not found!");
+  }
+  return read<T>(input, _settings);
+}
+
+}  // namespace csv
+}  // namespace rfl
+
+#endif
@@ -0,0 +1,96 @@
+#ifndef RFL_CSV_READ_HPP_
+#define RFL_CSV_READ_HPP_
+
+#include <istream>
+#include <sstream>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "rfl/Result.hpp"
+#include "rfl/csv/Parser.hpp"
+#include "rfl/csv/Settings.hpp"
+#include "rfl/csv/Tokenizer.hpp"
+#include "rfl/csv/is_flat.hpp"
+
+namespace rfl {
+namespace csv {
+
+/// Streams the rows of a CSV file, calling _f for every row. Only a chunk of
+/// the stream is held in memory at any point in time, so this can be used
+/// for files that do not fit into memory. The first row must contain the
+/// column names, which are matched to the fields of T once. Stops at the
+/// first row that cannot be parsed.
+template <class T, class F>
+Result<Nothing> read_rows(std::istream& _stream, const F& _f,
+                          const Settings& _settings = Settings()) {
+  static_assert(is_flat_struct<T>(),
+                "CSV only supports flat structs. Every field must be a basic "
+                "type or something that is reflected as a basic type.");
+
+  auto tokenizer = Tokenizer(&_stream, _settings);
+
+  auto header = std::vector<std::string>();
+  auto cells = std::vector<Cell>();
+  auto field_ixs = std::vector<int>();
+
+  const auto has_header = tokenizer.next_row(&cells);
+  if (!has_header) {
+    return Error("Could not read header: " + has_header.error()->what());
+  }
+  if (!*has_header) {
+    return Nothing{};
+  }
+
+  for (const auto& cell : cells) {
+    header.emplace_back(std::string(cell.str_));
+  }
+
+  const auto r = Reader();
+  const auto row = Row{&header, &cells, &field_ixs};
+
+  for (size_t i = 1;; ++i) {
+    const auto has_row = tokenizer.next_row(&cells);
+    if (!has_row) {
+      return Error("Could not read row " + std::to_string(i) + ": " +
+                   has_row.error()->what());
+    }
+    if (!*has_row) {
+      return Nothing{};
+    }
+    if (cells.size() != header.size()) {
+      return Error("Could not read row " + std::to_string(i) +
+                   ": Expected " + std::to_string(header.size()) +
+                   " cells, but found " + std::to_string(cells.size()) + ".");
+    }
+    auto t = Parser<T>::read(r, typename Reader::InputVarType(&row));
+    if (!t) {
+      return Error("Could not read row " + std::to_string(i) + ": " +
+                   t.error()->what());
+    }
+    _f(std::move(*t));
+  }
+}
+
+/// Parses a vector of structs from a CSV stream.
+template <class T>
+Result<std::vector<T>> read(std::istream& _stream,
+                            const Settings& _settings = Settings()) {
+  auto vec = std::vector<T>();
+  const auto push_back = [&](T&& _t) { vec.emplace_back(std::move(_t)); };
+  return read_rows<T>(_stream, push_back, _settings)
+      .transform([&](const auto&) { return std::move(vec); });
+}
+
+/// Parses a vector of structs from a CSV string.
+template <class T>
+Result<std::vector<T>> read(const std::string& _csv_str,
+                            const Settings& _settings = Settings()) {
+  auto stream = std::istringstream(_csv_str);
+  return read<T>(stream, _settings);
+}
+
+}  // namespace csv
+}  // namespace rfl
+
+#endif
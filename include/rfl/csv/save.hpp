@@ -0,0 +1,31 @@
+#ifndef RFL_CSV_SAVE_HPP_
+#define RFL_CSV_SAVE_HPP_
+
+#include <exception>
+#include <fstream>
+#include <string>
+
+#include "rfl/Result.hpp"
+#include "rfl/csv/Settings.hpp"
+#include "rfl/csv/write.hpp"
+
+namespace rfl {
+namespace csv {
+
+template <class RangeType>
+Result<Nothing> save(const std::string& _fname, const RangeType& _rows,
+                     const Settings& _settings = Settings()) {
+  try {
+    std::ofstream output(_fname, std::ios::out | std::ios::binary);
+    write(_rows, output, _settings);
+    output.close();
+  } catch (std::exception& e) {
+    return Error(e.what());
+  }
+  return Nothing{};
+}
+
+}  // namespace csv
+}  // namespace rfl
+
+#endif
@@ -0,0 +1,65 @@
+#ifndef RFL_CSV_SCAN_HPP_
+#define RFL_CSV_SCAN_HPP_
+
+#include <bit>
+#include <cstdint>
+#include <cstring>
+
+namespace rfl {
+namespace csv {
+
+/// Returns a value in which the highest bit of every byte of _x that is zero
+/// is set. Bytes following a zero byte might be flagged as well, but the first
+/// flagged byte is always correct.
+constexpr std::uint64_t flag_zero_bytes(const std::uint64_t _x) noexcept {
+  constexpr std::uint64_t ones = 0x0101010101010101ULL;
+  constexpr std::uint64_t highs = 0x8080808080808080ULL;
+  return (_x - ones) & ~_x & highs;
+}
+
+/// Finds the first occurrence of _delimiter, '\n' or '\r' in [_begin, _end)
+/// or returns _end, if there is none. Compares eight bytes at a time.
+inline const char* find_delimiter_or_newline(const char* _begin,
+                                             const char* _end,
+                                             const char _delimiter) noexcept {
+  constexpr std::uint64_t ones = 0x0101010101010101ULL;
+  const auto d = ones * static_cast<unsigned char>(_delimiter);
+  constexpr auto n = ones * static_cast<unsigned char>('\n');
+  constexpr auto r = ones * static_cast<unsigned char>('\r');
+
+  auto it = _begin;
+
+  for (; _end - it >= 8; it += 8) {
+    std::uint64_t x = 0;
+    std::memcpy(&x, it, 8);
+    const auto flags = flag_zero_bytes(x ^ d) | flag_zero_bytes(x ^ n) |
+                       flag_zero_bytes(x ^ r);
+    if (flags != 0) {
+      if constexpr (std::endian::native == std::endian::little) {
+        return it + std::countr_zero(flags) / 8;
+      } else {
+        break;
+      }
+    }
+  }
+
+  for (; it != _end; ++it) {
+    if (*it == _delimiter || *it == '\n' || *it == '\r') {
+      return it;
+    }
+  }
+
+  return _end;
+}
+
+/// Determines whether _str must be quoted.
+inline bool needs_quotes(const char* _begin, const char* _end,
+                         const char _delimiter, const char _quote) noexcept {
+  return find_delimiter_or_newline(_begin, _end, _delimiter) != _end ||
+         std::memchr(_begin, _quote, _end - _begin) != nullptr;
+}
+
+}  // namespace csv
+}  // namespace rfl
+
+#endif
@@ -0,0 +1,94 @@
+#ifndef RFL_CSV_WRITE_HPP_
+#define RFL_CSV_WRITE_HPP_
+
+#include <ostream>
+#include <ranges>
+#include <sstream>
+#include <string>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+
+#include "rfl/csv/Parser.hpp"
+#include "rfl/csv/Settings.hpp"
+#include "rfl/csv/is_flat.hpp"
+#include "rfl/get.hpp"
+#include "rfl/internal/to_ptr_named_tuple.hpp"
+#include "rfl/named_tuple_t.hpp"
+
+namespace rfl {
+namespace csv {
+
+/// Writes the column names, which are the field names of T.
+template <class T>
+void write_header(const Writer& _w, const char _delimiter, std::string* _row) {
+  using Fields = typename named_tuple_t<T>::Fields;
+  [&]<size_t... _is>(std::index_sequence<_is...>) {
+    const auto write_name = [&](const size_t _i, const std::string& _name) {
+      if (_i != 0) {
+        _row->push_back(_delimiter);
+      }
+      _w.write_str(_name);
+    };
+    (write_name(_is, std::tuple_element_t<_is, Fields>::name_.str()), ...);
+  }(std::make_index_sequence<std::tuple_size_v<Fields>>());
+}
+
+/// Writes the fields of _t into _row. Missing values are written as empty
+/// cells.
+template <class T>
+void write_row(const Writer& _w, const char _delimiter, const T& _t,
+               std::string* _row) {
+  using Fields = typename named_tuple_t<T>::Fields;
+  const auto ptr_nt = internal::to_ptr_named_tuple(_t);
+  [&]<size_t... _is>(std::index_sequence<_is...>) {
+    const auto write_cell = [&](const size_t _i, const auto& _value) {
+      using ValueType = std::remove_cvref_t<decltype(_value)>;
+      if (_i != 0) {
+        _row->push_back(_delimiter);
+      }
+      Parser<ValueType>::write(_w, _value);
+    };
+    (write_cell(_is, *rfl::get<_is>(ptr_nt)), ...);
+  }(std::make_index_sequence<std::tuple_size_v<Fields>>());
+}
+
+/// Writes a range of structs to a CSV stream, one row at a time. The memory
+/// of the row is reused, so no memory is allocated per row.
+template <class RangeType>
+void write(const RangeType& _rows, std::ostream& _stream,
+           const Settings& _settings = Settings()) {
+  using T = std::ranges::range_value_t<RangeType>;
+
+  static_assert(is_flat_struct<T>(),
+                "CSV only supports flat structs. Every field must be a basic "
+                "type or something that is reflected as a basic type.");
+
+  auto row = std::string();
+  const auto w = Writer(&row, _settings);
+
+  write_header<T>(w, _settings.delimiter_, &row);
+  row.push_back('\n');
+  _stream.write(row.data(), row.size());
+
+  for (const auto& t : _rows) {
+    row.clear();
+    write_row(w, _settings.delimiter_, t, &row);
+    row.push_back('\n');
+    _stream.write(row.data(), row.size());
+  }
+}
+
+/// Writes a range of structs to a CSV string.
+template <class RangeType>
+std::string write(const RangeType& _rows,
+                  const Settings& _settings = Settings()) {
+  auto stream = std::ostringstream();
+  write(_rows, stream, _settings);
+  return stream.str();
+}
+
+}  // namespace csv
+}  // namespace rfl
+
+#endif
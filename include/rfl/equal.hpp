@@ -0,0 +1,288 @@
+#ifndef RFL_EQUAL_HPP_
+#define RFL_EQUAL_HPP_
+
+#include <algorithm>
+#include <cstring>
+#include <memory>
+#include <optional>
+#include <ranges>
+#include <string>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+#include <variant>
+
+#include "rfl/Box.hpp"
+#include "rfl/Field.hpp"
+#include "rfl/Flatten.hpp"
+#include "rfl/Literal.hpp"
+#include "rfl/NamedTuple.hpp"
+#include "rfl/ObjectMap.hpp"
+#include "rfl/Ref.hpp"
+#include "rfl/TaggedUnion.hpp"
+#include "rfl/Variant.hpp"
+#include "rfl/internal/has_fields.hpp"
+#include "rfl/internal/has_reflection_method_v.hpp"
+#include "rfl/internal/is_unordered_container.hpp"
+#include "rfl/internal/to_ptr_field_tuple.hpp"
+#include "rfl/internal/to_ptr_tuple.hpp"
+
+namespace rfl {
+
+/// Compares two objects field by field using reflection. Can be used as the
+/// key equality of std::unordered_map or std::unordered_set.
+template <class T>
+struct Equal;
+
+/// Compares two objects field by field using reflection.
+template <class T>
+bool equal(const T& _t1, const T& _t2) noexcept {
+  return Equal<std::remove_cvref_t<T>>{}(_t1, _t2);
+}
+
+namespace internal {
+
+/// Compares the pointers contained in two tuples generated by
+/// to_ptr_field_tuple or to_ptr_tuple.
+template <int _i = 0, class PtrTupleType>
+bool equal_ptr_tuples(const PtrTupleType& _tup1,
+                      const PtrTupleType& _tup2) noexcept {
+  if constexpr (_i == std::tuple_size_v<PtrTupleType>) {
+    return true;
+  } else {
+    using PtrType = std::tuple_element_t<_i, PtrTupleType>;
+    const bool eq = [&]() {
+      if constexpr (is_field_v<PtrType> || is_flatten_field_v<PtrType>) {
+        return equal(*std::get<_i>(_tup1).get(), *std::get<_i>(_tup2).get());
+      } else {
+        return equal(*std::get<_i>(_tup1), *std::get<_i>(_tup2));
+      }
+    }();
+    return eq && equal_ptr_tuples<_i + 1>(_tup1, _tup2);
+  }
+}
+
+/// Compares everything that can be iterated over.
+template <class RangeType>
+bool equal_ranges(const RangeType& _r1, const RangeType& _r2) noexcept {
+  using ValueType = std::remove_cvref_t<std::ranges::range_value_t<RangeType>>;
+  const auto pred = [](const auto& _v1, const auto& _v2) {
+    return equal(_v1, _v2);
+  };
+  if constexpr (std::ranges::contiguous_range<RangeType> &&
+                std::has_unique_object_representations_v<ValueType>) {
+    const auto size = std::ranges::size(_r1);
+    return size == std::ranges::size(_r2) &&
+           (size == 0 || std::memcmp(std::ranges::data(_r1),
+                                     std::ranges::data(_r2),
+                                     size * sizeof(ValueType)) == 0);
+  } else if constexpr (is_unordered_container<RangeType>) {
+    if (_r1.size() != _r2.size()) {
+      return false;
+    }
+    if constexpr (has_unique_keys<RangeType>) {
+      for (const auto& v : _r1) {
+        if constexpr (requires { typename RangeType::mapped_type; }) {
+          const auto it = _r2.find(v.first);
+          if (it == _r2.end() || !equal(v.second, it->second)) {
+            return false;
+          }
+        } else {
+          if (_r2.find(v) == _r2.end()) {
+            return false;
+          }
+        }
+      }
+      return true;
+    } else {
+      return std::is_permutation(_r1.begin(), _r1.end(), _r2.begin(),
+                                 _r2.end(), pred);
+    }
+  } else {
+    return std::equal(_r1.begin(), _r1.end(), _r2.begin(), _r2.end(), pred);
+  }
+}
+
+}  // namespace internal
+
+/// Default case - basic types, structs and containers.
+template <class T>
+struct Equal {
+  bool operator()(const T& _t1, const T& _t2) const noexcept {
+    if constexpr (std::is_arithmetic_v<T> || std::is_enum_v<T> ||
+                  std::is_same<T, std::string>()) {
+      return _t1 == _t2;
+    } else if constexpr (internal::has_reflection_method_v<T>) {
+      return equal(_t1.reflection(), _t2.reflection());
+    } else if constexpr (std::ranges::range<T>) {
+      return internal::equal_ranges(_t1, _t2);
+    } else if constexpr (std::is_class_v<T> && std::is_aggregate_v<T>) {
+      if constexpr (internal::has_fields<T>()) {
+        return internal::equal_ptr_tuples(internal::to_ptr_field_tuple(_t1),
+                                          internal::to_ptr_field_tuple(_t2));
+      } else {
+        return internal::equal_ptr_tuples(internal::to_ptr_tuple(_t1),
+                                          internal::to_ptr_tuple(_t2));
+      }
+    } else {
+      return _t1 == _t2;
+    }
+  }
+};
+
+template <class T>
+struct Equal<Box<T>> {
+  bool operator()(const Box<T>& _b1, const Box<T>& _b2) const noexcept {
+    return equal(*_b1, *_b2);
+  }
+};
+
+template <internal::StringLiteral _name, class T>
+struct Equal<Field<_name, T>> {
+  bool operator()(const Field<_name, T>& _f1,
+                  const Field<_name, T>& _f2) const noexcept {
+    return equal(_f1.value(), _f2.value());
+  }
+};
+
+template <class T>
+struct Equal<Flatten<T>> {
+  bool operator()(const Flatten<T>& _f1,
+                  const Flatten<T>& _f2) const noexcept {
+    return equal(_f1.get(), _f2.get());
+  }
+};
+
+template <internal::StringLiteral... _fields>
+struct Equal<Literal<_fields...>> {
+  bool operator()(const Literal<_fields...>& _l1,
+                  const Literal<_fields...>& _l2) const noexcept {
+    return _l1.value() == _l2.value();
+  }
+};
+
+template <class T>
+struct Equal<ObjectMap<T>> {
+  bool operator()(const ObjectMap<T>& _m1,
+                  const ObjectMap<T>& _m2) const noexcept {
+    return equal(_m1.get(), _m2.get());
+  }
+};
+
+template <class... FieldTypes>
+struct Equal<NamedTuple<FieldTypes...>> {
+  bool operator()(const NamedTuple<FieldTypes...>& _nt1,
+                  const NamedTuple<FieldTypes...>& _nt2) const noexcept {
+    return equal(_nt1.values(), _nt2.values());
+  }
+};
+
+template <class T>
+struct Equal<std::optional<T>> {
+  bool operator()(const std::optional<T>& _o1,
+                  const std::optional<T>& _o2) const noexcept {
+    if (!_o1 || !_o2) {
+      return !_o1 && !_o2;
+    }
+    return equal(*_o1, *_o2);
+  }
+};
+
+template <class T1, class T2>
+struct Equal<std::pair<T1, T2>> {
+  bool operator()(const std::pair<T1, T2>& _p1,
+                  const std::pair<T1, T2>& _p2) const noexcept {
+    return equal(_p1.first, _p2.first) && equal(_p1.second, _p2.second);
+  }
+};
+
+template <class T>
+struct Equal<Ref<T>> {
+  bool operator()(const Ref<T>& _r1, const Ref<T>& _r2) const noexcept {
+    return equal(*_r1, *_r2);
+  }
+};
+
+template <class T>
+struct Equal<std::shared_ptr<T>> {
+  bool operator()(const std::shared_ptr<T>& _p1,
+                  const std::shared_ptr<T>& _p2) const noexcept {
+    if (!_p1 || !_p2) {
+      return !_p1 && !_p2;
+    }
+    return equal(*_p1, *_p2);
+  }
+};
+
+template <internal::StringLiteral _discriminator, class... NamedTupleTypes>
+struct Equal<TaggedUnion<_discriminator, NamedTupleTypes...>> {
+  bool operator()(
+      const TaggedUnion<_discriminator, NamedTupleTypes...>& _t1,
+      const TaggedUnion<_discriminator, NamedTupleTypes...>& _t2)
+      const noexcept {
+    return equal(_t1.variant(), _t2.variant());
+  }
+};
+
+template <class... Ts>
+struct Equal<std::tuple<Ts...>> {
+  bool operator()(const std::tuple<Ts...>& _tup1,
+                  const std::tuple<Ts...>& _tup2) const noexcept {
+    return equal_elements(_tup1, _tup2, std::index_sequence_for<Ts...>{});
+  }
+
+ private:
+  template <size_t... _is>
+  static bool equal_elements(const std::tuple<Ts...>& _tup1,
+                             const std::tuple<Ts...>& _tup2,
+                             std::index_sequence<_is...>) noexcept {
+    return (true && ... &&
+            equal(std::get<_is>(_tup1), std::get<_is>(_tup2)));
+  }
+};
+
+template <class T>
+struct Equal<std::unique_ptr<T>> {
+  bool operator()(const std::unique_ptr<T>& _p1,
+                  const std::unique_ptr<T>& _p2) const noexcept {
+    if (!_p1 || !_p2) {
+      return !_p1 && !_p2;
+    }
+    return equal(*_p1, *_p2);
+  }
+};
+
+template <class... AlternativeTypes>
+struct Equal<Variant<AlternativeTypes...>> {
+  bool operator()(const Variant<AlternativeTypes...>& _v1,
+                  const Variant<AlternativeTypes...>& _v2) const noexcept {
+    return equal(_v1.variant(), _v2.variant());
+  }
+};
+
+template <class... AlternativeTypes>
+struct Equal<std::variant<AlternativeTypes...>> {
+  bool operator()(const std::variant<AlternativeTypes...>& _v1,
+                  const std::variant<AlternativeTypes...>& _v2) const noexcept {
+    return _v1.index() == _v2.index() && equal_alternatives(_v1, _v2);
+  }
+
+ private:
+  template <size_t _i = 0>
+  static bool equal_alternatives(
+      const std::variant<AlternativeTypes...>& _v1,
+      const std::variant<AlternativeTypes...>& _v2) noexcept {
+    if constexpr (_i == sizeof...(AlternativeTypes)) {
+      return false;
+    } else {
+      if (_v1.index() == _i) {
+        return equal(std::get<_i>(_v1), std::get<_i>(_v2));
+      }
+      return equal_alternatives<_i + 1>(_v1, _v2);
+    }
+  }
+};
+
+}  // namespace rfl
+
+#endif
@@ -3,10 +3,13 @@
 
 #include "rfl/flexbuf/Parser.hpp"
 #include "rfl/flexbuf/Reader.hpp"
+#include "rfl/flexbuf/View.hpp"
 #include "rfl/flexbuf/Writer.hpp"
 #include "rfl/flexbuf/load.hpp"
 #include "rfl/flexbuf/read.hpp"
+#include "rfl/flexbuf/read_into.hpp"
 #include "rfl/flexbuf/save.hpp"
+#include "rfl/flexbuf/serializers.hpp"
 #include "rfl/flexbuf/write.hpp"
 
 #endif
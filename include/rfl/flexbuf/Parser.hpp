@@ -1,8 +1,20 @@
 #ifndef FLEXBUF_PARSER_HPP_
 #define FLEXBUF_PARSER_HPP_
 
+#include <flatbuffers/flexbuffers.h>
+
+#include <algorithm>
+#include <bit>
+#include <cstddef>
+#include <cstring>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+#include "rfl/Result.hpp"
 #include "rfl/flexbuf/Reader.hpp"
 #include "rfl/flexbuf/Writer.hpp"
+#include "rfl/parsing/InPlaceParser.hpp"
 #include "rfl/parsing/Parser.hpp"
 
 namespace rfl {
@@ -11,7 +23,92 @@ namespace flexbuf {
 template <class T>
 using Parser = rfl::parsing::Parser<Reader, Writer, T>;
 
+/// Numeric vectors are stored as blobs containing the elements in
+/// little-endian order, so they can be copied in and out of the buffer in one
+/// go.
+template <class T>
+concept is_blob_element = std::is_arithmetic_v<T> && !std::is_same_v<T, bool>;
+
+/// Copies a blob into _vec. The capacity of _vec is retained.
+template <is_blob_element T, class A>
+Result<Nothing> read_blob(const Reader::InputVarType& _var,
+                          std::vector<T, A>* _vec) noexcept {
+  const auto blob = _var.AsBlob();
+  if (blob.size() % sizeof(T) != 0) {
+    return Error("Could not cast blob of size " + std::to_string(blob.size()) +
+                 " to a vector of elements of size " +
+                 std::to_string(sizeof(T)) + ".");
+  }
+  _vec->resize(blob.size() / sizeof(T));
+  if (blob.size() != 0) {
+    std::memcpy(_vec->data(), blob.data(), blob.size());
+  }
+  if constexpr (std::endian::native == std::endian::big && sizeof(T) > 1) {
+    auto bytes = reinterpret_cast<unsigned char*>(_vec->data());
+    for (size_t i = 0; i < _vec->size(); ++i) {
+      std::reverse(bytes + i * sizeof(T), bytes + (i + 1) * sizeof(T));
+    }
+  }
+  return Nothing{};
 }
+
+}  // namespace flexbuf
+
+namespace parsing {
+
+/// Writes numeric vectors as blobs instead of untyped vectors, which stores
+/// every element at its natural width without a type tag. Untyped vectors,
+/// as written by earlier versions, can still be read. R is either the
+/// flexbuf::Reader or a ReaderWithResource wrapping it.
+template <class R, flexbuf::is_blob_element T, class A>
+struct Parser<R, flexbuf::Writer, std::vector<T, A>> {
+  using W = flexbuf::Writer;
+
+  using VecType = std::vector<T, A>;
+
+  using InputVarType = typename R::InputVarType;
+  using OutputVarType = typename W::OutputVarType;
+
+  static Result<VecType> read(const R& _r, const InputVarType& _var) noexcept {
+    if (!_var.IsBlob()) {
+      return VectorParser<R, W, VecType>::read(_r, _var);
+    }
+    auto vec = make_empty<VecType>(_r);
+    return flexbuf::read_blob(_var, &vec).transform(
+        [&](const auto&) { return std::move(vec); });
+  }
+
+  static OutputVarType write(const W& _w, const VecType& _vec) noexcept {
+    if constexpr (std::endian::native == std::endian::little) {
+      return _w.from_blob(_vec.data(), _vec.size() * sizeof(T));
+    } else {
+      return VectorParser<R, W, VecType>::write(_w, _vec);
+    }
+  }
+};
+
+template <class R, flexbuf::is_blob_element T, class A>
+struct InPlaceParser<R, flexbuf::Writer, std::vector<T, A>> {
+  using W = flexbuf::Writer;
+
+  using VecType = std::vector<T, A>;
+
+  using InputVarType = typename R::InputVarType;
+
+  static Result<Nothing> read(const R& _r, const InputVarType& _var,
+                              VecType* _vec) noexcept {
+    if (_var.IsBlob()) {
+      return flexbuf::read_blob(_var, _vec);
+    }
+    const auto move_into_target = [_vec](VecType&& _v) {
+      *_vec = std::move(_v);
+      return Nothing{};
+    };
+    return Parser<R, W, VecType>::read(_r, _var).transform(move_into_target);
+  }
+};
+
+}  // namespace parsing
 }  // namespace rfl
 
 #endif
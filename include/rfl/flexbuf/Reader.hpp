@@ -3,8 +3,11 @@
 
 #include <flatbuffers/flexbuffers.h>
 
+#include <algorithm>
+#include <array>
 #include <exception>
 #include <map>
+#include <optional>
 #include <sstream>
 #include <stdexcept>
 #include <string>
@@ -14,6 +17,7 @@
 
 #include "rfl/Result.hpp"
 #include "rfl/always_false.hpp"
+#include "rfl/internal/sorted_field_names.hpp"
 
 namespace rfl {
 namespace flexbuf {
@@ -23,6 +27,9 @@ struct Reader {
   using InputObjectType = flexbuffers::Map;
   using InputVarType = flexbuffers::Reference;
 
+  /// Flexbuffers always stores the keys of a map in sorted order.
+  static constexpr bool sorted_keys = true;
+
   template <class T, class = void>
   struct has_from_flexbuf : std::false_type {};
 
@@ -43,14 +50,32 @@ struct Reader {
 
   rfl::Result<InputVarType> get_field(
       const std::string& _name, const InputObjectType& _obj) const noexcept {
+    const auto var = find_field(_name, _obj);
+    if (!var) {
+      return rfl::Error("Map does not contain any element called '" + _name +
+                        "'.");
+    }
+    return *var;
+  }
+
+  /// Uses binary search, because the keys are sorted.
+  static std::optional<InputVarType> find_field(
+      const std::string_view& _name, const InputObjectType& _obj) noexcept {
     const auto keys = _obj.Keys();
-    for (size_t i = 0; i < keys.size(); ++i) {
-      if (_name == keys[i].AsString().c_str()) {
-        return _obj.Values()[i];
+    size_t begin = 0;
+    size_t end = std::min(keys.size(), _obj.Values().size());
+    while (begin < end) {
+      const auto mid = begin + (end - begin) / 2;
+      const auto c = compare_key(keys[mid].AsKey(), _name);
+      if (c == 0) {
+        return _obj.Values()[mid];
+      } else if (c < 0) {
+        begin = mid + 1;
+      } else {
+        end = mid;
       }
     }
-    return rfl::Error("Map does not contain any element called '" + _name +
-                      "'.");
+    return std::nullopt;
   }
 
   bool is_empty(const InputVarType& _var) const noexcept {
@@ -63,7 +88,8 @@ struct Reader {
       if (!_var.IsString()) {
         return rfl::Error("Could not cast to string.");
       }
-      return std::string(_var.AsString().c_str());
+      const auto str = _var.AsString();
+      return std::string(str.c_str(), str.length());
     } else if constexpr (std::is_same<std::decay_t<T>, bool>()) {
       if (!_var.IsBool()) {
         return rfl::Error("Could not cast to boolean.");
@@ -94,7 +120,7 @@ struct Reader {
     const auto num_values = std::min(keys.size(), values.size());
 
     for (size_t i = 0; i < num_values; ++i) {
-      const auto ix = _fct(std::string_view(keys[i].AsString().c_str()));
+      const auto ix = _fct(std::string_view(keys[i].AsKey()));
       if (ix != -1) {
         f_arr[ix] = values[i];
       }
@@ -103,6 +129,47 @@ struct Reader {
     return f_arr;
   }
 
+  /// Matches the keys to the field names in a single pass, because both are
+  /// sorted.
+  template <size_t size>
+  std::array<std::optional<InputVarType>, size> to_fields_array_sorted(
+      const std::array<internal::IndexedName, size>& _names,
+      const InputObjectType& _obj) const noexcept {
+    std::array<std::optional<InputVarType>, size> f_arr;
+
+    const auto keys = _obj.Keys();
+    const auto values = _obj.Values();
+    const auto num_values = std::min(keys.size(), values.size());
+
+    size_t i = 0;
+    size_t j = 0;
+    while (i < num_values && j < size) {
+      const auto c = compare_key(keys[i].AsKey(), _names[j].name_);
+      if (c < 0) {
+        ++i;
+      } else if (c > 0) {
+        ++j;
+      } else {
+        f_arr[_names[j].ix_] = values[i];
+        ++i;
+        ++j;
+      }
+    }
+
+    return f_arr;
+  }
+
+  /// Returns a view into the underlying buffer, which is only valid as long
+  /// as the buffer is alive.
+  rfl::Result<std::string_view> to_string_view(
+      const InputVarType& _var) const noexcept {
+    if (!_var.IsString()) {
+      return rfl::Error("Could not cast to string.");
+    }
+    const auto str = _var.AsString();
+    return std::string_view(str.c_str(), str.length());
+  }
+
   rfl::Result<InputArrayType> to_array(
       const InputVarType& _var) const noexcept {
     // Necessary, because we write empty vectors as null.
@@ -115,6 +182,27 @@ struct Reader {
     return _var.AsVector();
   }
 
+  /// Calls _f(key, value) for every entry of the map, until _f returns
+  /// false. The keys are views into the underlying buffer and always come in
+  /// sorted order.
+  template <class F>
+  void for_each_entry(const InputObjectType& _obj,
+                      const F& _f) const noexcept {
+    const auto keys = _obj.Keys();
+    const auto values = _obj.Values();
+    const auto size = std::min(keys.size(), values.size());
+    for (size_t i = 0; i < size; ++i) {
+      if (!_f(std::string_view(keys[i].AsKey()), values[i])) {
+        return;
+      }
+    }
+  }
+
+  /// The number of entries in the map.
+  size_t object_size(const InputObjectType& _obj) const noexcept {
+    return _obj.size();
+  }
+
   std::vector<std::pair<std::string, InputVarType>> to_map(
       const InputObjectType& _obj) const noexcept {
     std::vector<std::pair<std::string, InputVarType>> m;
@@ -125,7 +213,7 @@ struct Reader {
 
     for (size_t i = 0; i < size; ++i) {
       m.emplace_back(
-          std::make_pair(std::string(keys[i].AsString().c_str()), values[i]));
+          std::make_pair(std::string(keys[i].AsKey()), values[i]));
     }
 
     return m;
@@ -143,6 +231,24 @@ struct Reader {
     return _var.AsMap();
   }
 
+  /// Calls _f(value) for every element of the vector, until _f returns
+  /// false.
+  template <class F>
+  void for_each_element(const InputArrayType& _arr,
+                        const F& _f) const noexcept {
+    const auto size = _arr.size();
+    for (size_t i = 0; i < size; ++i) {
+      if (!_f(_arr[i])) {
+        return;
+      }
+    }
+  }
+
+  /// The number of elements in the vector.
+  size_t array_size(const InputArrayType& _arr) const noexcept {
+    return _arr.size();
+  }
+
   std::vector<InputVarType> to_vec(const InputArrayType& _arr) const noexcept {
     const auto size = _arr.size();
     std::vector<InputVarType> vec;
@@ -161,6 +267,21 @@ struct Reader {
       return rfl::Error(e.what());
     }
   }
+
+ private:
+  /// Compares a key to _name in the same way strcmp would, without
+  /// determining the length of the key first.
+  static int compare_key(const char* _key,
+                         const std::string_view& _name) noexcept {
+    for (size_t i = 0; i < _name.size(); ++i) {
+      const auto k = static_cast<unsigned char>(_key[i]);
+      const auto n = static_cast<unsigned char>(_name[i]);
+      if (k != n) {
+        return k < n ? -1 : 1;
+      }
+    }
+    return _key[_name.size()] == '\0' ? 0 : 1;
+  }
 };
 
 }  // namespace flexbuf
@@ -0,0 +1,201 @@
+#ifndef FLEXBUF_VIEW_HPP_
+#define FLEXBUF_VIEW_HPP_
+
+#include <flatbuffers/flexbuffers.h>
+
+#include <cstddef>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <tuple>
+#include <type_traits>
+#include <vector>
+
+#include "rfl/Result.hpp"
+#include "rfl/flexbuf/Reader.hpp"
+#include "rfl/flexbuf/read.hpp"
+#include "rfl/internal/StringLiteral.hpp"
+#include "rfl/internal/find_index.hpp"
+#include "rfl/internal/has_fields.hpp"
+#include "rfl/named_tuple_t.hpp"
+#include "rfl/parsing/is_required.hpp"
+
+namespace rfl {
+namespace flexbuf {
+
+template <class T>
+class View;
+
+template <class T>
+class VectorView;
+
+/// Determines what is returned when a value of type T is accessed through a
+/// view. Strings are returned as std::string_view, structs and vectors as
+/// views. Everything else, including numeric vectors, is decoded.
+template <class T>
+struct view_of {
+  using Type = T;
+
+  static Result<Type> make(const Reader::InputVarType& _var) noexcept {
+    return read<T>(_var);
+  }
+};
+
+template <>
+struct view_of<std::string> {
+  using Type = std::string_view;
+
+  static Result<Type> make(const Reader::InputVarType& _var) noexcept {
+    return Reader().to_string_view(_var);
+  }
+};
+
+template <class T>
+struct view_of<std::optional<T>> {
+  using Type = std::optional<typename view_of<T>::Type>;
+
+  static Result<Type> make(const Reader::InputVarType& _var) noexcept {
+    if (_var.IsNull()) {
+      return Type();
+    }
+    const auto to_optional = [](auto&& _v) { return Type(std::move(_v)); };
+    return view_of<T>::make(_var).transform(to_optional);
+  }
+};
+
+template <class T>
+struct view_of<std::vector<T>> {
+  using Type = VectorView<T>;
+
+  static Result<Type> make(const Reader::InputVarType& _var) noexcept {
+    const auto to_view = [&](const auto& _vec) { return Type(_var, _vec); };
+    return Reader().to_array(_var).transform(to_view);
+  }
+};
+
+/// Numeric vectors are stored as blobs, which are not necessarily aligned, so
+/// they are copied out with a single memcpy instead.
+template <is_blob_element T>
+struct view_of<std::vector<T>> {
+  using Type = std::vector<T>;
+
+  static Result<Type> make(const Reader::InputVarType& _var) noexcept {
+    return read<Type>(_var);
+  }
+};
+
+template <class T>
+requires(std::is_class_v<T> && std::is_aggregate_v<T> &&
+         internal::has_fields<T>())
+struct view_of<T> {
+  using Type = View<T>;
+
+  static Result<Type> make(const Reader::InputVarType& _var) noexcept {
+    const auto to_view = [&](const auto& _obj) { return Type(_var, _obj); };
+    return Reader().to_object(_var).transform(to_view);
+  }
+};
+
+/// A non-owning view into a flexbuffer containing a T. Fields are only
+/// looked up and decoded when they are accessed, so you can access single
+/// fields of large buffers without parsing everything. The view is only
+/// valid as long as the underlying buffer is alive.
+template <class T>
+class View {
+ public:
+  using Fields = typename named_tuple_t<T>::Fields;
+  using InputObjectType = typename Reader::InputObjectType;
+  using InputVarType = typename Reader::InputVarType;
+
+  View(const InputVarType& _var, const InputObjectType& _obj)
+      : obj_(_obj), var_(_var) {}
+
+  ~View() = default;
+
+  /// Creates a view into a buffer.
+  static Result<View> from_bytes(const unsigned char* _bytes,
+                                 const size_t _size) noexcept {
+    const InputVarType root =
+        flexbuffers::GetRoot(reinterpret_cast<const uint8_t*>(_bytes), _size);
+    return view_of<T>::make(root);
+  }
+
+  /// Creates a view into a buffer.
+  static Result<View> from_bytes(
+      const std::vector<unsigned char>& _bytes) noexcept {
+    return from_bytes(_bytes.data(), _bytes.size());
+  }
+
+  /// Returns the field signified by _name. Strings are returned as
+  /// std::string_view, structs as View and vectors as VectorView. Everything
+  /// else is decoded.
+  template <internal::StringLiteral _name>
+  auto get() const noexcept {
+    using FieldType =
+        std::tuple_element_t<internal::find_index<_name, Fields>(), Fields>;
+    using ValueType = std::decay_t<typename FieldType::Type>;
+    using ResultType = Result<typename view_of<ValueType>::Type>;
+    const auto var = Reader::find_field(_name.string_view(), obj_);
+    if (!var) {
+      if constexpr (parsing::is_required<ValueType>()) {
+        return ResultType(
+            Error("Field named '" + _name.str() + "' not found!"));
+      } else {
+        return ResultType(typename view_of<ValueType>::Type());
+      }
+    }
+    return view_of<ValueType>::make(*var);
+  }
+
+  /// Decodes the entire object.
+  Result<T> read() const noexcept { return flexbuf::read<T>(var_); }
+
+ private:
+  /// The object the fields are looked up in.
+  InputObjectType obj_;
+
+  /// The underlying var.
+  InputVarType var_;
+};
+
+/// A non-owning view into a vector inside a flexbuffer. Elements are only
+/// decoded when they are accessed.
+template <class T>
+class VectorView {
+ public:
+  using InputArrayType = typename Reader::InputArrayType;
+  using InputVarType = typename Reader::InputVarType;
+
+  VectorView(const InputVarType& _var, const InputArrayType& _arr)
+      : arr_(_arr), var_(_var) {}
+
+  ~VectorView() = default;
+
+  /// Returns the element at position _i.
+  Result<typename view_of<T>::Type> get(const size_t _i) const noexcept {
+    if (_i >= size()) {
+      return Error("Index " + std::to_string(_i) + " is out of range.");
+    }
+    return view_of<T>::make(arr_[_i]);
+  }
+
+  /// The number of elements.
+  size_t size() const noexcept { return arr_.size(); }
+
+  /// Decodes the entire vector.
+  Result<std::vector<T>> read() const noexcept {
+    return flexbuf::read<std::vector<T>>(var_);
+  }
+
+ private:
+  /// The underlying vector.
+  InputArrayType arr_;
+
+  /// The underlying var.
+  InputVarType var_;
+};
+
+}  // namespace flexbuf
+}  // namespace rfl
+
+#endif
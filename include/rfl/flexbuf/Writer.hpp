@@ -3,64 +3,131 @@
 
 #include <flatbuffers/flexbuffers.h>
 
-#include <exception>
-#include <functional>
-#include <map>
-#include <optional>
-#include <sstream>
-#include <stdexcept>
+#include <cstddef>
 #include <string>
 #include <string_view>
 #include <type_traits>
-#include <vector>
 
-#include "rfl/Ref.hpp"
-#include "rfl/Result.hpp"
-#include "rfl/flexbuf/OutputArray.hpp"
-#include "rfl/flexbuf/OutputNull.hpp"
-#include "rfl/flexbuf/OutputObject.hpp"
-#include "rfl/flexbuf/OutputValue.hpp"
-#include "rfl/flexbuf/OutputVar.hpp"
+#include "rfl/always_false.hpp"
 
 namespace rfl {
 namespace flexbuf {
 
+/// Writes directly into the flexbuffers::Builder while the parser traverses
+/// the object, so no intermediate tree is built. Arrays and objects are
+/// started when they are created and ended when they are turned into a var.
 struct Writer {
-  using OutputArrayType = Ref<OutputArray>;
-  using OutputObjectType = Ref<OutputObject>;
-  using OutputVarType = Ref<OutputVar>;
-
-  Writer() {}
+  static constexpr bool streaming = true;
+
+  struct FlexbufOutputArray {
+    flexbuffers::Builder* fbb_;
+    size_t start_;
+    size_t size_;
+  };
+
+  struct FlexbufOutputObject {
+    flexbuffers::Builder* fbb_;
+    size_t start_;
+    size_t size_;
+  };
+
+  struct FlexbufOutputVar {
+    FlexbufOutputVar(const bool _null) : null_(_null) {}
+
+    /// We have to catch the edge case of an empty vector, because flexbuf
+    /// ignores empty vectors/maps. Starting a vector does not write anything,
+    /// so we can simply write null instead.
+    FlexbufOutputVar(const FlexbufOutputArray& _arr) : null_(false) {
+      if (_arr.size_ == 0) {
+        _arr.fbb_->Null();
+      } else {
+        _arr.fbb_->EndVector(_arr.start_, false, false);
+      }
+    }
+
+    FlexbufOutputVar(const FlexbufOutputObject& _obj) : null_(false) {
+      if (_obj.size_ == 0) {
+        _obj.fbb_->Null();
+      } else {
+        _obj.fbb_->EndMap(_obj.start_);
+      }
+    }
+
+    bool null_;
+  };
+
+  using OutputArrayType = FlexbufOutputArray;
+  using OutputObjectType = FlexbufOutputObject;
+  using OutputVarType = FlexbufOutputVar;
+
+  Writer(flexbuffers::Builder* _fbb) : fbb_(_fbb) {}
 
   ~Writer() = default;
 
+  /// The element has already been written when this is called.
   void add(const OutputVarType& _var, OutputArrayType* _arr) const noexcept {
-    (*_arr)->push_back(_var);
+    ++_arr->size_;
   }
 
-  OutputVarType empty_var() const noexcept { return Ref<OutputNull>::make(); }
+  /// Must be called before the value of the field is written.
+  void add_key(const std::string_view& _name,
+               OutputObjectType* _obj) const noexcept {
+    fbb_->Key(_name.data(), _name.size());
+    ++_obj->size_;
+  }
+
+  OutputVarType empty_var() const noexcept {
+    fbb_->Null();
+    return OutputVarType(true);
+  }
 
   template <class T>
   OutputVarType from_basic_type(const T& _var) const noexcept {
-    return Ref<OutputValue<T>>::make(_var);
+    if constexpr (std::is_same<std::decay_t<T>, std::string>()) {
+      fbb_->String(_var);
+    } else if constexpr (std::is_same<std::decay_t<T>, bool>()) {
+      fbb_->Bool(_var);
+    } else if constexpr (std::is_floating_point<std::decay_t<T>>()) {
+      fbb_->Double(_var);
+    } else if constexpr (std::is_integral<std::decay_t<T>>()) {
+      fbb_->Int(_var);
+    } else {
+      static_assert(always_false_v<T>, "Unsupported type");
+    }
+    return OutputVarType(false);
+  }
+
+  OutputVarType from_string_view(const std::string_view _str) const noexcept {
+    fbb_->String(_str.data(), _str.size());
+    return OutputVarType(false);
+  }
+
+  /// Writes raw bytes as a blob.
+  OutputVarType from_blob(const void* _data,
+                          const size_t _size) const noexcept {
+    fbb_->Blob(_data, _size);
+    return OutputVarType(false);
   }
 
   OutputArrayType new_array() const noexcept {
-    return Ref<OutputArray>::make();
+    return OutputArrayType{fbb_, fbb_->StartVector(), 0};
   }
 
   OutputObjectType new_object() const noexcept {
-    return Ref<OutputObject>::make();
+    return OutputObjectType{fbb_, fbb_->StartMap(), 0};
   }
 
   bool is_empty(const OutputVarType& _var) const noexcept {
-    return _var->is_null();
+    return _var.null_;
   }
 
+  /// Never called, because the keys are added using add_key(...).
   void set_field(const std::string& _name, const OutputVarType& _var,
-                 OutputObjectType* _obj) const noexcept {
-    (*_obj)->push_back(_name, _var);
-  }
+                 OutputObjectType* _obj) const noexcept {}
+
+ private:
+  /// The builder everything is written into.
+  flexbuffers::Builder* fbb_;
 };
 
 }  // namespace flexbuf
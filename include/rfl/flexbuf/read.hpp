@@ -3,10 +3,12 @@
 
 #include <flatbuffers/flexbuffers.h>
 
+#include <memory_resource>
 #include <vector>
 
 #include "rfl/Result.hpp"
 #include "rfl/flexbuf/Parser.hpp"
+#include "rfl/parsing/ReaderWithResource.hpp"
 
 namespace rfl {
 namespace flexbuf {
@@ -34,6 +36,35 @@ Result<T> read(const std::vector<unsigned char>& _bytes) {
   return read<T>(_bytes.data(), _bytes.size());
 }
 
+/// Parses an object from flexbuf var. Containers and strings with polymorphic
+/// allocators, like std::pmr::vector or std::pmr::string, are allocated from
+/// _resource.
+template <class T>
+Result<T> read(const InputVarType& _obj,
+               std::pmr::memory_resource* _resource) {
+  using ReaderType = parsing::ReaderWithResource<Reader>;
+  const auto r = ReaderType(Reader(), _resource);
+  return parsing::Parser<ReaderType, Writer, T>::read(r, _obj);
+}
+
+/// Parses an object from flexbuf using reflection. Containers and strings
+/// with polymorphic allocators are allocated from _resource.
+template <class T>
+Result<T> read(const unsigned char* _bytes, const size_t _size,
+               std::pmr::memory_resource* _resource) {
+  const InputVarType root =
+      flexbuffers::GetRoot(reinterpret_cast<const uint8_t*>(_bytes), _size);
+  return read<T>(root, _resource);
+}
+
+/// Parses an object from flexbuf using reflection. Containers and strings
+/// with polymorphic allocators are allocated from _resource.
+template <class T>
+Result<T> read(const std::vector<unsigned char>& _bytes,
+               std::pmr::memory_resource* _resource) {
+  return read<T>(_bytes.data(), _bytes.size(), _resource);
+}
+
 }  // namespace flexbuf
 }  // namespace rfl
 
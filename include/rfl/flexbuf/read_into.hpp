@@ -0,0 +1,44 @@
+#ifndef FLEXBUF_READ_INTO_HPP_
+#define FLEXBUF_READ_INTO_HPP_
+
+#include <flatbuffers/flexbuffers.h>
+
+#include <vector>
+
+#include "rfl/Result.hpp"
+#include "rfl/flexbuf/Parser.hpp"
+#include "rfl/flexbuf/Reader.hpp"
+#include "rfl/flexbuf/Writer.hpp"
+#include "rfl/parsing/InPlaceParser.hpp"
+
+namespace rfl {
+namespace flexbuf {
+
+/// Parses a flexbuf var into an existing object. Strings and containers that
+/// already exist in _obj are overwritten in place, so their capacity is
+/// reused. If an error occurs, _obj may be partially overwritten.
+template <class T>
+Result<Nothing> read_into(T& _obj, const Reader::InputVarType& _var) {
+  const auto r = Reader();
+  return parsing::InPlaceParser<Reader, Writer, T>::read(r, _var, &_obj);
+}
+
+/// Parses flexbuf into an existing object using reflection.
+template <class T>
+Result<Nothing> read_into(T& _obj, const unsigned char* _bytes,
+                          const size_t _size) {
+  const Reader::InputVarType root =
+      flexbuffers::GetRoot(reinterpret_cast<const uint8_t*>(_bytes), _size);
+  return read_into(_obj, root);
+}
+
+/// Parses flexbuf into an existing object using reflection.
+template <class T>
+Result<Nothing> read_into(T& _obj, const std::vector<unsigned char>& _bytes) {
+  return read_into(_obj, _bytes.data(), _bytes.size());
+}
+
+}  // namespace flexbuf
+}  // namespace rfl
+
+#endif
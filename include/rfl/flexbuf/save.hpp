@@ -13,8 +13,10 @@ namespace rfl {
 namespace flexbuf {
 
 template <class T>
-Result<Nothing> save(const std::string& _fname, const T& _obj) {
-  return rfl::io::save_bytes(_fname, write(_obj));
+Result<Nothing> save(const std::string& _fname, const T& _obj,
+                     const flexbuffers::BuilderFlag _flags =
+                         flexbuffers::BUILDER_FLAG_SHARE_KEYS) {
+  return rfl::io::save_bytes(_fname, write(_obj, _flags));
 }
 
 }  // namespace flexbuf
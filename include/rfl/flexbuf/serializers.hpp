@@ -0,0 +1,41 @@
+#ifndef FLEXBUF_SERIALIZERS_HPP_
+#define FLEXBUF_SERIALIZERS_HPP_
+
+#include <flatbuffers/flexbuffers.h>
+
+#include <cstddef>
+#include <memory_resource>
+#include <vector>
+
+#include "rfl/flexbuf/read.hpp"
+#include "rfl/flexbuf/write.hpp"
+#include "rfl/serializers.hpp"
+
+/// The flexbuf serializers, for use by RFL_DECLARE_SERIALIZERS and
+/// RFL_DEFINE_SERIALIZERS.
+#define RFL_SERIALIZERS_flexbuf(_extern, T)                                    \
+  _extern template rfl::Result<T> rfl::flexbuf::read<T>(                       \
+      const rfl::flexbuf::InputVarType&);                                      \
+  _extern template rfl::Result<T> rfl::flexbuf::read<T>(                       \
+      const unsigned char*, const size_t);                                     \
+  _extern template rfl::Result<T> rfl::flexbuf::read<T>(                       \
+      const std::vector<unsigned char>&);                                      \
+  _extern template rfl::Result<T> rfl::flexbuf::read<T>(                       \
+      const rfl::flexbuf::InputVarType&, std::pmr::memory_resource*);          \
+  _extern template rfl::Result<T> rfl::flexbuf::read<T>(                       \
+      const unsigned char*, const size_t, std::pmr::memory_resource*);         \
+  _extern template rfl::Result<T> rfl::flexbuf::read<T>(                       \
+      const std::vector<unsigned char>&, std::pmr::memory_resource*);          \
+  _extern template const std::vector<uint8_t>& rfl::flexbuf::write<T>(         \
+      const T&, flexbuffers::Builder*);                                        \
+  _extern template std::vector<unsigned char> rfl::flexbuf::write<T>(          \
+      const T&, const flexbuffers::BuilderFlag);
+
+/// Ordinary overloads of write, see RFL_DECLARE_SERIALIZERS.
+#define RFL_SERIALIZER_OVERLOADS_flexbuf(T, _body)                             \
+  namespace rfl::flexbuf {                                                     \
+  std::vector<unsigned char> write(const T& _obj)                              \
+      _body({ return write<T>(_obj); })                                        \
+  }
+
+#endif
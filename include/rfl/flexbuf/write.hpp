@@ -4,7 +4,7 @@
 #include <flatbuffers/flexbuffers.h>
 
 #include <cstddef>
-#include <sstream>
+#include <cstdint>
 #include <vector>
 
 #include "rfl/flexbuf/Parser.hpp"
@@ -12,15 +12,28 @@
 namespace rfl {
 namespace flexbuf {
 
-/// Writes an object to flexbuf.
+/// Writes an object into a builder owned by the caller. The builder is
+/// cleared first, so the same builder can be reused for many objects without
+/// reallocating its buffer. The result is the builder's own buffer, so it is
+/// not copied, but it is only valid until the builder is modified.
 template <class T>
-std::vector<unsigned char> write(const T& _obj) {
-  auto w = Writer();
-  const auto flexbuf_obj = Parser<T>::write(w, _obj);
-  flexbuffers::Builder fbb;
-  flexbuf_obj->insert(std::nullopt, &fbb);
-  fbb.Finish();
-  const auto vec = fbb.GetBuffer();
+const std::vector<uint8_t>& write(const T& _obj, flexbuffers::Builder* _fbb) {
+  _fbb->Clear();
+  const auto w = Writer(_fbb);
+  Parser<T>::write(w, _obj);
+  _fbb->Finish();
+  return _fbb->GetBuffer();
+}
+
+/// Writes an object to flexbuf. Pass
+/// flexbuffers::BUILDER_FLAG_SHARE_KEYS_AND_STRINGS to deduplicate repeated
+/// strings as well as keys.
+template <class T>
+std::vector<unsigned char> write(const T& _obj,
+                                 const flexbuffers::BuilderFlag _flags =
+                                     flexbuffers::BUILDER_FLAG_SHARE_KEYS) {
+  flexbuffers::Builder fbb(256, _flags);
+  const auto& vec = write(_obj, &fbb);
   const auto data = reinterpret_cast<const unsigned char*>(vec.data());
   return std::vector<unsigned char>(data, data + vec.size());
 }
@@ -0,0 +1,89 @@
+#ifndef RFL_FROM_COLUMNS_HPP_
+#define RFL_FROM_COLUMNS_HPP_
+
+#include <array>
+#include <string>
+#include <string_view>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "rfl/Result.hpp"
+#include "rfl/columns_t.hpp"
+#include "rfl/from_named_tuple.hpp"
+#include "rfl/get.hpp"
+#include "rfl/internal/is_named_tuple.hpp"
+#include "rfl/named_tuple_t.hpp"
+
+namespace rfl {
+namespace internal {
+
+/// Makes sure that all columns have the same number of rows.
+template <class ColumnsType, size_t... _is>
+Result<size_t> get_num_rows(const ColumnsType& _columns,
+                            std::index_sequence<_is...>) noexcept {
+  using Fields = typename ColumnsType::Fields;
+  const auto sizes = std::array<size_t, sizeof...(_is)>(
+      {rfl::get<_is>(_columns).size()...});
+  const auto names = std::array<std::string_view, sizeof...(_is)>(
+      {std::tuple_element_t<_is, Fields>::name_.string_view()...});
+  for (size_t i = 1; i < sizes.size(); ++i) {
+    if (sizes[i] != sizes[0]) {
+      return Error("Could not build from columns: Column '" +
+                   std::string(names[0]) + "' has " +
+                   std::to_string(sizes[0]) + " rows, but column '" +
+                   std::string(names[i]) + "' has " +
+                   std::to_string(sizes[i]) + " rows.");
+    }
+  }
+  return sizes.size() == 0 ? size_t(0) : sizes[0];
+}
+
+template <class T, class ColumnsType, size_t... _is>
+std::vector<T> from_columns(ColumnsType&& _columns, const size_t _num_rows,
+                            std::index_sequence<_is...>) {
+  using NamedTupleType = named_tuple_t<T>;
+  std::vector<T> vec;
+  vec.reserve(_num_rows);
+  for (size_t i = 0; i < _num_rows; ++i) {
+    auto named_tuple = [&]() {
+      if constexpr (std::is_lvalue_reference<ColumnsType>{}) {
+        return NamedTupleType(rfl::get<_is>(_columns)[i]...);
+      } else {
+        return NamedTupleType(std::move(rfl::get<_is>(_columns)[i])...);
+      }
+    }();
+    if constexpr (is_named_tuple_v<T>) {
+      vec.emplace_back(std::move(named_tuple));
+    } else {
+      vec.emplace_back(from_named_tuple<T>(std::move(named_tuple)));
+    }
+  }
+  return vec;
+}
+
+}  // namespace internal
+
+/// Turns a named tuple containing one vector per field, as returned by
+/// to_columns(...), back into a vector of structs. Returns an error, if the
+/// columns are of different lengths.
+template <class T, class ColumnsType>
+Result<std::vector<T>> from_columns(ColumnsType&& _columns) {
+  static_assert(std::is_same<std::decay_t<ColumnsType>, columns_t<T>>(),
+                "The columns do not match the fields of T.");
+  constexpr auto num_columns =
+      std::tuple_size_v<typename std::decay_t<ColumnsType>::Fields>;
+  const auto to_vec = [&](const size_t _num_rows) {
+    return internal::from_columns<T>(std::forward<ColumnsType>(_columns),
+                                     _num_rows,
+                                     std::make_index_sequence<num_columns>());
+  };
+  return internal::get_num_rows(_columns,
+                                std::make_index_sequence<num_columns>())
+      .transform(to_vec);
+}
+
+}  // namespace rfl
+
+#endif
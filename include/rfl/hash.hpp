@@ -0,0 +1,242 @@
+#ifndef RFL_HASH_HPP_
+#define RFL_HASH_HPP_
+
+#include <cstddef>
+#include <functional>
+#include <memory>
+#include <optional>
+#include <ranges>
+#include <string>
+#include <string_view>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+#include <variant>
+
+#include "rfl/Box.hpp"
+#include "rfl/Field.hpp"
+#include "rfl/Flatten.hpp"
+#include "rfl/Literal.hpp"
+#include "rfl/NamedTuple.hpp"
+#include "rfl/ObjectMap.hpp"
+#include "rfl/Ref.hpp"
+#include "rfl/TaggedUnion.hpp"
+#include "rfl/Variant.hpp"
+#include "rfl/internal/has_fields.hpp"
+#include "rfl/internal/has_reflection_method_v.hpp"
+#include "rfl/internal/hash_combine.hpp"
+#include "rfl/internal/is_unordered_container.hpp"
+#include "rfl/internal/to_ptr_field_tuple.hpp"
+#include "rfl/internal/to_ptr_tuple.hpp"
+
+namespace rfl {
+
+/// Hashes an object using reflection. Can be used as the hasher of
+/// std::unordered_map or std::unordered_set. Two objects that are considered
+/// equal by rfl::Equal always have the same hash.
+template <class T>
+struct Hash;
+
+/// Hashes an object using reflection.
+template <class T>
+size_t hash(const T& _t) noexcept {
+  return Hash<std::remove_cvref_t<T>>{}(_t);
+}
+
+namespace internal {
+
+/// Hashes the pointers contained in a tuple generated by to_ptr_field_tuple
+/// or to_ptr_tuple.
+template <int _i = 0, class PtrTupleType>
+size_t hash_ptr_tuple(const PtrTupleType& _tup,
+                      const size_t _seed = 0) noexcept {
+  if constexpr (_i == std::tuple_size_v<PtrTupleType>) {
+    return _seed;
+  } else {
+    using PtrType = std::tuple_element_t<_i, PtrTupleType>;
+    const auto h = [&]() {
+      if constexpr (is_field_v<PtrType> || is_flatten_field_v<PtrType>) {
+        return hash(*std::get<_i>(_tup).get());
+      } else {
+        return hash(*std::get<_i>(_tup));
+      }
+    }();
+    return hash_ptr_tuple<_i + 1>(_tup, hash_combine(_seed, h));
+  }
+}
+
+/// Hashes everything that can be iterated over.
+template <class RangeType>
+size_t hash_range(const RangeType& _r) noexcept {
+  using ValueType = std::remove_cvref_t<std::ranges::range_value_t<RangeType>>;
+  if constexpr (std::ranges::contiguous_range<RangeType> &&
+                std::has_unique_object_representations_v<ValueType>) {
+    // If equality is identical to bitwise equality, we can hash in bulk.
+    const auto size = std::ranges::size(_r);
+    const auto bytes =
+        std::string_view(reinterpret_cast<const char*>(std::ranges::data(_r)),
+                         size * sizeof(ValueType));
+    return hash_combine(size, std::hash<std::string_view>{}(bytes));
+  } else if constexpr (is_unordered_container<RangeType>) {
+    // The iteration order of unordered containers is unspecified, so the
+    // element hashes must be combined in an order-independent way.
+    size_t h = 0;
+    size_t size = 0;
+    for (const auto& v : _r) {
+      h += hash_mix(hash(v));
+      ++size;
+    }
+    return hash_combine(size, h);
+  } else {
+    size_t h = 0;
+    size_t size = 0;
+    for (const auto& v : _r) {
+      h = hash_combine(h, hash(v));
+      ++size;
+    }
+    return hash_combine(size, h);
+  }
+}
+
+}  // namespace internal
+
+/// Default case - basic types, structs and containers.
+template <class T>
+struct Hash {
+  size_t operator()(const T& _t) const noexcept {
+    if constexpr (std::is_integral_v<T> || std::is_enum_v<T>) {
+      return std::hash<T>{}(_t);
+    } else if constexpr (std::is_floating_point_v<T>) {
+      // -0.0 == 0.0, so they must have the same hash.
+      return std::hash<T>{}(_t == T(0) ? T(0) : _t);
+    } else if constexpr (std::is_same<T, std::string>()) {
+      return std::hash<std::string>{}(_t);
+    } else if constexpr (internal::has_reflection_method_v<T>) {
+      return hash(_t.reflection());
+    } else if constexpr (std::ranges::range<T>) {
+      return internal::hash_range(_t);
+    } else if constexpr (std::is_class_v<T> && std::is_aggregate_v<T>) {
+      if constexpr (internal::has_fields<T>()) {
+        return internal::hash_ptr_tuple(internal::to_ptr_field_tuple(_t));
+      } else {
+        return internal::hash_ptr_tuple(internal::to_ptr_tuple(_t));
+      }
+    } else {
+      return std::hash<T>{}(_t);
+    }
+  }
+};
+
+template <class T>
+struct Hash<Box<T>> {
+  size_t operator()(const Box<T>& _b) const noexcept { return hash(*_b); }
+};
+
+template <internal::StringLiteral _name, class T>
+struct Hash<Field<_name, T>> {
+  size_t operator()(const Field<_name, T>& _f) const noexcept {
+    return hash(_f.value());
+  }
+};
+
+template <class T>
+struct Hash<Flatten<T>> {
+  size_t operator()(const Flatten<T>& _f) const noexcept {
+    return hash(_f.get());
+  }
+};
+
+template <internal::StringLiteral... _fields>
+struct Hash<Literal<_fields...>> {
+  size_t operator()(const Literal<_fields...>& _l) const noexcept {
+    return hash(_l.value());
+  }
+};
+
+template <class T>
+struct Hash<ObjectMap<T>> {
+  size_t operator()(const ObjectMap<T>& _m) const noexcept {
+    return hash(_m.get());
+  }
+};
+
+template <class... FieldTypes>
+struct Hash<NamedTuple<FieldTypes...>> {
+  size_t operator()(const NamedTuple<FieldTypes...>& _nt) const noexcept {
+    return hash(_nt.values());
+  }
+};
+
+template <class T>
+struct Hash<std::optional<T>> {
+  size_t operator()(const std::optional<T>& _o) const noexcept {
+    return _o ? internal::hash_combine(1, hash(*_o)) : 0;
+  }
+};
+
+template <class T1, class T2>
+struct Hash<std::pair<T1, T2>> {
+  size_t operator()(const std::pair<T1, T2>& _p) const noexcept {
+    return internal::hash_combine(hash(_p.first), hash(_p.second));
+  }
+};
+
+template <class T>
+struct Hash<Ref<T>> {
+  size_t operator()(const Ref<T>& _r) const noexcept { return hash(*_r); }
+};
+
+template <class T>
+struct Hash<std::shared_ptr<T>> {
+  size_t operator()(const std::shared_ptr<T>& _p) const noexcept {
+    return _p ? internal::hash_combine(1, hash(*_p)) : 0;
+  }
+};
+
+template <internal::StringLiteral _discriminator, class... NamedTupleTypes>
+struct Hash<TaggedUnion<_discriminator, NamedTupleTypes...>> {
+  size_t operator()(const TaggedUnion<_discriminator, NamedTupleTypes...>& _t)
+      const noexcept {
+    return hash(_t.variant());
+  }
+};
+
+template <class... Ts>
+struct Hash<std::tuple<Ts...>> {
+  size_t operator()(const std::tuple<Ts...>& _tup) const noexcept {
+    const auto hash_all = [](const auto&... _ts) {
+      size_t h = 0;
+      ((h = internal::hash_combine(h, hash(_ts))), ...);
+      return h;
+    };
+    return std::apply(hash_all, _tup);
+  }
+};
+
+template <class T>
+struct Hash<std::unique_ptr<T>> {
+  size_t operator()(const std::unique_ptr<T>& _p) const noexcept {
+    return _p ? internal::hash_combine(1, hash(*_p)) : 0;
+  }
+};
+
+template <class... AlternativeTypes>
+struct Hash<Variant<AlternativeTypes...>> {
+  size_t operator()(const Variant<AlternativeTypes...>& _v) const noexcept {
+    return hash(_v.variant());
+  }
+};
+
+template <class... AlternativeTypes>
+struct Hash<std::variant<AlternativeTypes...>> {
+  size_t operator()(
+      const std::variant<AlternativeTypes...>& _v) const noexcept {
+    const auto hash_alternative = [](const auto& _t) { return hash(_t); };
+    return internal::hash_combine(_v.index(),
+                                  std::visit(hash_alternative, _v));
+  }
+};
+
+}  // namespace rfl
+
+#endif
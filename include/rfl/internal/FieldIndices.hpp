@@ -0,0 +1,36 @@
+#ifndef RFL_INTERNAL_FIELDINDICES_HPP_
+#define RFL_INTERNAL_FIELDINDICES_HPP_
+
+#include <cstdint>
+#include <string_view>
+#include <unordered_map>
+
+#include "rfl/internal/Memoization.hpp"
+#include "rfl/internal/StringLiteral.hpp"
+
+namespace rfl {
+namespace internal {
+
+/// Maps each of the field names to an index signifying their order. The
+/// table only depends on the names, so it is shared by all formats and by
+/// named tuples of values and of pointers.
+template <StringLiteral... _names>
+struct FieldIndices {
+  using MapType = std::unordered_map<std::string_view, std::int16_t>;
+
+  /// Uses a memoization pattern to build the table on first use.
+  static const MapType& get() noexcept {
+    return indices_.value([](MapType* _indices) {
+      std::int16_t i = 0;
+      (((*_indices)[_names.string_view()] = i++), ...);
+    });
+  }
+
+ private:
+  static inline Memoization<MapType> indices_;
+};
+
+}  // namespace internal
+}  // namespace rfl
+
+#endif
@@ -1,18 +1,109 @@
 #ifndef RFL_INTERNAL_HASVALIDATION_HPP_
 #define RFL_INTERNAL_HASVALIDATION_HPP_
 
+#include <concepts>
+#include <cstddef>
+#include <span>
 #include <type_traits>
+#include <utility>
 
 #include "rfl/Result.hpp"
 
 namespace rfl {
 namespace internal {
 
+/// Validators check the value in place and return Nothing on success.
 template <class Class, typename T>
-concept HasValidation = requires(Class obj, T value) {
+concept HasCheck = requires(const T& value) {
+  { Class::check(value) } -> std::same_as<rfl::Result<Nothing>>;
+};
+
+/// Validators written against the older protocol return the validated value,
+/// which requires a copy.
+template <class Class, typename T>
+concept HasValidate = requires(Class obj, T value) {
   { Class::validate(value) } -> std::same_as<rfl::Result<T>>;
 };
 
+template <class Class, typename T>
+concept HasValidation = HasCheck<Class, T> || HasValidate<Class, T>;
+
+/// Checks _value using the validator V without copying it, unless V only
+/// supports the older protocol.
+template <class V, class T>
+requires HasValidation<V, T>
+Result<Nothing> check_value(const T& _value) noexcept {
+  if constexpr (HasCheck<V, T>) {
+    return V::check(_value);
+  } else {
+    return V::validate(_value).transform([](auto&&) { return Nothing{}; });
+  }
+}
+
+/// Implements the older validate protocol on top of check, so that code
+/// calling validate directly keeps working.
+template <class V, class T>
+Result<T> validate_by_check(T _value) noexcept {
+  return V::check(_value).transform([&](auto&&) { return std::move(_value); });
+}
+
+/// Validators can build expensive state, like compiled regexes, ahead of
+/// time in an optional static prepare() function, which is called by
+/// rfl::prepare.
+template <class V>
+void prepare_validator() {
+  if constexpr (requires { V::prepare(); }) {
+    V::prepare();
+  }
+}
+
+/// Validators may also check an entire range at once. check_all returns true
+/// only if every value passes. A return value of false means that at least
+/// one value might not, so the values need to be checked individually.
+template <class Class, typename T>
+concept HasBatchCheck = requires(const std::span<const T>& values) {
+  { Class::check_all(values) } -> std::same_as<bool>;
+};
+
+/// Checks all _values using the validator V, in a single pass if V supports
+/// it.
+template <class V, class T>
+requires HasValidation<V, T>
+bool check_all(const std::span<const T>& _values) noexcept {
+  if constexpr (HasBatchCheck<V, T>) {
+    return V::check_all(_values);
+  } else {
+    for (const auto& v : _values) {
+      if (!check_value<V>(v)) {
+        return false;
+      }
+    }
+    return true;
+  }
+}
+
+/// Validators whose check is a simple comparison can also expose it as a
+/// predicate that returns true for values that fail. AllOf and AnyOf combine
+/// these predicates, so that all of their validators share a single loop.
+template <class Class, typename T>
+concept HasFailPredicate = requires(const T& value) {
+  { Class::fails(value) } -> std::same_as<bool>;
+};
+
+/// Whether _pred is false for every value. The loop has neither an early exit
+/// nor a branch. This makes it a candidate for auto-vectorization, which GCC,
+/// for instance, only performs at -O3 or with -ftree-loop-vectorize. Whether
+/// it happens depends on the compiler and the predicate; it is not guaranteed.
+template <class T, class Pred>
+bool none_of_values(const std::span<const T>& _values,
+                    const Pred& _pred) noexcept {
+  int any = 0;
+  for (size_t i = 0; i < _values.size(); ++i) {
+    any |= static_cast<int>(_pred(_values[i]));
+  }
+  return any == 0;
+}
+
 }  // namespace internal
 }  // namespace rfl
 
@@ -0,0 +1,180 @@
+#ifndef RFL_INTERNAL_PREPARER_HPP_
+#define RFL_INTERNAL_PREPARER_HPP_
+
+#include <memory>
+#include <optional>
+#include <tuple>
+#include <type_traits>
+#include <unordered_set>
+#include <utility>
+#include <variant>
+
+#include "rfl/Box.hpp"
+#include "rfl/NamedTuple.hpp"
+#include "rfl/ObjectMap.hpp"
+#include "rfl/Ref.hpp"
+#include "rfl/Result.hpp"
+#include "rfl/TaggedUnion.hpp"
+#include "rfl/Validator.hpp"
+#include "rfl/Variant.hpp"
+#include "rfl/internal/FieldIndices.hpp"
+#include "rfl/internal/HasValidation.hpp"
+#include "rfl/internal/has_fields.hpp"
+#include "rfl/internal/has_reflection_type_v.hpp"
+#include "rfl/internal/is_basic_type.hpp"
+#include "rfl/internal/tuple_t.hpp"
+#include "rfl/named_tuple_t.hpp"
+
+namespace rfl {
+namespace internal {
+
+/// The types that have already been prepared, so recursive types like
+/// trees are only visited once.
+using PreparedTypes = std::unordered_set<const void*>;
+
+/// Has a distinct address for every type.
+template <class T>
+inline constexpr char type_tag = 0;
+
+template <class T>
+struct Preparer;
+
+/// Prepares T, unless it has already been prepared.
+template <class T>
+void prepare_type(PreparedTypes* _prepared) {
+  using Type = std::remove_cvref_t<T>;
+  if (_prepared->insert(&type_tag<Type>).second) {
+    Preparer<Type>::prepare(_prepared);
+  }
+}
+
+/// Default case - walks into the types the parser would read T as.
+template <class T>
+struct Preparer {
+  static void prepare(PreparedTypes* _prepared) {
+    if constexpr (has_reflection_type_v<T>) {
+      prepare_type<typename T::ReflectionType>(_prepared);
+    } else if constexpr (is_basic_type_v<T>) {
+      return;
+    } else if constexpr (std::is_pointer_v<T>) {
+      prepare_type<std::remove_pointer_t<T>>(_prepared);
+    } else if constexpr (requires { typename T::mapped_type; }) {
+      prepare_type<typename T::key_type>(_prepared);
+      prepare_type<typename T::mapped_type>(_prepared);
+    } else if constexpr (requires { typename T::value_type; }) {
+      prepare_type<typename T::value_type>(_prepared);
+    } else if constexpr (std::is_class_v<T> && std::is_aggregate_v<T>) {
+      if constexpr (has_fields<T>()) {
+        prepare_type<named_tuple_t<T>>(_prepared);
+      } else {
+        prepare_type<tuple_t<T>>(_prepared);
+      }
+    }
+  }
+};
+
+template <class... FieldTypes>
+struct Preparer<NamedTuple<FieldTypes...>> {
+  static void prepare(PreparedTypes* _prepared) {
+    FieldIndices<FieldTypes::name_...>::get();
+    (prepare_type<typename FieldTypes::Type>(_prepared), ...);
+  }
+};
+
+template <class T, class V>
+struct Preparer<Validator<T, V>> {
+  static void prepare(PreparedTypes* _prepared) {
+    prepare_validator<V>();
+    prepare_type<T>(_prepared);
+  }
+};
+
+template <class T>
+struct Preparer<ObjectMap<T>> {
+  static void prepare(PreparedTypes* _prepared) {
+    prepare_type<T>(_prepared);
+  }
+};
+
+template <class T>
+struct Preparer<std::optional<T>> {
+  static void prepare(PreparedTypes* _prepared) {
+    prepare_type<T>(_prepared);
+  }
+};
+
+template <class T>
+struct Preparer<std::unique_ptr<T>> {
+  static void prepare(PreparedTypes* _prepared) {
+    prepare_type<T>(_prepared);
+  }
+};
+
+template <class T>
+struct Preparer<std::shared_ptr<T>> {
+  static void prepare(PreparedTypes* _prepared) {
+    prepare_type<T>(_prepared);
+  }
+};
+
+template <class T>
+struct Preparer<Box<T>> {
+  static void prepare(PreparedTypes* _prepared) {
+    prepare_type<T>(_prepared);
+  }
+};
+
+template <class T>
+struct Preparer<Ref<T>> {
+  static void prepare(PreparedTypes* _prepared) {
+    prepare_type<T>(_prepared);
+  }
+};
+
+template <class T>
+struct Preparer<Result<T>> {
+  static void prepare(PreparedTypes* _prepared) {
+    prepare_type<T>(_prepared);
+  }
+};
+
+template <class FirstType, class SecondType>
+struct Preparer<std::pair<FirstType, SecondType>> {
+  static void prepare(PreparedTypes* _prepared) {
+    prepare_type<FirstType>(_prepared);
+    prepare_type<SecondType>(_prepared);
+  }
+};
+
+template <class... Ts>
+struct Preparer<std::tuple<Ts...>> {
+  static void prepare(PreparedTypes* _prepared) {
+    (prepare_type<Ts>(_prepared), ...);
+  }
+};
+
+template <class... AlternativeTypes>
+struct Preparer<std::variant<AlternativeTypes...>> {
+  static void prepare(PreparedTypes* _prepared) {
+    (prepare_type<AlternativeTypes>(_prepared), ...);
+  }
+};
+
+template <class... AlternativeTypes>
+struct Preparer<Variant<AlternativeTypes...>> {
+  static void prepare(PreparedTypes* _prepared) {
+    (prepare_type<AlternativeTypes>(_prepared), ...);
+  }
+};
+
+template <StringLiteral _discriminator, class... AlternativeTypes>
+struct Preparer<TaggedUnion<_discriminator, AlternativeTypes...>> {
+  static void prepare(PreparedTypes* _prepared) {
+    (prepare_type<AlternativeTypes>(_prepared), ...);
+  }
+};
+
+}  // namespace internal
+}  // namespace rfl
+
+#endif
@@ -0,0 +1,528 @@
+#ifndef RFL_INTERNAL_TIMESTAMPFORMAT_HPP_
+#define RFL_INTERNAL_TIMESTAMPFORMAT_HPP_
+
+#include <array>
+#include <charconv>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <ctime>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <utility>
+
+#include "rfl/internal/StringLiteral.hpp"
+
+namespace rfl {
+namespace internal {
+
+/// A single step of a timestamp format, such as a literal character or a
+/// number like the year or the month.
+struct TimestampToken {
+  enum class Kind {
+    literal,
+    space,
+    year,
+    year2,
+    month,
+    day,
+    day_space,
+    day_of_year,
+    hour,
+    minute,
+    second,
+    offset,
+    unsupported
+  };
+
+  Kind kind_;
+  char c_;
+};
+
+/// The broken-down fields of a timestamp while it is being parsed.
+struct TimestampFields {
+  int year_ = 1900;
+  int month_ = 1;
+  int day_ = 1;
+  int day_of_year_ = 0;
+  int hour_ = 0;
+  int minute_ = 0;
+  int second_ = 0;
+  int offset_ = 0;
+};
+
+/// Calls _f for every token in _format, expanding composite conversions like
+/// %F or %T into their parts.
+template <class F>
+constexpr void for_each_timestamp_token(const std::string_view _format,
+                                        const F& _f) {
+  using Kind = TimestampToken::Kind;
+  for (size_t i = 0; i < _format.size(); ++i) {
+    const char c = _format[i];
+    if (c == ' ') {
+      _f(TimestampToken{Kind::space, c});
+      continue;
+    }
+    if (c != '%' || i + 1 == _format.size()) {
+      _f(TimestampToken{Kind::literal, c});
+      continue;
+    }
+    switch (_format[++i]) {
+      case 'Y':
+        _f(TimestampToken{Kind::year, 0});
+        break;
+      case 'y':
+        _f(TimestampToken{Kind::year2, 0});
+        break;
+      case 'm':
+        _f(TimestampToken{Kind::month, 0});
+        break;
+      case 'd':
+        _f(TimestampToken{Kind::day, 0});
+        break;
+      case 'e':
+        _f(TimestampToken{Kind::day_space, 0});
+        break;
+      case 'j':
+        _f(TimestampToken{Kind::day_of_year, 0});
+        break;
+      case 'H':
+        _f(TimestampToken{Kind::hour, 0});
+        break;
+      case 'M':
+        _f(TimestampToken{Kind::minute, 0});
+        break;
+      case 'S':
+        _f(TimestampToken{Kind::second, 0});
+        break;
+      case 'z':
+        _f(TimestampToken{Kind::offset, 0});
+        break;
+      case 'n':
+        _f(TimestampToken{Kind::space, '\n'});
+        break;
+      case 't':
+        _f(TimestampToken{Kind::space, '\t'});
+        break;
+      case '%':
+        _f(TimestampToken{Kind::literal, '%'});
+        break;
+      case 'D':
+        for_each_timestamp_token("%m/%d/%y", _f);
+        break;
+      case 'F':
+        for_each_timestamp_token("%Y-%m-%d", _f);
+        break;
+      case 'R':
+        for_each_timestamp_token("%H:%M", _f);
+        break;
+      case 'T':
+        for_each_timestamp_token("%H:%M:%S", _f);
+        break;
+      default:
+        _f(TimestampToken{Kind::unsupported, 0});
+        break;
+    }
+  }
+}
+
+/// The maximum number of characters a token is formatted as.
+constexpr size_t max_timestamp_token_size(const TimestampToken::Kind _kind) {
+  using Kind = TimestampToken::Kind;
+  switch (_kind) {
+    case Kind::year:
+      return 6;
+    case Kind::day_of_year:
+      return 3;
+    case Kind::offset:
+      return 5;
+    case Kind::literal:
+    case Kind::space:
+      return 1;
+    default:
+      return 2;
+  }
+}
+
+/// Converts the broken-down fields to a point in time. Fields that are out of
+/// range are normalized, just like timegm does.
+inline std::chrono::sys_seconds fields_to_time_point(
+    const TimestampFields& _f) noexcept {
+  using namespace std::chrono;
+  const auto months = static_cast<std::int64_t>(_f.year_) * 12 + _f.month_ - 1;
+  const auto year_ix = months >= 0 ? months / 12 : (months - 11) / 12;
+  const auto month_ix = static_cast<unsigned>(months - year_ix * 12);
+  const auto first_of_month =
+      sys_days(year(static_cast<int>(year_ix)) / month(month_ix + 1) / 1);
+  const auto d = _f.day_of_year_ > 0
+                     ? sys_days(year(_f.year_) / January / 1) +
+                           days(_f.day_of_year_ - 1)
+                     : first_of_month + days(_f.day_ - 1);
+  return d + hours(_f.hour_) + minutes(_f.minute_) +
+         seconds(_f.second_ - _f.offset_);
+}
+
+/// Converts a std::tm to a point in time, interpreting it as UTC.
+inline std::chrono::sys_seconds tm_to_time_point(const std::tm& _tm) noexcept {
+  return fields_to_time_point(TimestampFields{.year_ = _tm.tm_year + 1900,
+                                              .month_ = _tm.tm_mon + 1,
+                                              .day_ = _tm.tm_mday,
+                                              .hour_ = _tm.tm_hour,
+                                              .minute_ = _tm.tm_min,
+                                              .second_ = _tm.tm_sec});
+}
+
+/// Converts a point in time to a std::tm in UTC.
+inline std::tm time_point_to_tm(
+    const std::chrono::sys_seconds& _time_point) noexcept {
+  using namespace std::chrono;
+  const auto d = floor<days>(_time_point);
+  const auto ymd = year_month_day(d);
+  const auto hms = hh_mm_ss<seconds>(_time_point - d);
+  const auto first_of_year = sys_days(ymd.year() / January / 1);
+  std::tm tm{};
+  tm.tm_year = static_cast<int>(ymd.year()) - 1900;
+  tm.tm_mon = static_cast<int>(static_cast<unsigned>(ymd.month())) - 1;
+  tm.tm_mday = static_cast<int>(static_cast<unsigned>(ymd.day()));
+  tm.tm_hour = static_cast<int>(hms.hours().count());
+  tm.tm_min = static_cast<int>(hms.minutes().count());
+  tm.tm_sec = static_cast<int>(hms.seconds().count());
+  tm.tm_wday = static_cast<int>(weekday(d).c_encoding());
+  tm.tm_yday = static_cast<int>((d - first_of_year).count());
+  return tm;
+}
+
+/// A timestamp format that is compiled at compile time. If the format only
+/// contains numeric conversions (%Y, %y, %m, %d, %e, %j, %H, %M, %S, %z and
+/// the composites %D, %F, %R and %T), timestamps are parsed and formatted by
+/// specialized code that neither depends on the locale nor allocates.
+/// Otherwise, strptime and strftime are used.
+template <StringLiteral _format>
+struct TimestampFormat {
+  using Kind = TimestampToken::Kind;
+
+  static constexpr std::string_view format_ =
+      std::string_view(_format.value_, sizeof(_format.value_) - 1);
+
+  static constexpr size_t num_tokens_ = [] {
+    size_t n = 0;
+    for_each_timestamp_token(format_, [&](const TimestampToken&) { ++n; });
+    return n;
+  }();
+
+  static constexpr std::array<TimestampToken, num_tokens_> tokens_ = [] {
+    std::array<TimestampToken, num_tokens_> tokens{};
+    size_t i = 0;
+    for_each_timestamp_token(
+        format_, [&](const TimestampToken& _t) { tokens[i++] = _t; });
+    return tokens;
+  }();
+
+  /// Whether the format can be handled without strptime and strftime.
+  static constexpr bool compiled_ = [] {
+    for (const auto& t : tokens_) {
+      if (t.kind_ == Kind::unsupported) {
+        return false;
+      }
+    }
+    return true;
+  }();
+
+  /// The maximum length of a formatted timestamp.
+  static constexpr size_t max_size_ = [] {
+    if (!compiled_) {
+      return size_t(200);
+    }
+    size_t n = 0;
+    for (const auto& t : tokens_) {
+      n += max_timestamp_token_size(t.kind_);
+    }
+    return n == 0 ? size_t(1) : n;
+  }();
+
+  /// The number of digits written by the fixed-width numbers starting at the
+  /// token _i, up to the first token that is not one of them.
+  static constexpr size_t fixed_digits_from(size_t _i) {
+    size_t n = 0;
+    for (; _i < num_tokens_; ++_i) {
+      switch (tokens_[_i].kind_) {
+        case Kind::year2:
+        case Kind::month:
+        case Kind::day:
+        case Kind::hour:
+        case Kind::minute:
+        case Kind::second:
+          n += 2;
+          break;
+        case Kind::day_of_year:
+          n += 3;
+          break;
+        default:
+          return n;
+      }
+    }
+    return n;
+  }
+
+  /// Parses _str, which must match the format entirely.
+  static std::optional<std::chrono::sys_seconds> parse(
+      const std::string& _str) noexcept {
+    if constexpr (compiled_) {
+      auto fields = TimestampFields{};
+      const char* ptr = _str.data();
+      const char* end = _str.data() + _str.size();
+      const bool success = parse_tokens(
+          &ptr, end, &fields, std::make_index_sequence<num_tokens_>());
+      if (!success || ptr != end) {
+        return std::nullopt;
+      }
+      return fields_to_time_point(fields);
+    } else {
+      std::tm tm{};
+      tm.tm_mday = 1;
+      const auto r = strptime(_str.c_str(), _format.value_, &tm);
+      if (r == NULL || *r != '\0') {
+        return std::nullopt;
+      }
+      return tm_to_time_point(tm);
+    }
+  }
+
+  /// Writes the timestamp into _buf, which must be at least max_size_ bytes
+  /// long, and returns the number of bytes written.
+  static size_t format(const std::chrono::sys_seconds& _time_point,
+                       char* _buf) noexcept {
+    if constexpr (compiled_) {
+      using namespace std::chrono;
+      const auto d = floor<days>(_time_point);
+      const auto ymd = year_month_day(d);
+      const auto hms = hh_mm_ss<seconds>(_time_point - d);
+      auto fields = TimestampFields{
+          .year_ = static_cast<int>(ymd.year()),
+          .month_ = static_cast<int>(static_cast<unsigned>(ymd.month())),
+          .day_ = static_cast<int>(static_cast<unsigned>(ymd.day())),
+          .day_of_year_ = static_cast<int>(
+              (d - sys_days(ymd.year() / January / 1)).count() + 1),
+          .hour_ = static_cast<int>(hms.hours().count()),
+          .minute_ = static_cast<int>(hms.minutes().count()),
+          .second_ = static_cast<int>(hms.seconds().count())};
+      char* ptr = _buf;
+      format_tokens(fields, &ptr, std::make_index_sequence<num_tokens_>());
+      return static_cast<size_t>(ptr - _buf);
+    } else {
+      const auto tm = time_point_to_tm(_time_point);
+      return strftime(_buf, max_size_, _format.value_, &tm);
+    }
+  }
+
+ private:
+  /// Reads between one and _max_digits digits.
+  template <int _max_digits>
+  static bool read_number(const char** _ptr, const char* _end,
+                          int* _value) noexcept {
+    const char* p = *_ptr;
+    int value = 0;
+    int i = 0;
+    for (; i < _max_digits && p != _end && *p >= '0' && *p <= '9'; ++i, ++p) {
+      value = value * 10 + (*p - '0');
+    }
+    *_ptr = p;
+    *_value = value;
+    return i != 0;
+  }
+
+  template <int _max_digits>
+  static bool read_number(const char** _ptr, const char* _end, const int _min,
+                          const int _max, int* _value) noexcept {
+    return read_number<_max_digits>(_ptr, _end, _value) && *_value >= _min &&
+           *_value <= _max;
+  }
+
+  /// Reads a year with an optional sign. Years are formatted with as many
+  /// digits as they need, so the year takes all of the digits, except for
+  /// those of the fixed-width numbers directly following it, as in %Y%m%d.
+  template <size_t _digits_after>
+  static bool read_year(const char** _ptr, const char* _end,
+                        int* _year) noexcept {
+    const bool negative = *_ptr != _end && **_ptr == '-';
+    const char* begin = *_ptr + (negative ? 1 : 0);
+    const char* p = begin;
+    while (p != _end && *p >= '0' && *p <= '9') {
+      ++p;
+    }
+    const auto num_digits =
+        (p - begin) - static_cast<std::ptrdiff_t>(_digits_after);
+    if (num_digits < 1 || num_digits > 5) {
+      return false;
+    }
+    int year = 0;
+    for (p = begin; p != begin + num_digits; ++p) {
+      year = year * 10 + (*p - '0');
+    }
+    if (year > static_cast<int>(std::chrono::year::max())) {
+      return false;
+    }
+    *_ptr = p;
+    *_year = negative ? -year : year;
+    return true;
+  }
+
+  static bool read_offset(const char** _ptr, const char* _end,
+                          int* _offset) noexcept {
+    const char* p = *_ptr;
+    if (p != _end && *p == 'Z') {
+      *_ptr = p + 1;
+      *_offset = 0;
+      return true;
+    }
+    if (p == _end || (*p != '+' && *p != '-')) {
+      return false;
+    }
+    const int sign = *p == '-' ? -1 : 1;
+    ++p;
+    int hours = 0;
+    int minutes = 0;
+    const char* begin = p;
+    if (!read_number<2>(&p, _end, &hours) || p - begin != 2) {
+      return false;
+    }
+    if (p != _end && *p == ':') {
+      ++p;
+    }
+    begin = p;
+    if (p != _end && read_number<2>(&p, _end, &minutes) && p - begin != 2) {
+      return false;
+    }
+    if (hours > 23 || minutes > 59) {
+      return false;
+    }
+    *_ptr = p;
+    *_offset = sign * (hours * 3600 + minutes * 60);
+    return true;
+  }
+
+  template <TimestampToken _token, size_t _digits_after>
+  static bool parse_token(const char** _ptr, const char* _end,
+                          TimestampFields* _fields) noexcept {
+    if constexpr (_token.kind_ == Kind::literal) {
+      if (*_ptr == _end || **_ptr != _token.c_) {
+        return false;
+      }
+      ++*_ptr;
+      return true;
+    } else if constexpr (_token.kind_ == Kind::space) {
+      while (*_ptr != _end && (**_ptr == ' ' || **_ptr == '\t' ||
+                               **_ptr == '\n' || **_ptr == '\r')) {
+        ++*_ptr;
+      }
+      return true;
+    } else if constexpr (_token.kind_ == Kind::year) {
+      return read_year<_digits_after>(_ptr, _end, &_fields->year_);
+    } else if constexpr (_token.kind_ == Kind::year2) {
+      if (!read_number<2>(_ptr, _end, &_fields->year_)) {
+        return false;
+      }
+      _fields->year_ += _fields->year_ < 69 ? 2000 : 1900;
+      return true;
+    } else if constexpr (_token.kind_ == Kind::month) {
+      return read_number<2>(_ptr, _end, 1, 12, &_fields->month_);
+    } else if constexpr (_token.kind_ == Kind::day) {
+      return read_number<2>(_ptr, _end, 1, 31, &_fields->day_);
+    } else if constexpr (_token.kind_ == Kind::day_space) {
+      *_ptr += (*_ptr != _end && **_ptr == ' ') ? 1 : 0;
+      return read_number<2>(_ptr, _end, 1, 31, &_fields->day_);
+    } else if constexpr (_token.kind_ == Kind::day_of_year) {
+      return read_number<3>(_ptr, _end, 1, 366, &_fields->day_of_year_);
+    } else if constexpr (_token.kind_ == Kind::hour) {
+      return read_number<2>(_ptr, _end, 0, 23, &_fields->hour_);
+    } else if constexpr (_token.kind_ == Kind::minute) {
+      return read_number<2>(_ptr, _end, 0, 59, &_fields->minute_);
+    } else if constexpr (_token.kind_ == Kind::second) {
+      return read_number<2>(_ptr, _end, 0, 60, &_fields->second_);
+    } else if constexpr (_token.kind_ == Kind::offset) {
+      return read_offset(_ptr, _end, &_fields->offset_);
+    } else {
+      return false;
+    }
+  }
+
+  template <size_t... _is>
+  static bool parse_tokens(const char** _ptr, const char* _end,
+                           TimestampFields* _fields,
+                           std::index_sequence<_is...>) noexcept {
+    return (parse_token<tokens_[_is], fixed_digits_from(_is + 1)>(
+                _ptr, _end, _fields) &&
+            ...);
+  }
+
+  /// Writes _value with exactly _digits digits.
+  template <int _digits>
+  static void write_number(int _value, const char _pad, char** _ptr) noexcept {
+    char* p = *_ptr + _digits;
+    for (int i = 0; i < _digits; ++i) {
+      *--p = static_cast<char>('0' + _value % 10);
+      _value /= 10;
+    }
+    if (_pad != '0') {
+      for (int i = 0; i < _digits - 1 && p[i] == '0'; ++i) {
+        p[i] = _pad;
+      }
+    }
+    *_ptr += _digits;
+  }
+
+  static void write_year(const int _year, char** _ptr) noexcept {
+    if (_year >= 1000 && _year <= 9999) {
+      write_number<4>(_year, '0', _ptr);
+      return;
+    }
+    // Just like strftime, other years are not padded. std::chrono::year
+    // ranges from -32767 to 32767, which read_year accepts as well.
+    *_ptr = std::to_chars(*_ptr, *_ptr + 6, _year).ptr;
+  }
+
+  template <TimestampToken _token>
+  static void format_token(const TimestampFields& _fields,
+                           char** _ptr) noexcept {
+    if constexpr (_token.kind_ == Kind::literal) {
+      *(*_ptr)++ = _token.c_;
+    } else if constexpr (_token.kind_ == Kind::space) {
+      *(*_ptr)++ = _token.c_;
+    } else if constexpr (_token.kind_ == Kind::year) {
+      write_year(_fields.year_, _ptr);
+    } else if constexpr (_token.kind_ == Kind::year2) {
+      write_number<2>(((_fields.year_ % 100) + 100) % 100, '0', _ptr);
+    } else if constexpr (_token.kind_ == Kind::month) {
+      write_number<2>(_fields.month_, '0', _ptr);
+    } else if constexpr (_token.kind_ == Kind::day) {
+      write_number<2>(_fields.day_, '0', _ptr);
+    } else if constexpr (_token.kind_ == Kind::day_space) {
+      write_number<2>(_fields.day_, ' ', _ptr);
+    } else if constexpr (_token.kind_ == Kind::day_of_year) {
+      write_number<3>(_fields.day_of_year_, '0', _ptr);
+    } else if constexpr (_token.kind_ == Kind::hour) {
+      write_number<2>(_fields.hour_, '0', _ptr);
+    } else if constexpr (_token.kind_ == Kind::minute) {
+      write_number<2>(_fields.minute_, '0', _ptr);
+    } else if constexpr (_token.kind_ == Kind::second) {
+      write_number<2>(_fields.second_, '0', _ptr);
+    } else if constexpr (_token.kind_ == Kind::offset) {
+      // Timestamps are always stored in UTC.
+      for (const char c : {'+', '0', '0', '0', '0'}) {
+        *(*_ptr)++ = c;
+      }
+    }
+  }
+
+  template <size_t... _is>
+  static void format_tokens(const TimestampFields& _fields, char** _ptr,
+                            std::index_sequence<_is...>) noexcept {
+    (format_token<tokens_[_is]>(_fields, _ptr), ...);
+  }
+};
+
+}  // namespace internal
+}  // namespace rfl
+
+#endif
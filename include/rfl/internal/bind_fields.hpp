@@ -0,0 +1,1132 @@
+#ifndef RFL_INTERNAL_BIND_FIELDS_HPP_
+#define RFL_INTERNAL_BIND_FIELDS_HPP_
+
+#include <type_traits>
+
+#include "rfl/always_false.hpp"
+#include "rfl/internal/has_n_fields.hpp"
+
+namespace rfl {
+namespace internal {
+
+/*The following boilerplate code was generated using a Python script:
+def make_field_template(num: int) -> str:
+    fields = ", ".join([f"f{i+1}" for i in range(num)])
+    return (
+        """
+  } else if constexpr (n == """
+        + str(num)
+        + """) {"""
+        + ("auto& [" + fields + "] = _t;" if num > 0 else "")
+        + """
+  return _f("""
+        + fields
+        + ");"
+    )
+
+code = "".join((make_field_template(i) for i in range(101)))
+
+with open("generated_code5.cpp", "w", encoding="utf-8") as codefile:
+    codefile.write(code)
+*/
+
+/// Binds the fields of the struct _t to a structured binding and calls _f
+/// with all of them. The fields are counted once, so only the branch
+/// matching the number of fields is ever instantiated. This is the only
+/// place where structs are decomposed - to_ptr_tuple, to_ptr_field_tuple,
+/// copy_to_field_tuple and move_to_field_tuple are built on top of it.
+template <class T, class F>
+auto bind_fields(T& _t, const F& _f) {
+  constexpr int n = num_fields<std::remove_cv_t<T>>;
+  if constexpr (n == 0) {
+    return _f();
+  } else if constexpr (n == 1) {
+    auto& [f1] = _t;
+    return _f(f1);
+  } else if constexpr (n == 2) {
+    auto& [f1, f2] = _t;
+    return _f(f1, f2);
+  } else if constexpr (n == 3) {
+    auto& [f1, f2, f3] = _t;
+    return _f(f1, f2, f3);
+  } else if constexpr (n == 4) {
+    auto& [f1, f2, f3, f4] = _t;
+    return _f(f1, f2, f3, f4);
+  } else if constexpr (n == 5) {
+    auto& [f1, f2, f3, f4, f5] = _t;
+    return _f(f1, f2, f3, f4, f5);
+  } else if constexpr (n == 6) {
+    auto& [f1, f2, f3, f4, f5, f6] = _t;
+    return _f(f1, f2, f3, f4, f5, f6);
+  } else if constexpr (n == 7) {
+    auto& [f1, f2, f3, f4, f5, f6, f7] = _t;
+    return _f(f1, f2, f3, f4, f5, f6, f7);
+  } else if constexpr (n == 8) {
+    auto& [f1, f2, f3, f4, f5, f6, f7, f8] = _t;
+    return _f(f1, f2, f3, f4, f5, f6, f7, f8);
+  } else if constexpr (n == 9) {
+    auto& [f1, f2, f3, f4, f5, f6, f7, f8, f9] = _t;
+    return _f(f1, f2, f3, f4, f5, f6, f7, f8, f9);
+  } else if constexpr (n == 10) {
+    auto& [f1, f2, f3, f4, f5, f6, f7, f8, f9, f10] = _t;
+    return _f(f1, f2, f3, f4, f5, f6, f7, f8, f9, f10);
+  } else if constexpr (n == 11) {
+    auto& [f1, f2, f3, f4, f5, f6, f7, f8, f9, f10, f11] = _t;
+    return _f(f1, f2, f3, f4, f5, f6, f7, f8, f9, f10, f11);
+  } else if constexpr (n == 12) {
+    auto& [f1, f2, f3, f4, f5, f6, f7, f8, f9, f10, f11, f12] = _t;
+    return _f(f1, f2, f3, f4, f5, f6, f7, f8, f9, f10, f11, f12);
+  } else if constexpr (n == 13) {
+    auto& [f1, f2, f3, f4, f5, f6, f7, f8, f9, f10, f11, f12, f13] = _t;
+    return _f(f1, f2, f3, f4, f5, f6, f7, f8, f9, f10, f11, f12, f13);
+  } else if constexpr (n == 14) {
+    auto& [f1, f2, f3, f4, f5, f6, f7, f8, f9, f10, f11, f12, f13, f14] = _t;
+    return _f(f1, f2, f3, f4, f5, f6, f7, f8, f9, f10, f11, f12, f13, f14);
+  } else if constexpr (n == 15) {
+    auto& [
+        f1, f2, f3, f4, f5, f6, f7, f8, f9, f10, f11, f12, f13, f14, f15] = _t;
+    return _f(f1, f2, f3, f4, f5, f6, f7, f8, f9, f10, f11, f12, f13, f14, f15);
+  } else if constexpr (n == 16) {
+    auto& [
+        f1, f2, f3, f4, f5, f6, f7, f8, f9, f10, f11, f12, f13, f14, f15,
+        f16] = _t;
+    return _f(
+        f1, f2, f3, f4, f5, f6, f7, f8, f9, f10, f11, f12, f13, f14, f15, f16);
+  } else if constexpr (n == 17) {
+    auto& [
+        f1, f2, f3, f4, f5, f6, f7, f8, f9, f10, f11, f12, f13, f14, f15, f16,
+        f17] = _t;
+    return _f(
+        f1, f2, f3, f4, f5, f6, f7, f8, f9, f10, f11, f12, f13, f14, f15, f16,
+        f17);
+  } else if constexpr (n == 18) {
+    auto& [
+        f1, f2, f3, f4, f5, f6, f7, f8, f9, f10, f11, f12, f13, f14, f15, f16,
+        f17, f18] = _t;
+    return _f(
+        f1, f2, f3, f4, f5, f6, f7, f8, f9, f10, f11, f12, f13, f14, f15, f16,
+        f17, f18);
+  } else if constexpr (n == 19) {
+    auto& [
+        f1, f2, f3, f4, f5, f6, f7, f8, f9, f10, f11, f12, f13, f14, f15, f16,
+        f17, f18, f19] = _t;
+    return _f(
+        f1, f2, f3, f4, f5, f6, f7, f8, f9, f10, f11, f12, f13, f14, f15, f16,
+        f17, f18, f19);
+  } else if constexpr (n == 20) {
+    auto& [
+        f1, f2, f3, f4, f5, f6, f7, f8, f9, f10, f11, f12, f13, f14, f15, f16,
+        f17, f18, f19, f20] = _t;
+    return _f(
+        f1, f2, f3, f4, f5, f6, f7, f8, f9, f10, f11, f12, f13, f14, f15, f16,
+        f17, f18, f19, f20);
+  } else if constexpr (n == 21) {
+    auto& [
+        f1, f2, f3, f4, f5, f6, f7, f8, f9, f10, f11, f12, f13, f14, f15, f16,
+        f17, f18, f19, f20, f21] = _t;
+    return _f(
+        f1, f2, f3, f4, f5, f6, f7, f8, f9, f10, f11, f12, f13, f14, f15, f16,
+        f17, f18, f19, f20, f21);
+  } else if constexpr (n == 22) {
+    auto& [
+        f1, f2, f3, f4, f5, f6, f7, f8, f9, f10, f11, f12, f13, f14, f15, f16,
+        f17, f18, f19, f20, f21, f22] = _t;
+    return _f(
+        f1, f2, f3, f4, f5, f6, f7, f8, f9, f10, f11, f12, f13, f14, f15, f16,
+        f17, f18, f19, f20, f21, f22);
+  } else if constexpr (n == 23) {
+    auto& [
+        f1, f2, f3, f4, f5, f6, f7, f8, f9, f10, f11, f12, f13, f14, f15, f16,
+        f17, f18, f19, f20, f21, f22, f23] = _t;
+    return _f(
+        f1, f2, f3, f4, f5, f6, f7, f8, f9, f10, f11, f12, f13, f14, f15, f16,
+        f17, f18, f19, f20, f21, f22, f23);
+  } else if constexpr (n == 24) {
+    auto& [
+        f1, f2, f3, f4, f5, f6, f7, f8, f9, f10, f11, f12, f13, f14, f15, f16,
+        f17, f18, f19, f20, f21, f22, f23, f24] = _t;
+    return _f(
+        f1, f2, f3, f4, f5, f6, f7, f8, f9, f10, f11, f12, f13, f14, f15, f16,
+        f17, f18, f19, f20, f21, f22, f23, f24);
+  } else if constexpr (n == 25) {
+    auto& [
+        f1, f2, f3, f4, f5, f6, f7, f8, f9, f10, f11, f12, f13, f14, f15, f16,
+        f17, f18, f19, f20, f21, f22, f23, f24, f25] = _t;
+    return _f(
+        f1, f2, f3, f4, f5, f6, f7, f8, f9, f10, f11, f12, f13, f14, f15, f16,
+        f17, f18, f19, f20, f21, f22, f23, f24, f25);
+  } else if constexpr (n == 26) {
+    auto& [
+        f1, f2, f3, f4, f5, f6, f7, f8, f9, f10, f11, f12, f13, f14, f15, f16,
+        f17, f18, f19, f20, f21, f22, f23, f24, f25, f26] = _t;
+    return _f(
+        f1, f2, f3, f4, f5, f6, f7, f8, f9, f10, f11, f12, f13, f14, f15, f16,
+        f17, f18, f19, f20, f21, f22, f23, f24, f25, f26);
+  } else if constexpr (n == 27) {
+    auto& [
+        f1, f2, f3, f4, f5, f6, f7, f8, f9, f10, f11, f12, f13, f14, f15, f16,
+        f17, f18, f19, f20, f21, f22, f23, f24, f25, f26, f27] = _t;
+    return _f(
+        f1, f2, f3, f4, f5, f6, f7, f8, f9, f10, f11, f12, f13, f14, f15, f16,
+        f17, f18, f19, f20, f21, f22, f23, f24, f25, f26, f27);
+  } else if constexpr (n == 28) {
+    auto& [
+        f1, f2, f3, f4, f5, f6, f7, f8, f9, f10, f11, f12, f13, f14, f15, f16,
+        f17, f18, f19, f20, f21, f22, f23, f24, f25, f26, f27, f28] = _t;
+    return _f(
+        f1, f2, f3, f4, f5, f6, f7, f8, f9, f10, f11, f12, f13, f14, f15, f16,
+        f17, f18, f19, f20, f21, f22, f23, f24, f25, f26, f27, f28);
+  } else if constexpr (n == 29) {
+    auto& [
+        f1, f2, f3, f4, f5, f6, f7, f8, f9, f10, f11, f12, f13, f14, f15, f16,
+        f17, f18, f19, f20, f21, f22, f23, f24, f25, f26, f27, f28, f29] = _t;
+    return _f(
+        f1, f2, f3, f4, f5, f6, f7, f8, f9, f10, f11, f12, f13, f14, f15, f16,
+        f17, f18, f19, f20, f21, f22, f23, f24, f25, f26, f27, f28, f29);
+  } else if constexpr (n == 30) {
+    auto& [
+        f1, f2, f3, f4, f5, f6, f7, f8, f9, f10, f11, f12, f13, f14, f15, f16,
+        f17, f18, f19, f20, f21, f22, f23, f24, f25, f26, f27, f28, f29,
+        f30] = _t;
+    return _f(
+        f1, f2, f3, f4, f5, f6, f7, f8, f9, f10, f11, f12, f13, f14, f15, f16,
+        f17, f18, f19, f20, f21, f22, f23, f24, f25, f26, f27, f28, f29, f30);
+  } else if constexpr (n == 31) {
+    auto& [
+        f1, f2, f3, f4, f5, f6, f7, f8, f9, f10, f11, f12, f13, f14, f15, f16,
+        f17, f18, f19, f20, f21, f22, f23, f24, f25, f26, f27, f28, f29, f30,
+        f31] = _t;
+    return _f(
+        f1, f2, f3, f4, f5, f6, f7, f8, f9, f10, f11, f12, f13, f14, f15, f16,
+        f17, f18, f19, f20, f21, f22, f23, f24, f25, f26, f27, f28, f29, f30,
+        f31);
+  } else if constexpr (n == 32) {
+    auto& [
+        f1, f2, f3, f4, f5, f6, f7, f8, f9, f10, f11, f12, f13, f14, f15, f16,
+        f17, f18, f19, f20, f21, f22, f23, f24, f25, f26, f27, f28, f29, f30,
+        f31, f32] = _t;
+    return _f(
+        f1, f2, f3, f4, f5, f6, f7, f8, f9, f10, f11, f12, f13, f14, f15, f16,
+        f17, f18, f19, f20, f21, f22, f23, f24, f25, f26, f27, f28, f29, f30,
+        f31, f32);
+  } else if constexpr (n == 33) {
+    auto& [
+        f1, f2, f3, f4, f5, f6, f7, f8, f9, f10, f11, f12, f13, f14, f15, f16,
+        f17, f18, f19, f20, f21, f22, f23, f24, f25, f26, f27, f28, f29, f30,
+        f31, f32, f33] = _t;
+    return _f(
+        f1, f2, f3, f4, f5, f6, f7, f8, f9, f10, f11, f12, f13, f14, f15, f16,
+        f17, f18, f19, f20, f21, f22, f23, f24, f25, f26, f27, f28, f29, f30,
+        f31, f32, f33);
+  } else if constexpr (n == 34) {
+    auto& [
+        f1, f2, f3, f4, f5, f6, f7, f8, f9, f10, f11, f12, f13, f14, f15, f16,
+        f17, f18, f19, f20, f21, f22, f23, f24, f25, f26, f27, f28, f29, f30,
+        f31, f32, f33, f34] = _t;
+    return _f(
+        f1, f2, f3, f4, f5, f6, f7, f8, f9, f10, f11, f12, f13, f14, f15, f16,
+        f17, f18, f19, f20, f21, f22, f23, f24, f25, f26, f27, f28, f29, f30,
+        f31, f32, f33, f34);
+  } else if constexpr (n == 35) {
+    auto& [
+        f1, f2, f3, f4, f5, f6, f7, f8, f9, f10, f11, f12, f13, f14, f15, f16,
+        f17, f18, f19, f20, f21, f22, f23, f24, f25, f26, f27, f28, f29, f30,
+        f31, f32, f33, f34, f35] = _t;
+    return _f(
+        f1, f2, f3, f4, f5, f6, f7, f8, f9, f10, f11, f12, f13, f14, f15, f16,
+        f17, f18, f19, f20, f21, f22, f23, f24, f25, f26, f27, f28, f29, f30,
+        f31, f32, f33, f34, f35);
+  } else if constexpr (n == 36) {
+    auto& [
+        f1, f2, f3, f4, f5, f6, f7, f8, f9, f10, f11, f12, f13, f14, f15, f16,
+        f17, f18, f19, f20, f21, f22, f23, f24, f25, f26, f27, f28, f29, f30,
+        f31, f32, f33, f34, f35, f36] = _t;
+    return _f(
+        f1, f2, f3, f4, f5, f6, f7, f8, f9, f10, f11, f12, f13, f14, f15, f16,
+        f17, f18, f19, f20, f21, f22, f23, f24, f25, f26, f27, f28, f29, f30,
+        f31, f32, f33, f34, f35, f36);
+  } else if constexpr (n == 37) {
+    auto& [
+        f1, f2, f3, f4, f5, f6, f7, f8, f9, f10, f11, f12, f13, f14, f15, f16,
+        f17, f18, f19, f20, f21, f22, f23, f24, f25, f26, f27, f28, f29, f30,
+        f31, f32, f33, f34, f35, f36, f37] = _t;
+    return _f(
+        f1, f2, f3, f4, f5, f6, f7, f8, f9, f10, f11, f12, f13, f14, f15, f16,
+        f17, f18, f19, f20, f21, f22, f23, f24, f25, f26, f27, f28, f29, f30,
+        f31, f32, f33, f34, f35, f36, f37);
+  } else if constexpr (n == 38) {
+    auto& [
+        f1, f2, f3, f4, f5, f6, f7, f8, f9, f10, f11, f12, f13, f14, f15, f16,
+        f17, f18, f19, f20, f21, f22, f23, f24, f25, f26, f27, f28, f29, f30,
+        f31, f32, f33, f34, f35, f36, f37, f38] = _t;
+    return _f(
+        f1, f2, f3, f4, f5, f6, f7, f8, f9, f10, f11, f12, f13, f14, f15, f16,
+        f17, f18, f19, f20, f21, f22, f23, f24, f25, f26, f27, f28, f29, f30,
+        f31, f32, f33, f34, f35, f36, f37, f38);
+  } else if constexpr (n == 39) {
+    auto& [
+        f1, f2, f3, f4, f5, f6, f7, f8, f9, f10, f11, f12, f13, f14, f15, f16,
+        f17, f18, f19, f20, f21, f22, f23, f24, f25, f26, f27, f28, f29, f30,
+        f31, f32, f33, f34, f35, f36, f37, f38, f39] = _t;
+    return _f(
+        f1, f2, f3, f4, f5, f6, f7, f8, f9, f10, f11, f12, f13, f14, f15, f16,
+        f17, f18, f19, f20, f21, f22, f23, f24, f25, f26, f27, f28, f29, f30,
+        f31, f32, f33, f34, f35, f36, f37, f38, f39);
+  } else if constexpr (n == 40) {
+    auto& [
+        f1, f2, f3, f4, f5, f6, f7, f8, f9, f10, f11, f12, f13, f14, f15, f16,
+        f17, f18, f19, f20, f21, f22, f23, f24, f25, f26, f27, f28, f29, f30,
+        f31, f32, f33, f34, f35, f36, f37, f38, f39, f40] = _t;
+    return _f(
+        f1, f2, f3, f4, f5, f6, f7, f8, f9, f10, f11, f12, f13, f14, f15, f16,
+        f17, f18, f19, f20, f21, f22, f23, f24, f25, f26, f27, f28, f29, f30,
+        f31, f32, f33, f34, f35, f36, f37, f38, f39, f40);
+  } else if constexpr (n == 41) {
+    auto& [
+        f1, f2, f3, f4, f5, f6, f7, f8, f9, f10, f11, f12, f13, f14, f15, f16,
+        f17, f18, f19, f20, f21, f22, f23, f24, f25, f26, f27, f28, f29, f30,
+        f31, f32, f33, f34, f35, f36, f37, f38, f39, f40, f41] = _t;
+    return _f(
+        f1, f2, f3, f4, f5, f6, f7, f8, f9, f10, f11, f12, f13, f14, f15, f16,
+        f17, f18, f19, f20, f21, f22, f23, f24, f25, f26, f27, f28, f29, f30,
+        f31, f32, f33, f34, f35, f36, f37, f38, f39, f40, f41);
+  } else if constexpr (n == 42) {
+    auto& [
+        f1, f2, f3, f4, f5, f6, f7, f8, f9, f10, f11, f12, f13, f14, f15, f16,
+        f17, f18, f19, f20, f21, f22, f23, f24, f25, f26, f27, f28, f29, f30,
+        f31, f32, f33, f34, f35, f36, f37, f38, f39, f40, f41, f42] = _t;
+    return _f(
+        f1, f2, f3, f4, f5, f6, f7, f8, f9, f10, f11, f12, f13, f14, f15, f16,
+        f17, f18, f19, f20, f21, f22, f23, f24, f25, f26, f27, f28, f29, f30,
+        f31, f32, f33, f34, f35, f36, f37, f38, f39, f40, f41, f42);
+  } else if constexpr (n == 43) {
+    auto& [
+        f1, f2, f3, f4, f5, f6, f7, f8, f9, f10, f11, f12, f13, f14, f15, f16,
+        f17, f18, f19, f20, f21, f22, f23, f24, f25, f26, f27, f28, f29, f30,
+        f31, f32, f33, f34, f35, f36, f37, f38, f39, f40, f41, f42, f43] = _t;
+    return _f(
+        f1, f2, f3, f4, f5, f6, f7, f8, f9, f10, f11, f12, f13, f14, f15, f16,
+        f17, f18, f19, f20, f21, f22, f23, f24, f25, f26, f27, f28, f29, f30,
+        f31, f32, f33, f34, f35, f36, f37, f38, f39, f40, f41, f42, f43);
+  } else if constexpr (n == 44) {
+    auto& [
+        f1, f2, f3, f4, f5, f6, f7, f8, f9, f10, f11, f12, f13, f14, f15, f16,
+        f17, f18, f19, f20, f21, f22, f23, f24, f25, f26, f27, f28, f29, f30,
+        f31, f32, f33, f34, f35, f36, f37, f38, f39, f40, f41, f42, f43,
+        f44] = _t;
+    return _f(
+        f1, f2, f3, f4, f5, f6, f7, f8, f9, f10, f11, f12, f13, f14, f15, f16,
+        f17, f18, f19, f20, f21, f22, f23, f24, f25, f26, f27, f28, f29, f30,
+        f31, f32, f33, f34, f35, f36, f37, f38, f39, f40, f41, f42, f43, f44);
+  } else if constexpr (n == 45) {
+    auto& [
+        f1, f2, f3, f4, f5, f6, f7, f8, f9, f10, f11, f12, f13, f14, f15, f16,
+        f17, f18, f19, f20, f21, f22, f23, f24, f25, f26, f27, f28, f29, f30,
+        f31, f32, f33, f34, f35, f36, f37, f38, f39, f40, f41, f42, f43, f44,
+        f45] = _t;
+    return _f(
+        f1, f2, f3, f4, f5, f6, f7, f8, f9, f10, f11, f12, f13, f14, f15, f16,
+        f17, f18, f19, f20, f21, f22, f23, f24, f25, f26, f27, f28, f29, f30,
+        f31, f32, f33, f34, f35, f36, f37, f38, f39, f40, f41, f42, f43, f44,
+        f45);
+  } else if constexpr (n == 46) {
+    auto& [
+        f1, f2, f3, f4, f5, f6, f7, f8, f9, f10, f11, f12, f13, f14, f15, f16,
+        f17, f18, f19, f20, f21, f22, f23, f24, f25, f26, f27, f28, f29, f30,
+        f31, f32, f33, f34, f35, f36, f37, f38, f39, f40, f41, f42, f43, f44,
+        f45, f46] = _t;
+    return _f(
+        f1, f2, f3, f4, f5, f6, f7, f8, f9, f10, f11, f12, f13, f14, f15, f16,
+        f17, f18, f19, f20, f21, f22, f23, f24, f25, f26, f27, f28, f29, f30,
+        f31, f32, f33, f34, f35, f36, f37, f38, f39, f40, f41, f42, f43, f44,
+        f45, f46);
+  } else if constexpr (n == 47) {
+    auto& [
+        f1, f2, f3, f4, f5, f6, f7, f8, f9, f10, f11, f12, f13, f14, f15, f16,
+        f17, f18, f19, f20, f21, f22, f23, f24, f25, f26, f27, f28, f29, f30,
+        f31, f32, f33, f34, f35, f36, f37, f38, f39, f40, f41, f42, f43, f44,
+        f45, f46, f47] = _t;
+    return _f(
+        f1, f2, f3, f4, f5, f6, f7, f8, f9, f10, f11, f12, f13, f14, f15, f16,
+        f17, f18, f19, f20, f21, f22, f23, f24, f25, f26, f27, f28, f29, f30,
+        f31, f32, f33, f34, f35, f36, f37, f38, f39, f40, f41, f42, f43, f44,
+        f45, f46, f47);
+  } else if constexpr (n == 48) {
+    auto& [
+        f1, f2, f3, f4, f5, f6, f7, f8, f9, f10, f11, f12, f13, f14, f15, f16,
+        f17, f18, f19, f20, f21, f22, f23, f24, f25, f26, f27, f28, f29, f30,
+        f31, f32, f33, f34, f35, f36, f37, f38, f39, f40, f41, f42, f43, f44,
+        f45, f46, f47, f48] = _t;
+    return _f(
+        f1, f2, f3, f4, f5, f6, f7, f8, f9, f10, f11, f12, f13, f14, f15, f16,
+        f17, f18, f19, f20, f21, f22, f23, f24, f25, f26, f27, f28, f29, f30,
+        f31, f32, f33, f34, f35, f36, f37, f38, f39, f40, f41, f42, f43, f44,
+        f45, f46, f47, f48);
+  } else if constexpr (n == 49) {
+    auto& [
+        f1, f2, f3, f4, f5, f6, f7, f8, f9, f10, f11, f12, f13, f14, f15, f16,
+        f17, f18, f19, f20, f21, f22, f23, f24, f25, f26, f27, f28, f29, f30,
+        f31, f32, f33, f34, f35, f36, f37, f38, f39, f40, f41, f42, f43, f44,
+        f45, f46, f47, f48, f49] = _t;
+    return _f(
+        f1, f2, f3, f4, f5, f6, f7, f8, f9, f10, f11, f12, f13, f14, f15, f16,
+        f17, f18, f19, f20, f21, f22, f23, f24, f25, f26, f27, f28, f29, f30,
+        f31, f32, f33, f34, f35, f36, f37, f38, f39, f40, f41, f42, f43, f44,
+        f45, f46, f47, f48, f49);
+  } else if constexpr (n == 50) {
+    auto& [
+        f1, f2, f3, f4, f5, f6, f7, f8, f9, f10, f11, f12, f13, f14, f15, f16,
+        f17, f18, f19, f20, f21, f22, f23, f24, f25, f26, f27, f28, f29, f30,
+        f31, f32, f33, f34, f35, f36, f37, f38, f39, f40, f41, f42, f43, f44,
+        f45, f46, f47, f48, f49, f50] = _t;
+    return _f(
+        f1, f2, f3, f4, f5, f6, f7, f8, f9, f10, f11, f12, f13, f14, f15, f16,
+        f17, f18, f19, f20, f21, f22, f23, f24, f25, f26, f27, f28, f29, f30,
+        f31, f32, f33, f34, f35, f36, f37, f38, f39, f40, f41, f42, f43, f44,
+        f45, f46, f47, f48, f49, f50);
+  } else if constexpr (n == 51) {
+    auto& [
+        f1, f2, f3, f4, f5, f6, f7, f8, f9, f10, f11, f12, f13, f14, f15, f16,
+        f17, f18, f19, f20, f21, f22, f23, f24, f25, f26, f27, f28, f29, f30,
+        f31, f32, f33, f34, f35, f36, f37, f38, f39, f40, f41, f42, f43, f44,
+        f45, f46, f47, f48, f49, f50, f51] = _t;
+    return _f(
+        f1, f2, f3, f4, f5, f6, f7, f8, f9, f10, f11, f12, f13, f14, f15, f16,
+        f17, f18, f19, f20, f21, f22, f23, f24, f25, f26, f27, f28, f29, f30,
+        f31, f32, f33, f34, f35, f36, f37, f38, f39, f40, f41, f42, f43, f44,
+        f45, f46, f47, f48, f49, f50, f51);
+  } else if constexpr (n == 52) {
+    auto& [
+        f1, f2, f3, f4, f5, f6, f7, f8, f9, f10, f11, f12, f13, f14, f15, f16,
+        f17, f18, f19, f20, f21, f22, f23, f24, f25, f26, f27, f28, f29, f30,
+        f31, f32, f33, f34, f35, f36, f37, f38, f39, f40, f41, f42, f43, f44,
+        f45, f46, f47, f48, f49, f50, f51, f52] = _t;
+    return _f(
+        f1, f2, f3, f4, f5, f6, f7, f8, f9, f10, f11, f12, f13, f14, f15, f16,
+        f17, f18, f19, f20, f21, f22, f23, f24, f25, f26, f27, f28, f29, f30,
+        f31, f32, f33, f34, f35, f36, f37, f38, f39, f40, f41, f42, f43, f44,
+        f45, f46, f47, f48, f49, f50, f51, f52);
+  } else if constexpr (n == 53) {
+    auto& [
+        f1, f2, f3, f4, f5, f6, f7, f8, f9, f10, f11, f12, f13, f14, f15, f16,
+        f17, f18, f19, f20, f21, f22, f23, f24, f25, f26, f27, f28, f29, f30,
+        f31, f32, f33, f34, f35, f36, f37, f38, f39, f40, f41, f42, f43, f44,
+        f45, f46, f47, f48, f49, f50, f51, f52, f53] = _t;
+    return _f(
+        f1, f2, f3, f4, f5, f6, f7, f8, f9, f10, f11, f12, f13, f14, f15, f16,
+        f17, f18, f19, f20, f21, f22, f23, f24, f25, f26, f27, f28, f29, f30,
+        f31, f32, f33, f34, f35, f36, f37, f38, f39, f40, f41, f42, f43, f44,
+        f45, f46, f47, f48, f49, f50, f51, f52, f53);
+  } else if constexpr (n == 54) {
+    auto& [
+        f1, f2, f3, f4, f5, f6, f7, f8, f9, f10, f11, f12, f13, f14, f15, f16,
+        f17, f18, f19, f20, f21, f22, f23, f24, f25, f26, f27, f28, f29, f30,
+        f31, f32, f33, f34, f35, f36, f37, f38, f39, f40, f41, f42, f43, f44,
+        f45, f46, f47, f48, f49, f50, f51, f52, f53, f54] = _t;
+    return _f(
+        f1, f2, f3, f4, f5, f6, f7, f8, f9, f10, f11, f12, f13, f14, f15, f16,
+        f17, f18, f19, f20, f21, f22, f23, f24, f25, f26, f27, f28, f29, f30,
+        f31, f32, f33, f34, f35, f36, f37, f38, f39, f40, f41, f42, f43, f44,
+        f45, f46, f47, f48, f49, f50, f51, f52, f53, f54);
+  } else if constexpr (n == 55) {
+    auto& [
+        f1, f2, f3, f4, f5, f6, f7, f8, f9, f10, f11, f12, f13, f14, f15, f16,
+        f17, f18, f19, f20, f21, f22, f23, f24, f25, f26, f27, f28, f29, f30,
+        f31, f32, f33, f34, f35, f36, f37, f38, f39, f40, f41, f42, f43, f44,
+        f45, f46, f47, f48, f49, f50, f51, f52, f53, f54, f55] = _t;
+    return _f(
+        f1, f2, f3, f4, f5, f6, f7, f8, f9, f10, f11, f12, f13, f14, f15, f16,
+        f17, f18, f19, f20, f21, f22, f23, f24, f25, f26, f27, f28, f29, f30,
+        f31, f32, f33, f34, f35, f36, f37, f38, f39, f40, f41, f42, f43, f44,
+        f45, f46, f47, f48, f49, f50, f51, f52, f53, f54, f55);
+  } else if constexpr (n == 56) {
+    auto& [
+        f1, f2, f3, f4, f5, f6, f7, f8, f9, f10, f11, f12, f13, f14, f15, f16,
+        f17, f18, f19, f20, f21, f22, f23, f24, f25, f26, f27, f28, f29, f30,
+        f31, f32, f33, f34, f35, f36, f37, f38, f39, f40, f41, f42, f43, f44,
+        f45, f46, f47, f48, f49, f50, f51, f52, f53, f54, f55, f56] = _t;
+    return _f(
+        f1, f2, f3, f4, f5, f6, f7, f8, f9, f10, f11, f12, f13, f14, f15, f16,
+        f17, f18, f19, f20, f21, f22, f23, f24, f25, f26, f27, f28, f29, f30,
+        f31, f32, f33, f34, f35, f36, f37, f38, f39, f40, f41, f42, f43, f44,
+        f45, f46, f47, f48, f49, f50, f51, f52, f53, f54, f55, f56);
+  } else if constexpr (n == 57) {
+    auto& [
+        f1, f2, f3, f4, f5, f6, f7, f8, f9, f10, f11, f12, f13, f14, f15, f16,
+        f17, f18, f19, f20, f21, f22, f23, f24, f25, f26, f27, f28, f29, f30,
+        f31, f32, f33, f34, f35, f36, f37, f38, f39, f40, f41, f42, f43, f44,
+        f45, f46, f47, f48, f49, f50, f51, f52, f53, f54, f55, f56, f57] = _t;
+    return _f(
+        f1, f2, f3, f4, f5, f6, f7, f8, f9, f10, f11, f12, f13, f14, f15, f16,
+        f17, f18, f19, f20, f21, f22, f23, f24, f25, f26, f27, f28, f29, f30,
+        f31, f32, f33, f34, f35, f36, f37, f38, f39, f40, f41, f42, f43, f44,
+        f45, f46, f47, f48, f49, f50, f51, f52, f53, f54, f55, f56, f57);
+  } else if constexpr (n == 58) {
+    auto& [
+        f1, f2, f3, f4, f5, f6, f7, f8, f9, f10, f11, f12, f13, f14, f15, f16,
+        f17, f18, f19, f20, f21, f22, f23, f24, f25, f26, f27, f28, f29, f30,
+        f31, f32, f33, f34, f35, f36, f37, f38, f39, f40, f41, f42, f43, f44,
+        f45, f46, f47, f48, f49, f50, f51, f52, f53, f54, f55, f56, f57,
+        f58] = _t;
+    return _f(
+        f1, f2, f3, f4, f5, f6, f7, f8, f9, f10, f11, f12, f13, f14, f15, f16,
+        f17, f18, f19, f20, f21, f22, f23, f24, f25, f26, f27, f28, f29, f30,
+        f31, f32, f33, f34, f35, f36, f37, f38, f39, f40, f41, f42, f43, f44,
+        f45, f46, f47, f48, f49, f50, f51, f52, f53, f54, f55, f56, f57, f58);
+  } else if constexpr (n == 59) {
+    auto& [
+        f1, f2, f3, f4, f5, f6, f7, f8, f9, f10, f11, f12, f13, f14, f15, f16,
+        f17, f18, f19, f20, f21, f22, f23, f24, f25, f26, f27, f28, f29, f30,
+        f31, f32, f33, f34, f35, f36, f37, f38, f39, f40, f41, f42, f43, f44,
+        f45, f46, f47, f48, f49, f50, f51, f52, f53, f54, f55, f56, f57, f58,
+        f59] = _t;
+    return _f(
+        f1, f2, f3, f4, f5, f6, f7, f8, f9, f10, f11, f12, f13, f14, f15, f16,
+        f17, f18, f19, f20, f21, f22, f23, f24, f25, f26, f27, f28, f29, f30,
+        f31, f32, f33, f34, f35, f36, f37, f38, f39, f40, f41, f42, f43, f44,
+        f45, f46, f47, f48, f49, f50, f51, f52, f53, f54, f55, f56, f57, f58,
+        f59);
+  } else if constexpr (n == 60) {
+    auto& [
+        f1, f2, f3, f4, f5, f6, f7, f8, f9, f10, f11, f12, f13, f14, f15, f16,
+        f17, f18, f19, f20, f21, f22, f23, f24, f25, f26, f27, f28, f29, f30,
+        f31, f32, f33, f34, f35, f36, f37, f38, f39, f40, f41, f42, f43, f44,
+        f45, f46, f47, f48, f49, f50, f51, f52, f53, f54, f55, f56, f57, f58,
+        f59, f60] = _t;
+    return _f(
+        f1, f2, f3, f4, f5, f6, f7, f8, f9, f10, f11, f12, f13, f14, f15, f16,
+        f17, f18, f19, f20, f21, f22, f23, f24, f25, f26, f27, f28, f29, f30,
+        f31, f32, f33, f34, f35, f36, f37, f38, f39, f40, f41, f42, f43, f44,
+        f45, f46, f47, f48, f49, f50, f51, f52, f53, f54, f55, f56, f57, f58,
+        f59, f60);
+  } else if constexpr (n == 61) {
+    auto& [
+        f1, f2, f3, f4, f5, f6, f7, f8, f9, f10, f11, f12, f13, f14, f15, f16,
+        f17, f18, f19, f20, f21, f22, f23, f24, f25, f26, f27, f28, f29, f30,
+        f31, f32, f33, f34, f35, f36, f37, f38, f39, f40, f41, f42, f43, f44,
+        f45, f46, f47, f48, f49, f50, f51, f52, f53, f54, f55, f56, f57, f58,
+        f59, f60, f61] = _t;
+    return _f(
+        f1, f2, f3, f4, f5, f6, f7, f8, f9, f10, f11, f12, f13, f14, f15, f16,
+        f17, f18, f19, f20, f21, f22, f23, f24, f25, f26, f27, f28, f29, f30,
+        f31, f32, f33, f34, f35, f36, f37, f38, f39, f40, f41, f42, f43, f44,
+        f45, f46, f47, f48, f49, f50, f51, f52, f53, f54, f55, f56, f57, f58,
+        f59, f60, f61);
+  } else if constexpr (n == 62) {
+    auto& [
+        f1, f2, f3, f4, f5, f6, f7, f8, f9, f10, f11, f12, f13, f14, f15, f16,
+        f17, f18, f19, f20, f21, f22, f23, f24, f25, f26, f27, f28, f29, f30,
+        f31, f32, f33, f34, f35, f36, f37, f38, f39, f40, f41, f42, f43, f44,
+        f45, f46, f47, f48, f49, f50, f51, f52, f53, f54, f55, f56, f57, f58,
+        f59, f60, f61, f62] = _t;
+    return _f(
+        f1, f2, f3, f4, f5, f6, f7, f8, f9, f10, f11, f12, f13, f14, f15, f16,
+        f17, f18, f19, f20, f21, f22, f23, f24, f25, f26, f27, f28, f29, f30,
+        f31, f32, f33, f34, f35, f36, f37, f38, f39, f40, f41, f42, f43, f44,
+        f45, f46, f47, f48, f49, f50, f51, f52, f53, f54, f55, f56, f57, f58,
+        f59, f60, f61, f62);
+  } else if constexpr (n == 63) {
+    auto& [
+        f1, f2, f3, f4, f5, f6, f7, f8, f9, f10, f11, f12, f13, f14, f15, f16,
+        f17, f18, f19, f20, f21, f22, f23, f24, f25, f26, f27, f28, f29, f30,
+        f31, f32, f33, f34, f35, f36, f37, f38, f39, f40, f41, f42, f43, f44,
+        f45, f46, f47, f48, f49, f50, f51, f52, f53, f54, f55, f56, f57, f58,
+        f59, f60, f61, f62, f63] = _t;
+    return _f(
+        f1, f2, f3, f4, f5, f6, f7, f8, f9, f10, f11, f12, f13, f14, f15, f16,
+        f17, f18, f19, f20, f21, f22, f23, f24, f25, f26, f27, f28, f29, f30,
+        f31, f32, f33, f34, f35, f36, f37, f38, f39, f40, f41, f42, f43, f44,
+        f45, f46, f47, f48, f49, f50, f51, f52, f53, f54, f55, f56, f57, f58,
+        f59, f60, f61, f62, f63);
+  } else if constexpr (n == 64) {
+    auto& [
+        f1, f2, f3, f4, f5, f6, f7, f8, f9, f10, f11, f12, f13, f14, f15, f16,
+        f17, f18, f19, f20, f21, f22, f23, f24, f25, f26, f27, f28, f29, f30,
+        f31, f32, f33, f34, f35, f36, f37, f38, f39, f40, f41, f42, f43, f44,
+        f45, f46, f47, f48, f49, f50, f51, f52, f53, f54, f55, f56, f57, f58,
+        f59, f60, f61, f62, f63, f64] = _t;
+    return _f(
+        f1, f2, f3, f4, f5, f6, f7, f8, f9, f10, f11, f12, f13, f14, f15, f16,
+        f17, f18, f19, f20, f21, f22, f23, f24, f25, f26, f27, f28, f29, f30,
+        f31, f32, f33, f34, f35, f36, f37, f38, f39, f40, f41, f42, f43, f44,
+        f45, f46, f47, f48, f49, f50, f51, f52, f53, f54, f55, f56, f57, f58,
+        f59, f60, f61, f62, f63, f64);
+  } else if constexpr (n == 65) {
+    auto& [
+        f1, f2, f3, f4, f5, f6, f7, f8, f9, f10, f11, f12, f13, f14, f15, f16,
+        f17, f18, f19, f20, f21, f22, f23, f24, f25, f26, f27, f28, f29, f30,
+        f31, f32, f33, f34, f35, f36, f37, f38, f39, f40, f41, f42, f43, f44,
+        f45, f46, f47, f48, f49, f50, f51, f52, f53, f54, f55, f56, f57, f58,
+        f59, f60, f61, f62, f63, f64, f65] = _t;
+    return _f(
+        f1, f2, f3, f4, f5, f6, f7, f8, f9, f10, f11, f12, f13, f14, f15, f16,
+        f17, f18, f19, f20, f21, f22, f23, f24, f25, f26, f27, f28, f29, f30,
+        f31, f32, f33, f34, f35, f36, f37, f38, f39, f40, f41, f42, f43, f44,
+        f45, f46, f47, f48, f49, f50, f51, f52, f53, f54, f55, f56, f57, f58,
+        f59, f60, f61, f62, f63, f64, f65);
+  } else if constexpr (n == 66) {
+    auto& [
+        f1, f2, f3, f4, f5, f6, f7, f8, f9, f10, f11, f12, f13, f14, f15, f16,
+        f17, f18, f19, f20, f21, f22, f23, f24, f25, f26, f27, f28, f29, f30,
+        f31, f32, f33, f34, f35, f36, f37, f38, f39, f40, f41, f42, f43, f44,
+        f45, f46, f47, f48, f49, f50, f51, f52, f53, f54, f55, f56, f57, f58,
+        f59, f60, f61, f62, f63, f64, f65, f66] = _t;
+    return _f(
+        f1, f2, f3, f4, f5, f6, f7, f8, f9, f10, f11, f12, f13, f14, f15, f16,
+        f17, f18, f19, f20, f21, f22, f23, f24, f25, f26, f27, f28, f29, f30,
+        f31, f32, f33, f34, f35, f36, f37, f38, f39, f40, f41, f42, f43, f44,
+        f45, f46, f47, f48, f49, f50, f51, f52, f53, f54, f55, f56, f57, f58,
+        f59, f60, f61, f62, f63, f64, f65, f66);
+  } else if constexpr (n == 67) {
+    auto& [
+        f1, f2, f3, f4, f5, f6, f7, f8, f9, f10, f11, f12, f13, f14, f15, f16,
+        f17, f18, f19, f20, f21, f22, f23, f24, f25, f26, f27, f28, f29, f30,
+        f31, f32, f33, f34, f35, f36, f37, f38, f39, f40, f41, f42, f43, f44,
+        f45, f46, f47, f48, f49, f50, f51, f52, f53, f54, f55, f56, f57, f58,
+        f59, f60, f61, f62, f63, f64, f65, f66, f67] = _t;
+    return _f(
+        f1, f2, f3, f4, f5, f6, f7, f8, f9, f10, f11, f12, f13, f14, f15, f16,
+        f17, f18, f19, f20, f21, f22, f23, f24, f25, f26, f27, f28, f29, f30,
+        f31, f32, f33, f34, f35, f36, f37, f38, f39, f40, f41, f42, f43, f44,
+        f45, f46, f47, f48, f49, f50, f51, f52, f53, f54, f55, f56, f57, f58,
+        f59, f60, f61, f62, f63, f64, f65, f66, f67);
+  } else if constexpr (n == 68) {
+    auto& [
+        f1, f2, f3, f4, f5, f6, f7, f8, f9, f10, f11, f12, f13, f14, f15, f16,
+        f17, f18, f19, f20, f21, f22, f23, f24, f25, f26, f27, f28, f29, f30,
+        f31, f32, f33, f34, f35, f36, f37, f38, f39, f40, f41, f42, f43, f44,
+        f45, f46, f47, f48, f49, f50, f51, f52, f53, f54, f55, f56, f57, f58,
+        f59, f60, f61, f62, f63, f64, f65, f66, f67, f68] = _t;
+    return _f(
+        f1, f2, f3, f4, f5, f6, f7, f8, f9, f10, f11, f12, f13, f14, f15, f16,
+        f17, f18, f19, f20, f21, f22, f23, f24, f25, f26, f27, f28, f29, f30,
+        f31, f32, f33, f34, f35, f36, f37, f38, f39, f40, f41, f42, f43, f44,
+        f45, f46, f47, f48, f49, f50, f51, f52, f53, f54, f55, f56, f57, f58,
+        f59, f60, f61, f62, f63, f64, f65, f66, f67, f68);
+  } else if constexpr (n == 69) {
+    auto& [
+        f1, f2, f3, f4, f5, f6, f7, f8, f9, f10, f11, f12, f13, f14, f15, f16,
+        f17, f18, f19, f20, f21, f22, f23, f24, f25, f26, f27, f28, f29, f30,
+        f31, f32, f33, f34, f35, f36, f37, f38, f39, f40, f41, f42, f43, f44,
+        f45, f46, f47, f48, f49, f50, f51, f52, f53, f54, f55, f56, f57, f58,
+        f59, f60, f61, f62, f63, f64, f65, f66, f67, f68, f69] = _t;
+    return _f(
+        f1, f2, f3, f4, f5, f6, f7, f8, f9, f10, f11, f12, f13, f14, f15, f16,
+        f17, f18, f19, f20, f21, f22, f23, f24, f25, f26, f27, f28, f29, f30,
+        f31, f32, f33, f34, f35, f36, f37, f38, f39, f40, f41, f42, f43, f44,
+        f45, f46, f47, f48, f49, f50, f51, f52, f53, f54, f55, f56, f57, f58,
+        f59, f60, f61, f62, f63, f64, f65, f66, f67, f68, f69);
+  } else if constexpr (n == 70) {
+    auto& [
+        f1, f2, f3, f4, f5, f6, f7, f8, f9, f10, f11, f12, f13, f14, f15, f16,
+        f17, f18, f19, f20, f21, f22, f23, f24, f25, f26, f27, f28, f29, f30,
+        f31, f32, f33, f34, f35, f36, f37, f38, f39, f40, f41, f42, f43, f44,
+        f45, f46, f47, f48, f49, f50, f51, f52, f53, f54, f55, f56, f57, f58,
+        f59, f60, f61, f62, f63, f64, f65, f66, f67, f68, f69, f70] = _t;
+    return _f(
+        f1, f2, f3, f4, f5, f6, f7, f8, f9, f10, f11, f12, f13, f14, f15, f16,
+        f17, f18, f19, f20, f21, f22, f23, f24, f25, f26, f27, f28, f29, f30,
+        f31, f32, f33, f34, f35, f36, f37, f38, f39, f40, f41, f42, f43, f44,
+        f45, f46, f47, f48, f49, f50, f51, f52, f53, f54, f55, f56, f57, f58,
+        f59, f60, f61, f62, f63, f64, f65, f66, f67, f68, f69, f70);
+  } else if constexpr (n == 71) {
+    auto& [
+        f1, f2, f3, f4, f5, f6, f7, f8, f9, f10, f11, f12, f13, f14, f15, f16,
+        f17, f18, f19, f20, f21, f22, f23, f24, f25, f26, f27, f28, f29, f30,
+        f31, f32, f33, f34, f35, f36, f37, f38, f39, f40, f41, f42, f43, f44,
+        f45, f46, f47, f48, f49, f50, f51, f52, f53, f54, f55, f56, f57, f58,
+        f59, f60, f61, f62, f63, f64, f65, f66, f67, f68, f69, f70, f71] = _t;
+    return _f(
+        f1, f2, f3, f4, f5, f6, f7, f8, f9, f10, f11, f12, f13, f14, f15, f16,
+        f17, f18, f19, f20, f21, f22, f23, f24, f25, f26, f27, f28, f29, f30,
+        f31, f32, f33, f34, f35, f36, f37, f38, f39, f40, f41, f42, f43, f44,
+        f45, f46, f47, f48, f49, f50, f51, f52, f53, f54, f55, f56, f57, f58,
+        f59, f60, f61, f62, f63, f64, f65, f66, f67, f68, f69, f70, f71);
+  } else if constexpr (n == 72) {
+    auto& [
+        f1, f2, f3, f4, f5, f6, f7, f8, f9, f10, f11, f12, f13, f14, f15, f16,
+        f17, f18, f19, f20, f21, f22, f23, f24, f25, f26, f27, f28, f29, f30,
+        f31, f32, f33, f34, f35, f36, f37, f38, f39, f40, f41, f42, f43, f44,
+        f45, f46, f47, f48, f49, f50, f51, f52, f53, f54, f55, f56, f57, f58,
+        f59, f60, f61, f62, f63, f64, f65, f66, f67, f68, f69, f70, f71,
+        f72] = _t;
+    return _f(
+        f1, f2, f3, f4, f5, f6, f7, f8, f9, f10, f11, f12, f13, f14, f15, f16,
+        f17, f18, f19, f20, f21, f22, f23, f24, f25, f26, f27, f28, f29, f30,
+        f31, f32, f33, f34, f35, f36, f37, f38, f39, f40, f41, f42, f43, f44,
+        f45, f46, f47, f48, f49, f50, f51, f52, f53, f54, f55, f56, f57, f58,
+        f59, f60, f61, f62, f63, f64, f65, f66, f67, f68, f69, f70, f71, f72);
+  } else if constexpr (n == 73) {
+    auto& [
+        f1, f2, f3, f4, f5, f6, f7, f8, f9, f10, f11, f12, f13, f14, f15, f16,
+        f17, f18, f19, f20, f21, f22, f23, f24, f25, f26, f27, f28, f29, f30,
+        f31, f32, f33, f34, f35, f36, f37, f38, f39, f40, f41, f42, f43, f44,
+        f45, f46, f47, f48, f49, f50, f51, f52, f53, f54, f55, f56, f57, f58,
+        f59, f60, f61, f62, f63, f64, f65, f66, f67, f68, f69, f70, f71, f72,
+        f73] = _t;
+    return _f(
+        f1, f2, f3, f4, f5, f6, f7, f8, f9, f10, f11, f12, f13, f14, f15, f16,
+        f17, f18, f19, f20, f21, f22, f23, f24, f25, f26, f27, f28, f29, f30,
+        f31, f32, f33, f34, f35, f36, f37, f38, f39, f40, f41, f42, f43, f44,
+        f45, f46, f47, f48, f49, f50, f51, f52, f53, f54, f55, f56, f57, f58,
+        f59, f60, f61, f62, f63, f64, f65, f66, f67, f68, f69, f70, f71, f72,
+        f73);
+  } else if constexpr (n == 74) {
+    auto& [
+        f1, f2, f3, f4, f5, f6, f7, f8, f9, f10, f11, f12, f13, f14, f15, f16,
+        f17, f18, f19, f20, f21, f22, f23, f24, f25, f26, f27, f28, f29, f30,
+        f31, f32, f33, f34, f35, f36, f37, f38, f39, f40, f41, f42, f43, f44,
+        f45, f46, f47, f48, f49, f50, f51, f52, f53, f54, f55, f56, f57, f58,
+        f59, f60, f61, f62, f63, f64, f65, f66, f67, f68, f69, f70, f71, f72,
+        f73, f74] = _t;
+    return _f(
+        f1, f2, f3, f4, f5, f6, f7, f8, f9, f10, f11, f12, f13, f14, f15, f16,
+        f17, f18, f19, f20, f21, f22, f23, f24, f25, f26, f27, f28, f29, f30,
+        f31, f32, f33, f34, f35, f36, f37, f38, f39, f40, f41, f42, f43, f44,
+        f45, f46, f47, f48, f49, f50, f51, f52, f53, f54, f55, f56, f57, f58,
+        f59, f60, f61, f62, f63, f64, f65, f66, f67, f68, f69, f70, f71, f72,
+        f73, f74);
+  } else if constexpr (n == 75) {
+    auto& [
+        f1, f2, f3, f4, f5, f6, f7, f8, f9, f10, f11, f12, f13, f14, f15, f16,
+        f17, f18, f19, f20, f21, f22, f23, f24, f25, f26, f27, f28, f29, f30,
+        f31, f32, f33, f34, f35, f36, f37, f38, f39, f40, f41, f42, f43, f44,
+        f45, f46, f47, f48, f49, f50, f51, f52, f53, f54, f55, f56, f57, f58,
+        f59, f60, f61, f62, f63, f64, f65, f66, f67, f68, f69, f70, f71, f72,
+        f73, f74, f75] = _t;
+    return _f(
+        f1, f2, f3, f4, f5, f6, f7, f8, f9, f10, f11, f12, f13, f14, f15, f16,
+        f17, f18, f19, f20, f21, f22, f23, f24, f25, f26, f27, f28, f29, f30,
+        f31, f32, f33, f34, f35, f36, f37, f38, f39, f40, f41, f42, f43, f44,
+        f45, f46, f47, f48, f49, f50, f51, f52, f53, f54, f55, f56, f57, f58,
+        f59, f60, f61, f62, f63, f64, f65, f66, f67, f68, f69, f70, f71, f72,
+        f73, f74, f75);
+  } else if constexpr (n == 76) {
+    auto& [
+        f1, f2, f3, f4, f5, f6, f7, f8, f9, f10, f11, f12, f13, f14, f15, f16,
+        f17, f18, f19, f20, f21, f22, f23, f24, f25, f26, f27, f28, f29, f30,
+        f31, f32, f33, f34, f35, f36, f37, f38, f39, f40, f41, f42, f43, f44,
+        f45, f46, f47, f48, f49, f50, f51, f52, f53, f54, f55, f56, f57, f58,
+        f59, f60, f61, f62, f63, f64, f65, f66, f67, f68, f69, f70, f71, f72,
+        f73, f74, f75, f76] = _t;
+    return _f(
+        f1, f2, f3, f4, f5, f6, f7, f8, f9, f10, f11, f12, f13, f14, f15, f16,
+        f17, f18, f19, f20, f21, f22, f23, f24, f25, f26, f27, f28, f29, f30,
+        f31, f32, f33, f34, f35, f36, f37, f38, f39, f40, f41, f42, f43, f44,
+        f45, f46, f47, f48, f49, f50, f51, f52, f53, f54, f55, f56, f57, f58,
+        f59, f60, f61, f62, f63, f64, f65, f66, f67, f68, f69, f70, f71, f72,
+        f73, f74, f75, f76);
+  } else if constexpr (n == 77) {
+    auto& [
+        f1, f2, f3, f4, f5, f6, f7, f8, f9, f10, f11, f12, f13, f14, f15, f16,
+        f17, f18, f19, f20, f21, f22, f23, f24, f25, f26, f27, f28, f29, f30,
+        f31, f32, f33, f34, f35, f36, f37, f38, f39, f40, f41, f42, f43, f44,
+        f45, f46, f47, f48, f49, f50, f51, f52, f53, f54, f55, f56, f57, f58,
+        f59, f60, f61, f62, f63, f64, f65, f66, f67, f68, f69, f70, f71, f72,
+        f73, f74, f75, f76, f77] = _t;
+    return _f(
+        f1, f2, f3, f4, f5, f6, f7, f8, f9, f10, f11, f12, f13, f14, f15, f16,
+        f17, f18, f19, f20, f21, f22, f23, f24, f25, f26, f27, f28, f29, f30,
+        f31, f32, f33, f34, f35, f36, f37, f38, f39, f40, f41, f42, f43, f44,
+        f45, f46, f47, f48, f49, f50, f51, f52, f53, f54, f55, f56, f57, f58,
+        f59, f60, f61, f62, f63, f64, f65, f66, f67, f68, f69, f70, f71, f72,
+        f73, f74, f75, f76, f77);
+  } else if constexpr (n == 78) {
+    auto& [
+        f1, f2, f3, f4, f5, f6, f7, f8, f9, f10, f11, f12, f13, f14, f15, f16,
+        f17, f18, f19, f20, f21, f22, f23, f24, f25, f26, f27, f28, f29, f30,
+        f31, f32, f33, f34, f35, f36, f37, f38, f39, f40, f41, f42, f43, f44,
+        f45, f46, f47, f48, f49, f50, f51, f52, f53, f54, f55, f56, f57, f58,
+        f59, f60, f61, f62, f63, f64, f65, f66, f67, f68, f69, f70, f71, f72,
+        f73, f74, f75, f76, f77, f78] = _t;
+    return _f(
+        f1, f2, f3, f4, f5, f6, f7, f8, f9, f10, f11, f12, f13, f14, f15, f16,
+        f17, f18, f19, f20, f21, f22, f23, f24, f25, f26, f27, f28, f29, f30,
+        f31, f32, f33, f34, f35, f36, f37, f38, f39, f40, f41, f42, f43, f44,
+        f45, f46, f47, f48, f49, f50, f51, f52, f53, f54, f55, f56, f57, f58,
+        f59, f60, f61, f62, f63, f64, f65, f66, f67, f68, f69, f70, f71, f72,
+        f73, f74, f75, f76, f77, f78);
+  } else if constexpr (n == 79) {
+    auto& [
+        f1, f2, f3, f4, f5, f6, f7, f8, f9, f10, f11, f12, f13, f14, f15, f16,
+        f17, f18, f19, f20, f21, f22, f23, f24, f25, f26, f27, f28, f29, f30,
+        f31, f32, f33, f34, f35, f36, f37, f38, f39, f40, f41, f42, f43, f44,
+        f45, f46, f47, f48, f49, f50, f51, f52, f53, f54, f55, f56, f57, f58,
+        f59, f60, f61, f62, f63, f64, f65, f66, f67, f68, f69, f70, f71, f72,
+        f73, f74, f75, f76, f77, f78, f79] = _t;
+    return _f(
+        f1, f2, f3, f4, f5, f6, f7, f8, f9, f10, f11, f12, f13, f14, f15, f16,
+        f17, f18, f19, f20, f21, f22, f23, f24, f25, f26, f27, f28, f29, f30,
+        f31, f32, f33, f34, f35, f36, f37, f38, f39, f40, f41, f42, f43, f44,
+        f45, f46, f47, f48, f49, f50, f51, f52, f53, f54, f55, f56, f57, f58,
+        f59, f60, f61, f62, f63, f64, f65, f66, f67, f68, f69, f70, f71, f72,
+        f73, f74, f75, f76, f77, f78, f79);
+  } else if constexpr (n == 80) {
+    auto& [
+        f1, f2, f3, f4, f5, f6, f7, f8, f9, f10, f11, f12, f13, f14, f15, f16,
+        f17, f18, f19, f20, f21, f22, f23, f24, f25, f26, f27, f28, f29, f30,
+        f31, f32, f33, f34, f35, f36, f37, f38, f39, f40, f41, f42, f43, f44,
+        f45, f46, f47, f48, f49, f50, f51, f52, f53, f54, f55, f56, f57, f58,
+        f59, f60, f61, f62, f63, f64, f65, f66, f67, f68, f69, f70, f71, f72,
+        f73, f74, f75, f76, f77, f78, f79, f80] = _t;
+    return _f(
+        f1, f2, f3, f4, f5, f6, f7, f8, f9, f10, f11, f12, f13, f14, f15, f16,
+        f17, f18, f19, f20, f21, f22, f23, f24, f25, f26, f27, f28, f29, f30,
+        f31, f32, f33, f34, f35, f36, f37, f38, f39, f40, f41, f42, f43, f44,
+        f45, f46, f47, f48, f49, f50, f51, f52, f53, f54, f55, f56, f57, f58,
+        f59, f60, f61, f62, f63, f64, f65, f66, f67, f68, f69, f70, f71, f72,
+        f73, f74, f75, f76, f77, f78, f79, f80);
+  } else if constexpr (n == 81) {
+    auto& [
+        f1, f2, f3, f4, f5, f6, f7, f8, f9, f10, f11, f12, f13, f14, f15, f16,
+        f17, f18, f19, f20, f21, f22, f23, f24, f25, f26, f27, f28, f29, f30,
+        f31, f32, f33, f34, f35, f36, f37, f38, f39, f40, f41, f42, f43, f44,
+        f45, f46, f47, f48, f49, f50, f51, f52, f53, f54, f55, f56, f57, f58,
+        f59, f60, f61, f62, f63, f64, f65, f66, f67, f68, f69, f70, f71, f72,
+        f73, f74, f75, f76, f77, f78, f79, f80, f81] = _t;
+    return _f(
+        f1, f2, f3, f4, f5, f6, f7, f8, f9, f10, f11, f12, f13, f14, f15, f16,
+        f17, f18, f19, f20, f21, f22, f23, f24, f25, f26, f27, f28, f29, f30,
+        f31, f32, f33, f34, f35, f36, f37, f38, f39, f40, f41, f42, f43, f44,
+        f45, f46, f47, f48, f49, f50, f51, f52, f53, f54, f55, f56, f57, f58,
+        f59, f60, f61, f62, f63, f64, f65, f66, f67, f68, f69, f70, f71, f72,
+        f73, f74, f75, f76, f77, f78, f79, f80, f81);
+  } else if constexpr (n == 82) {
+    auto& [
+        f1, f2, f3, f4, f5, f6, f7, f8, f9, f10, f11, f12, f13, f14, f15, f16,
+        f17, f18, f19, f20, f21, f22, f23, f24, f25, f26, f27, f28, f29, f30,
+        f31, f32, f33, f34, f35, f36, f37, f38, f39, f40, f41, f42, f43, f44,
+        f45, f46, f47, f48, f49, f50, f51, f52, f53, f54, f55, f56, f57, f58,
+        f59, f60, f61, f62, f63, f64, f65, f66, f67, f68, f69, f70, f71, f72,
+        f73, f74, f75, f76, f77, f78, f79, f80, f81, f82] = _t;
+    return _f(
+        f1, f2, f3, f4, f5, f6, f7, f8, f9, f10, f11, f12, f13, f14, f15, f16,
+        f17, f18, f19, f20, f21, f22, f23, f24, f25, f26, f27, f28, f29, f30,
+        f31, f32, f33, f34, f35, f36, f37, f38, f39, f40, f41, f42, f43, f44,
+        f45, f46, f47, f48, f49, f50, f51, f52, f53, f54, f55, f56, f57, f58,
+        f59, f60, f61, f62, f63, f64, f65, f66, f67, f68, f69, f70, f71, f72,
+        f73, f74, f75, f76, f77, f78, f79, f80, f81, f82);
+  } else if constexpr (n == 83) {
+    auto& [
+        f1, f2, f3, f4, f5, f6, f7, f8, f9, f10, f11, f12, f13, f14, f15, f16,
+        f17, f18, f19, f20, f21, f22, f23, f24, f25, f26, f27, f28, f29, f30,
+        f31, f32, f33, f34, f35, f36, f37, f38, f39, f40, f41, f42, f43, f44,
+        f45, f46, f47, f48, f49, f50, f51, f52, f53, f54, f55, f56, f57, f58,
+        f59, f60, f61, f62, f63, f64, f65, f66, f67, f68, f69, f70, f71, f72,
+        f73, f74, f75, f76, f77, f78, f79, f80, f81, f82, f83] = _t;
+    return _f(
+        f1, f2, f3, f4, f5, f6, f7, f8, f9, f10, f11, f12, f13, f14, f15, f16,
+        f17, f18, f19, f20, f21, f22, f23, f24, f25, f26, f27, f28, f29, f30,
+        f31, f32, f33, f34, f35, f36, f37, f38, f39, f40, f41, f42, f43, f44,
+        f45, f46, f47, f48, f49, f50, f51, f52, f53, f54, f55, f56, f57, f58,
+        f59, f60, f61, f62, f63, f64, f65, f66, f67, f68, f69, f70, f71, f72,
+        f73, f74, f75, f76, f77, f78, f79, f80, f81, f82, f83);
+  } else if constexpr (n == 84) {
+    auto& [
+        f1, f2, f3, f4, f5, f6, f7, f8, f9, f10, f11, f12, f13, f14, f15, f16,
+        f17, f18, f19, f20, f21, f22, f23, f24, f25, f26, f27, f28, f29, f30,
+        f31, f32, f33, f34, f35, f36, f37, f38, f39, f40, f41, f42, f43, f44,
+        f45, f46, f47, f48, f49, f50, f51, f52, f53, f54, f55, f56, f57, f58,
+        f59, f60, f61, f62, f63, f64, f65, f66, f67, f68, f69, f70, f71, f72,
+        f73, f74, f75, f76, f77, f78, f79, f80, f81, f82, f83, f84] = _t;
+    return _f(
+        f1, f2, f3, f4, f5, f6, f7, f8, f9, f10, f11, f12, f13, f14, f15, f16,
+        f17, f18, f19, f20, f21, f22, f23, f24, f25, f26, f27, f28, f29, f30,
+        f31, f32, f33, f34, f35, f36, f37, f38, f39, f40, f41, f42, f43, f44,
+        f45, f46, f47, f48, f49, f50, f51, f52, f53, f54, f55, f56, f57, f58,
+        f59, f60, f61, f62, f63, f64, f65, f66, f67, f68, f69, f70, f71, f72,
+        f73, f74, f75, f76, f77, f78, f79, f80, f81, f82, f83, f84);
+  } else if constexpr (n == 85) {
+    auto& [
+        f1, f2, f3, f4, f5, f6, f7, f8, f9, f10, f11, f12, f13, f14, f15, f16,
+        f17, f18, f19, f20, f21, f22, f23, f24, f25, f26, f27, f28, f29, f30,
+        f31, f32, f33, f34, f35, f36, f37, f38, f39, f40, f41, f42, f43, f44,
+        f45, f46, f47, f48, f49, f50, f51, f52, f53, f54, f55, f56, f57, f58,
+        f59, f60, f61, f62, f63, f64, f65, f66, f67, f68, f69, f70, f71, f72,
+        f73, f74, f75, f76, f77, f78, f79, f80, f81, f82, f83, f84, f85] = _t;
+    return _f(
+        f1, f2, f3, f4, f5, f6, f7, f8, f9, f10, f11, f12, f13, f14, f15, f16,
+        f17, f18, f19, f20, f21, f22, f23, f24, f25, f26, f27, f28, f29, f30,
+        f31, f32, f33, f34, f35, f36, f37, f38, f39, f40, f41, f42, f43, f44,
+        f45, f46, f47, f48, f49, f50, f51, f52, f53, f54, f55, f56, f57, f58,
+        f59, f60, f61, f62, f63, f64, f65, f66, f67, f68, f69, f70, f71, f72,
+        f73, f74, f75, f76, f77, f78, f79, f80, f81, f82, f83, f84, f85);
+  } else if constexpr (n == 86) {
+    auto& [
+        f1, f2, f3, f4, f5, f6, f7, f8, f9, f10, f11, f12, f13, f14, f15, f16,
+        f17, f18, f19, f20, f21, f22, f23, f24, f25, f26, f27, f28, f29, f30,
+        f31, f32, f33, f34, f35, f36, f37, f38, f39, f40, f41, f42, f43, f44,
+        f45, f46, f47, f48, f49, f50, f51, f52, f53, f54, f55, f56, f57, f58,
+        f59, f60, f61, f62, f63, f64, f65, f66, f67, f68, f69, f70, f71, f72,
+        f73, f74, f75, f76, f77, f78, f79, f80, f81, f82, f83, f84, f85,
+        f86] = _t;
+    return _f(
+        f1, f2, f3, f4, f5, f6, f7, f8, f9, f10, f11, f12, f13, f14, f15, f16,
+        f17, f18, f19, f20, f21, f22, f23, f24, f25, f26, f27, f28, f29, f30,
+        f31, f32, f33, f34, f35, f36, f37, f38, f39, f40, f41, f42, f43, f44,
+        f45, f46, f47, f48, f49, f50, f51, f52, f53, f54, f55, f56, f57, f58,
+        f59, f60, f61, f62, f63, f64, f65, f66, f67, f68, f69, f70, f71, f72,
+        f73, f74, f75, f76, f77, f78, f79, f80, f81, f82, f83, f84, f85, f86);
+  } else if constexpr (n == 87) {
+    auto& [
+        f1, f2, f3, f4, f5, f6, f7, f8, f9, f10, f11, f12, f13, f14, f15, f16,
+        f17, f18, f19, f20, f21, f22, f23, f24, f25, f26, f27, f28, f29, f30,
+        f31, f32, f33, f34, f35, f36, f37, f38, f39, f40, f41, f42, f43, f44,
+        f45, f46, f47, f48, f49, f50, f51, f52, f53, f54, f55, f56, f57, f58,
+        f59, f60, f61, f62, f63, f64, f65, f66, f67, f68, f69, f70, f71, f72,
+        f73, f74, f75, f76, f77, f78, f79, f80, f81, f82, f83, f84, f85, f86,
+        f87] = _t;
+    return _f(
+        f1, f2, f3, f4, f5, f6, f7, f8, f9, f10, f11, f12, f13, f14, f15, f16,
+        f17, f18, f19, f20, f21, f22, f23, f24, f25, f26, f27, f28, f29, f30,
+        f31, f32, f33, f34, f35, f36, f37, f38, f39, f40, f41, f42, f43, f44,
+        f45, f46, f47, f48, f49, f50, f51, f52, f53, f54, f55, f56, f57, f58,
+        f59, f60, f61, f62, f63, f64, f65, f66, f67, f68, f69, f70, f71, f72,
+        f73, f74, f75, f76, f77, f78, f79, f80, f81, f82, f83, f84, f85, f86,
+        f87);
+  } else if constexpr (n == 88) {
+    auto& [
+        f1, f2, f3, f4, f5, f6, f7, f8, f9, f10, f11, f12, f13, f14, f15, f16,
+        f17, f18, f19, f20, f21, f22, f23, f24, f25, f26, f27, f28, f29, f30,
+        f31, f32, f33, f34, f35, f36, f37, f38, f39, f40, f41, f42, f43, f44,
+        f45, f46, f47, f48, f49, f50, f51, f52, f53, f54, f55, f56, f57, f58,
+        f59, f60, f61, f62, f63, f64, f65, f66, f67, f68, f69, f70, f71, f72,
+        f73, f74, f75, f76, f77, f78, f79, f80, f81, f82, f83, f84, f85, f86,
+        f87, f88] = _t;
+    return _f(
+        f1, f2, f3, f4, f5, f6, f7, f8, f9, f10, f11, f12, f13, f14, f15, f16,
+        f17, f18, f19, f20, f21, f22, f23, f24, f25, f26, f27, f28, f29, f30,
+        f31, f32, f33, f34, f35, f36, f37, f38, f39, f40, f41, f42, f43, f44,
+        f45, f46, f47, f48, f49, f50, f51, f52, f53, f54, f55, f56, f57, f58,
+        f59, f60, f61, f62, f63, f64, f65, f66, f67, f68, f69, f70, f71, f72,
+        f73, f74, f75, f76, f77, f78, f79, f80, f81, f82, f83, f84, f85, f86,
+        f87, f88);
+  } else if constexpr (n == 89) {
+    auto& [
+        f1, f2, f3, f4, f5, f6, f7, f8, f9, f10, f11, f12, f13, f14, f15, f16,
+        f17, f18, f19, f20, f21, f22, f23, f24, f25, f26, f27, f28, f29, f30,
+        f31, f32, f33, f34, f35, f36, f37, f38, f39, f40, f41, f42, f43, f44,
+        f45, f46, f47, f48, f49, f50, f51, f52, f53, f54, f55, f56, f57, f58,
+        f59, f60, f61, f62, f63, f64, f65, f66, f67, f68, f69, f70, f71, f72,
+        f73, f74, f75, f76, f77, f78, f79, f80, f81, f82, f83, f84, f85, f86,
+        f87, f88, f89] = _t;
+    return _f(
+        f1, f2, f3, f4, f5, f6, f7, f8, f9, f10, f11, f12, f13, f14, f15, f16,
+        f17, f18, f19, f20, f21, f22, f23, f24, f25, f26, f27, f28, f29, f30,
+        f31, f32, f33, f34, f35, f36, f37, f38, f39, f40, f41, f42, f43, f44,
+        f45, f46, f47, f48, f49, f50, f51, f52, f53, f54, f55, f56, f57, f58,
+        f59, f60, f61, f62, f63, f64, f65, f66, f67, f68, f69, f70, f71, f72,
+        f73, f74, f75, f76, f77, f78, f79, f80, f81, f82, f83, f84, f85, f86,
+        f87, f88, f89);
+  } else if constexpr (n == 90) {
+    auto& [
+        f1, f2, f3, f4, f5, f6, f7, f8, f9, f10, f11, f12, f13, f14, f15, f16,
+        f17, f18, f19, f20, f21, f22, f23, f24, f25, f26, f27, f28, f29, f30,
+        f31, f32, f33, f34, f35, f36, f37, f38, f39, f40, f41, f42, f43, f44,
+        f45, f46, f47, f48, f49, f50, f51, f52, f53, f54, f55, f56, f57, f58,
+        f59, f60, f61, f62, f63, f64, f65, f66, f67, f68, f69, f70, f71, f72,
+        f73, f74, f75, f76, f77, f78, f79, f80, f81, f82, f83, f84, f85, f86,
+        f87, f88, f89, f90] = _t;
+    return _f(
+        f1, f2, f3, f4, f5, f6, f7, f8, f9, f10, f11, f12, f13, f14, f15, f16,
+        f17, f18, f19, f20, f21, f22, f23, f24, f25, f26, f27, f28, f29, f30,
+        f31, f32, f33, f34, f35, f36, f37, f38, f39, f40, f41, f42, f43, f44,
+        f45, f46, f47, f48, f49, f50, f51, f52, f53, f54, f55, f56, f57, f58,
+        f59, f60, f61, f62, f63, f64, f65, f66, f67, f68, f69, f70, f71, f72,
+        f73, f74, f75, f76, f77, f78, f79, f80, f81, f82, f83, f84, f85, f86,
+        f87, f88, f89, f90);
+  } else if constexpr (n == 91) {
+    auto& [
+        f1, f2, f3, f4, f5, f6, f7, f8, f9, f10, f11, f12, f13, f14, f15, f16,
+        f17, f18, f19, f20, f21, f22, f23, f24, f25, f26, f27, f28, f29, f30,
+        f31, f32, f33, f34, f35, f36, f37, f38, f39, f40, f41, f42, f43, f44,
+        f45, f46, f47, f48, f49, f50, f51, f52, f53, f54, f55, f56, f57, f58,
+        f59, f60, f61, f62, f63, f64, f65, f66, f67, f68, f69, f70, f71, f72,
+        f73, f74, f75, f76, f77, f78, f79, f80, f81, f82, f83, f84, f85, f86,
+        f87, f88, f89, f90, f91] = _t;
+    return _f(
+        f1, f2, f3, f4, f5, f6, f7, f8, f9, f10, f11, f12, f13, f14, f15, f16,
+        f17, f18, f19, f20, f21, f22, f23, f24, f25, f26, f27, f28, f29, f30,
+        f31, f32, f33, f34, f35, f36, f37, f38, f39, f40, f41, f42, f43, f44,
+        f45, f46, f47, f48, f49, f50, f51, f52, f53, f54, f55, f56, f57, f58,
+        f59, f60, f61, f62, f63, f64, f65, f66, f67, f68, f69, f70, f71, f72,
+        f73, f74, f75, f76, f77, f78, f79, f80, f81, f82, f83, f84, f85, f86,
+        f87, f88, f89, f90, f91);
+  } else if constexpr (n == 92) {
+    auto& [
+        f1, f2, f3, f4, f5, f6, f7, f8, f9, f10, f11, f12, f13, f14, f15, f16,
+        f17, f18, f19, f20, f21, f22, f23, f24, f25, f26, f27, f28, f29, f30,
+        f31, f32, f33, f34, f35, f36, f37, f38, f39, f40, f41, f42, f43, f44,
+        f45, f46, f47, f48, f49, f50, f51, f52, f53, f54, f55, f56, f57, f58,
+        f59, f60, f61, f62, f63, f64, f65, f66, f67, f68, f69, f70, f71, f72,
+        f73, f74, f75, f76, f77, f78, f79, f80, f81, f82, f83, f84, f85, f86,
+        f87, f88, f89, f90, f91, f92] = _t;
+    return _f(
+        f1, f2, f3, f4, f5, f6, f7, f8, f9, f10, f11, f12, f13, f14, f15, f16,
+        f17, f18, f19, f20, f21, f22, f23, f24, f25, f26, f27, f28, f29, f30,
+        f31, f32, f33, f34, f35, f36, f37, f38, f39, f40, f41, f42, f43, f44,
+        f45, f46, f47, f48, f49, f50, f51, f52, f53, f54, f55, f56, f57, f58,
+        f59, f60, f61, f62, f63, f64, f65, f66, f67, f68, f69, f70, f71, f72,
+        f73, f74, f75, f76, f77, f78, f79, f80, f81, f82, f83, f84, f85, f86,
+        f87, f88, f89, f90, f91, f92);
+  } else if constexpr (n == 93) {
+    auto& [
+        f1, f2, f3, f4, f5, f6, f7, f8, f9, f10, f11, f12, f13, f14, f15, f16,
+        f17, f18, f19, f20, f21, f22, f23, f24, f25, f26, f27, f28, f29, f30,
+        f31, f32, f33, f34, f35, f36, f37, f38, f39, f40, f41, f42, f43, f44,
+        f45, f46, f47, f48, f49, f50, f51, f52, f53, f54, f55, f56, f57, f58,
+        f59, f60, f61, f62, f63, f64, f65, f66, f67, f68, f69, f70, f71, f72,
+        f73, f74, f75, f76, f77, f78, f79, f80, f81, f82, f83, f84, f85, f86,
+        f87, f88, f89, f90, f91, f92, f93] = _t;
+    return _f(
+        f1, f2, f3, f4, f5, f6, f7, f8, f9, f10, f11, f12, f13, f14, f15, f16,
+        f17, f18, f19, f20, f21, f22, f23, f24, f25, f26, f27, f28, f29, f30,
+        f31, f32, f33, f34, f35, f36, f37, f38, f39, f40, f41, f42, f43, f44,
+        f45, f46, f47, f48, f49, f50, f51, f52, f53, f54, f55, f56, f57, f58,
+        f59, f60, f61, f62, f63, f64, f65, f66, f67, f68, f69, f70, f71, f72,
+        f73, f74, f75, f76, f77, f78, f79, f80, f81, f82, f83, f84, f85, f86,
+        f87, f88, f89, f90, f91, f92, f93);
+  } else if constexpr (n == 94) {
+    auto& [
+        f1, f2, f3, f4, f5, f6, f7, f8, f9, f10, f11, f12, f13, f14, f15, f16,
+        f17, f18, f19, f20, f21, f22, f23, f24, f25, f26, f27, f28, f29, f30,
+        f31, f32, f33, f34, f35, f36, f37, f38, f39, f40, f41, f42, f43, f44,
+        f45, f46, f47, f48, f49, f50, f51, f52, f53, f54, f55, f56, f57, f58,
+        f59, f60, f61, f62, f63, f64, f65, f66, f67, f68, f69, f70, f71, f72,
+        f73, f74, f75, f76, f77, f78, f79, f80, f81, f82, f83, f84, f85, f86,
+        f87, f88, f89, f90, f91, f92, f93, f94] = _t;
+    return _f(
+        f1, f2, f3, f4, f5, f6, f7, f8, f9, f10, f11, f12, f13, f14, f15, f16,
+        f17, f18, f19, f20, f21, f22, f23, f24, f25, f26, f27, f28, f29, f30,
+        f31, f32, f33, f34, f35, f36, f37, f38, f39, f40, f41, f42, f43, f44,
+        f45, f46, f47, f48, f49, f50, f51, f52, f53, f54, f55, f56, f57, f58,
+        f59, f60, f61, f62, f63, f64, f65, f66, f67, f68, f69, f70, f71, f72,
+        f73, f74, f75, f76, f77, f78, f79, f80, f81, f82, f83, f84, f85, f86,
+        f87, f88, f89, f90, f91, f92, f93, f94);
+  } else if constexpr (n == 95) {
+    auto& [
+        f1, f2, f3, f4, f5, f6, f7, f8, f9, f10, f11, f12, f13, f14, f15, f16,
+        f17, f18, f19, f20, f21, f22, f23, f24, f25, f26, f27, f28, f29, f30,
+        f31, f32, f33, f34, f35, f36, f37, f38, f39, f40, f41, f42, f43, f44,
+        f45, f46, f47, f48, f49, f50, f51, f52, f53, f54, f55, f56, f57, f58,
+        f59, f60, f61, f62, f63, f64, f65, f66, f67, f68, f69, f70, f71, f72,
+        f73, f74, f75, f76, f77, f78, f79, f80, f81, f82, f83, f84, f85, f86,
+        f87, f88, f89, f90, f91, f92, f93, f94, f95] = _t;
+    return _f(
+        f1, f2, f3, f4, f5, f6, f7, f8, f9, f10, f11, f12, f13, f14, f15, f16,
+        f17, f18, f19, f20, f21, f22, f23, f24, f25, f26, f27, f28, f29, f30,
+        f31, f32, f33, f34, f35, f36, f37, f38, f39, f40, f41, f42, f43, f44,
+        f45, f46, f47, f48, f49, f50, f51, f52, f53, f54, f55, f56, f57, f58,
+        f59, f60, f61, f62, f63, f64, f65, f66, f67, f68, f69, f70, f71, f72,
+        f73, f74, f75, f76, f77, f78, f79, f80, f81, f82, f83, f84, f85, f86,
+        f87, f88, f89, f90, f91, f92, f93, f94, f95);
+  } else if constexpr (n == 96) {
+    auto& [
+        f1, f2, f3, f4, f5, f6, f7, f8, f9, f10, f11, f12, f13, f14, f15, f16,
+        f17, f18, f19, f20, f21, f22, f23, f24, f25, f26, f27, f28, f29, f30,
+        f31, f32, f33, f34, f35, f36, f37, f38, f39, f40, f41, f42, f43, f44,
+        f45, f46, f47, f48, f49, f50, f51, f52, f53, f54, f55, f56, f57, f58,
+        f59, f60, f61, f62, f63, f64, f65, f66, f67, f68, f69, f70, f71, f72,
+        f73, f74, f75, f76, f77, f78, f79, f80, f81, f82, f83, f84, f85, f86,
+        f87, f88, f89, f90, f91, f92, f93, f94, f95, f96] = _t;
+    return _f(
+        f1, f2, f3, f4, f5, f6, f7, f8, f9, f10, f11, f12, f13, f14, f15, f16,
+        f17, f18, f19, f20, f21, f22, f23, f24, f25, f26, f27, f28, f29, f30,
+        f31, f32, f33, f34, f35, f36, f37, f38, f39, f40, f41, f42, f43, f44,
+        f45, f46, f47, f48, f49, f50, f51, f52, f53, f54, f55, f56, f57, f58,
+        f59, f60, f61, f62, f63, f64, f65, f66, f67, f68, f69, f70, f71, f72,
+        f73, f74, f75, f76, f77, f78, f79, f80, f81, f82, f83, f84, f85, f86,
+        f87, f88, f89, f90, f91, f92, f93, f94, f95, f96);
+  } else if constexpr (n == 97) {
+    auto& [
+        f1, f2, f3, f4, f5, f6, f7, f8, f9, f10, f11, f12, f13, f14, f15, f16,
+        f17, f18, f19, f20, f21, f22, f23, f24, f25, f26, f27, f28, f29, f30,
+        f31, f32, f33, f34, f35, f36, f37, f38, f39, f40, f41, f42, f43, f44,
+        f45, f46, f47, f48, f49, f50, f51, f52, f53, f54, f55, f56, f57, f58,
+        f59, f60, f61, f62, f63, f64, f65, f66, f67, f68, f69, f70, f71, f72,
+        f73, f74, f75, f76, f77, f78, f79, f80, f81, f82, f83, f84, f85, f86,
+        f87, f88, f89, f90, f91, f92, f93, f94, f95, f96, f97] = _t;
+    return _f(
+        f1, f2, f3, f4, f5, f6, f7, f8, f9, f10, f11, f12, f13, f14, f15, f16,
+        f17, f18, f19, f20, f21, f22, f23, f24, f25, f26, f27, f28, f29, f30,
+        f31, f32, f33, f34, f35, f36, f37, f38, f39, f40, f41, f42, f43, f44,
+        f45, f46, f47, f48, f49, f50, f51, f52, f53, f54, f55, f56, f57, f58,
+        f59, f60, f61, f62, f63, f64, f65, f66, f67, f68, f69, f70, f71, f72,
+        f73, f74, f75, f76, f77, f78, f79, f80, f81, f82, f83, f84, f85, f86,
+        f87, f88, f89, f90, f91, f92, f93, f94, f95, f96, f97);
+  } else if constexpr (n == 98) {
+    auto& [
+        f1, f2, f3, f4, f5, f6, f7, f8, f9, f10, f11, f12, f13, f14, f15, f16,
+        f17, f18, f19, f20, f21, f22, f23, f24, f25, f26, f27, f28, f29, f30,
+        f31, f32, f33, f34, f35, f36, f37, f38, f39, f40, f41, f42, f43, f44,
+        f45, f46, f47, f48, f49, f50, f51, f52, f53, f54, f55, f56, f57, f58,
+        f59, f60, f61, f62, f63, f64, f65, f66, f67, f68, f69, f70, f71, f72,
+        f73, f74, f75, f76, f77, f78, f79, f80, f81, f82, f83, f84, f85, f86,
+        f87, f88, f89, f90, f91, f92, f93, f94, f95, f96, f97, f98] = _t;
+    return _f(
+        f1, f2, f3, f4, f5, f6, f7, f8, f9, f10, f11, f12, f13, f14, f15, f16,
+        f17, f18, f19, f20, f21, f22, f23, f24, f25, f26, f27, f28, f29, f30,
+        f31, f32, f33, f34, f35, f36, f37, f38, f39, f40, f41, f42, f43, f44,
+        f45, f46, f47, f48, f49, f50, f51, f52, f53, f54, f55, f56, f57, f58,
+        f59, f60, f61, f62, f63, f64, f65, f66, f67, f68, f69, f70, f71, f72,
+        f73, f74, f75, f76, f77, f78, f79, f80, f81, f82, f83, f84, f85, f86,
+        f87, f88, f89, f90, f91, f92, f93, f94, f95, f96, f97, f98);
+  } else if constexpr (n == 99) {
+    auto& [
+        f1, f2, f3, f4, f5, f6, f7, f8, f9, f10, f11, f12, f13, f14, f15, f16,
+        f17, f18, f19, f20, f21, f22, f23, f24, f25, f26, f27, f28, f29, f30,
+        f31, f32, f33, f34, f35, f36, f37, f38, f39, f40, f41, f42, f43, f44,
+        f45, f46, f47, f48, f49, f50, f51, f52, f53, f54, f55, f56, f57, f58,
+        f59, f60, f61, f62, f63, f64, f65, f66, f67, f68, f69, f70, f71, f72,
+        f73, f74, f75, f76, f77, f78, f79, f80, f81, f82, f83, f84, f85, f86,
+        f87, f88, f89, f90, f91, f92, f93, f94, f95, f96, f97, f98, f99] = _t;
+    return _f(
+        f1, f2, f3, f4, f5, f6, f7, f8, f9, f10, f11, f12, f13, f14, f15, f16,
+        f17, f18, f19, f20, f21, f22, f23, f24, f25, f26, f27, f28, f29, f30,
+        f31, f32, f33, f34, f35, f36, f37, f38, f39, f40, f41, f42, f43, f44,
+        f45, f46, f47, f48, f49, f50, f51, f52, f53, f54, f55, f56, f57, f58,
+        f59, f60, f61, f62, f63, f64, f65, f66, f67, f68, f69, f70, f71, f72,
+        f73, f74, f75, f76, f77, f78, f79, f80, f81, f82, f83, f84, f85, f86,
+        f87, f88, f89, f90, f91, f92, f93, f94, f95, f96, f97, f98, f99);
+  } else if constexpr (n == 100) {
+    auto& [
+        f1, f2, f3, f4, f5, f6, f7, f8, f9, f10, f11, f12, f13, f14, f15, f16,
+        f17, f18, f19, f20, f21, f22, f23, f24, f25, f26, f27, f28, f29, f30,
+        f31, f32, f33, f34, f35, f36, f37, f38, f39, f40, f41, f42, f43, f44,
+        f45, f46, f47, f48, f49, f50, f51, f52, f53, f54, f55, f56, f57, f58,
+        f59, f60, f61, f62, f63, f64, f65, f66, f67, f68, f69, f70, f71, f72,
+        f73, f74, f75, f76, f77, f78, f79, f80, f81, f82, f83, f84, f85, f86,
+        f87, f88, f89, f90, f91, f92, f93, f94, f95, f96, f97, f98, f99,
+        f100] = _t;
+    return _f(
+        f1, f2, f3, f4, f5, f6, f7, f8, f9, f10, f11, f12, f13, f14, f15, f16,
+        f17, f18, f19, f20, f21, f22, f23, f24, f25, f26, f27, f28, f29, f30,
+        f31, f32, f33, f34, f35, f36, f37, f38, f39, f40, f41, f42, f43, f44,
+        f45, f46, f47, f48, f49, f50, f51, f52, f53, f54, f55, f56, f57, f58,
+        f59, f60, f61, f62, f63, f64, f65, f66, f67, f68, f69, f70, f71, f72,
+        f73, f74, f75, f76, f77, f78, f79, f80, f81, f82, f83, f84, f85, f86,
+        f87, f88, f89, f90, f91, f92, f93, f94, f95, f96, f97, f98, f99, f100);
+
+    // ---------------------------------
+    // End of generated boilerplate code
+    // ---------------------------------
+  } else {
+    static_assert(
+        rfl::always_false_v<T>,
+        "\n\nThis error occurs for one of two reasons:\n\n"
+        "1) You have created a struct with more than 100 fields, which is "
+        "unsupported. Please split up your struct into several "
+        "smaller structs and then use rfl::Flatten<...> to combine them. "
+        "Refer "
+        "to the documentation on rfl::Flatten<...> for details.\n\n"
+        "2) You have added a custom constructor to your struct, which you "
+        "shouldn't do either. Please refer to the sections on custom "
+        "classes or custom parsers in the documentation "
+        "for solutions to this problem.\n\n");
+  }
+}
+
+}  // namespace internal
+}  // namespace rfl
+
+#endif
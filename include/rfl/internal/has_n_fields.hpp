@@ -3,10 +3,14 @@
 
 #include <cstddef>
 #include <type_traits>
+#include <utility>
 
 namespace rfl {
 namespace internal {
 
+/// The maximum number of fields a struct can have.
+constexpr int max_num_fields = 100;
+
 struct any {
     template <typename T>
     constexpr operator T() const noexcept;
@@ -28,6 +32,85 @@ template <class T, int _n>
 constexpr bool has_n_fields = constructible_with_n_fields<T, _n>::value &&
                               !constructible_with_n_fields<T, _n + 1>::value;
 
+/// Like any, but cannot be converted to T itself, so that T(any_but<T>{}) is
+/// never mistaken for a copy or a move.
+template <class T>
+struct any_but {
+    template <typename U>
+    requires(!std::is_same_v<std::remove_cvref_t<U>, T>)
+    constexpr operator U() const noexcept;
+};
+
+/// Unlike braced initialization, parenthesized aggregate initialization
+/// value-initializes the fields that are not explicitly initialized. This
+/// works even for fields with explicit default constructors, like rfl::Field,
+/// so it is monotonic in the number of arguments for almost all structs and
+/// we can use it for a binary search.
+template <typename T, typename Is, typename = void>
+struct paren_constructible_impl : std::false_type {};
+
+template <typename T, std::size_t... Is>
+struct paren_constructible_impl<
+    T, std::index_sequence<Is...>,
+    std::void_t<decltype(T((void(Is), any_but<T>{})...))>> : std::true_type {
+};
+
+template <typename T, int _n>
+constexpr bool paren_constructible =
+    paren_constructible_impl<T, std::make_index_sequence<_n>>::value;
+
+/// Returns the largest n in [_lo, _hi] for which T is paren-constructible,
+/// assuming that it is paren-constructible with _lo arguments.
+template <class T, int _lo, int _hi>
+constexpr int search_num_fields() {
+    if constexpr (_lo == _hi) {
+        return _lo;
+    } else {
+        constexpr int mid = (_lo + _hi + 1) / 2;
+        if constexpr (paren_constructible<T, mid>) {
+            return search_num_fields<T, mid, _hi>();
+        } else {
+            return search_num_fields<T, _lo, mid - 1>();
+        }
+    }
+}
+
+/// Tries every number of fields in turn. Used for the rare structs for which
+/// the binary search does not work, for instance because they contain fields
+/// that cannot be default-constructed.
+template <class T, int _n = 0>
+constexpr int scan_num_fields() {
+    if constexpr (_n > max_num_fields) {
+        return -1;
+    } else if constexpr (has_n_fields<T, _n>) {
+        return _n;
+    } else {
+        return scan_num_fields<T, _n + 1>();
+    }
+}
+
+/// Counts the fields of an aggregate. Returns a number greater than
+/// max_num_fields, if there are too many fields, and -1, if the fields cannot
+/// be counted at all (for instance, because the struct has a custom
+/// constructor).
+template <class T>
+constexpr int count_fields() {
+#ifdef __cpp_aggregate_paren_init
+    constexpr int n = search_num_fields<T, 0, max_num_fields + 1>();
+    if constexpr (has_n_fields<T, n>) {
+        return n;
+    } else {
+        return scan_num_fields<T>();
+    }
+#else
+    return scan_num_fields<T>();
+#endif
+}
+
+/// The number of fields of the aggregate T.
+template <class T>
+constexpr int num_fields = count_fields<T>();
+
 }  // namespace internal
 }  // namespace rfl
 
@@ -0,0 +1,29 @@
+#ifndef RFL_INTERNAL_HASH_COMBINE_HPP_
+#define RFL_INTERNAL_HASH_COMBINE_HPP_
+
+#include <cstddef>
+#include <cstdint>
+
+namespace rfl {
+namespace internal {
+
+/// The finalizer of splitmix64 - cheap, but every input bit affects every
+/// output bit.
+constexpr std::uint64_t hash_mix(std::uint64_t _x) noexcept {
+  _x = (_x ^ (_x >> 30)) * 0xbf58476d1ce4e5b9ULL;
+  _x = (_x ^ (_x >> 27)) * 0x94d049bb133111ebULL;
+  return _x ^ (_x >> 31);
+}
+
+/// Combines the hash of the next element with the hashes of the previous
+/// elements. The order of the elements matters.
+constexpr size_t hash_combine(const size_t _seed, const size_t _h) noexcept {
+  return static_cast<size_t>(
+      hash_mix(static_cast<std::uint64_t>(_seed) + 0x9e3779b97f4a7c15ULL +
+               static_cast<std::uint64_t>(_h)));
+}
+
+}  // namespace internal
+}  // namespace rfl
+
+#endif
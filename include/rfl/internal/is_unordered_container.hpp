@@ -0,0 +1,21 @@
+#ifndef RFL_INTERNAL_IS_UNORDERED_CONTAINER_HPP_
+#define RFL_INTERNAL_IS_UNORDERED_CONTAINER_HPP_
+
+namespace rfl {
+namespace internal {
+
+/// Unordered containers (std::unordered_map, std::unordered_set, ...) are
+/// recognized by their hasher.
+template <class T>
+concept is_unordered_container = requires { typename T::hasher; };
+
+/// Containers for which every key appears at most once.
+template <class T>
+concept has_unique_keys = requires(T _t, typename T::value_type _v) {
+  { _t.insert(_v).second };
+};
+
+}  // namespace internal
+}  // namespace rfl
+
+#endif
@@ -1,40 +1,42 @@
 #ifndef RFL_INTERNAL_NO_DUPLICATE_FIELD_NAMES_HPP_
 #define RFL_INTERNAL_NO_DUPLICATE_FIELD_NAMES_HPP_
 
+#include <cstddef>
 #include <tuple>
+#include <type_traits>
+#include <utility>
 
 namespace rfl {
 namespace internal {
 
-template <class Fields, int _i = 1, int _j = 0>
+/// Whether the name of field _i differs from the names of all fields before
+/// it.
+template <class Fields, std::size_t _i, std::size_t... _js>
+constexpr bool differs_from_previous(std::index_sequence<_js...>) {
+    using FieldType = std::decay_t<std::tuple_element_t<_i, Fields>>;
+    return ((FieldType::name_ !=
+             std::decay_t<std::tuple_element_t<_js, Fields>>::name_) &&
+            ...);
+}
+
+template <class Fields, std::size_t... _is>
+constexpr bool all_names_differ(std::index_sequence<_is...>) {
+    return (differs_from_previous<Fields, _is>(
+                std::make_index_sequence<_is>()) &&
+            ...);
+}
+
+/// Compares every pair of field names. Uses fold expressions rather than
+/// recursion, so the instantiation depth does not grow with the number of
+/// fields.
+template <class Fields>
 constexpr inline bool no_duplicate_field_names() {
-    constexpr auto num_fields = std::tuple_size<Fields>{};
-
-    if constexpr (num_fields <= 1) {
-        return true;
-    } else {
-        if constexpr (_i == num_fields) {
-            return true;
-        } else if constexpr (_j == -1) {
-            return no_duplicate_field_names<Fields, _i + 1, _i>();
-        } else {
-            using FieldType1 =
-                std::decay_t<typename std::tuple_element<_i, Fields>::type>;
-            using FieldType2 =
-                std::decay_t<typename std::tuple_element<_j, Fields>::type>;
-
-            constexpr auto field_name_i = FieldType1::name_;
-            constexpr auto field_name_j = FieldType2::name_;
-
-            constexpr bool no_duplicate = (field_name_i != field_name_j);
-
-            static_assert(no_duplicate,
-                          "Duplicate field names are not allowed");
-
-            return no_duplicate &&
-                   no_duplicate_field_names<Fields, _i, _j - 1>();
-        }
-    }
+    constexpr bool no_duplicate = all_names_differ<Fields>(
+        std::make_index_sequence<std::tuple_size_v<Fields>>());
+
+    static_assert(no_duplicate, "Duplicate field names are not allowed");
+
+    return no_duplicate;
 }
 
 }  // namespace internal
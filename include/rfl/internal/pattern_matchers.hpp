@@ -0,0 +1,107 @@
+#ifndef RFL_INTERNAL_PATTERN_MATCHERS_HPP_
+#define RFL_INTERNAL_PATTERN_MATCHERS_HPP_
+
+#include <cstddef>
+#include <string_view>
+
+namespace rfl {
+namespace internal {
+
+/// Hand-written equivalents of the regexes in patterns.hpp. Each of them
+/// accepts exactly the same strings as the regex it replaces, in a single
+/// pass without backtracking.
+
+inline bool is_alpha(const char _c) {
+  return (_c >= 'a' && _c <= 'z') || (_c >= 'A' && _c <= 'Z');
+}
+
+inline bool is_alnum(const char _c) {
+  return is_alpha(_c) || (_c >= '0' && _c <= '9');
+}
+
+inline bool is_hex(const char _c) {
+  return (_c >= '0' && _c <= '9') || (_c >= 'a' && _c <= 'f') ||
+         (_c >= 'A' && _c <= 'F');
+}
+
+/// ^[A-Za-z0-9+/]*(={0,2})?$
+inline bool match_base64(const std::string_view& _str) {
+  size_t i = 0;
+  while (i < _str.size() &&
+         (is_alnum(_str[i]) || _str[i] == '+' || _str[i] == '/')) {
+    ++i;
+  }
+  const auto padding = _str.size() - i;
+  return padding <= 2 && _str.find_first_not_of('=', i) == _str.npos;
+}
+
+/// ^[a-zA-Z0-9._%+-]+@[a-zA-Z0-9.-]+\.[a-zA-Z]{2,}$
+inline bool match_email(const std::string_view& _str) {
+  const auto is_local = [](const char _c) {
+    return is_alnum(_c) || _c == '.' || _c == '_' || _c == '%' || _c == '+' ||
+           _c == '-';
+  };
+  size_t i = 0;
+  while (i < _str.size() && is_local(_str[i])) {
+    ++i;
+  }
+  if (i == 0 || i == _str.size() || _str[i] != '@') {
+    return false;
+  }
+  const auto domain = _str.substr(i + 1);
+  size_t last_dot = domain.npos;
+  for (size_t j = 0; j < domain.size(); ++j) {
+    const char c = domain[j];
+    if (c == '.') {
+      last_dot = j;
+    } else if (!is_alnum(c) && c != '-') {
+      return false;
+    }
+  }
+  // The top-level domain must consist of at least two letters, the part
+  // before it must not be empty.
+  if (last_dot == domain.npos || last_dot == 0 ||
+      domain.size() - last_dot - 1 < 2) {
+    return false;
+  }
+  for (size_t j = last_dot + 1; j < domain.size(); ++j) {
+    if (!is_alpha(domain[j])) {
+      return false;
+    }
+  }
+  return true;
+}
+
+/// ^[0-9a-fA-F]{8}-[0-9a-fA-F]{4}-V[0-9a-fA-F]{3}-[89abAB][0-9a-fA-F]{3}-
+/// [0-9a-fA-F]{12}$, where V is the version.
+template <char _version>
+inline bool match_uuid(const std::string_view& _str) {
+  if (_str.size() != 36) {
+    return false;
+  }
+  for (size_t i = 0; i < 36; ++i) {
+    const char c = _str[i];
+    if (i == 8 || i == 13 || i == 18 || i == 23) {
+      if (c != '-') {
+        return false;
+      }
+    } else if (i == 14) {
+      if (c != _version) {
+        return false;
+      }
+    } else if (i == 19) {
+      if (c != '8' && c != '9' && c != 'a' && c != 'b' && c != 'A' &&
+          c != 'B') {
+        return false;
+      }
+    } else if (!is_hex(c)) {
+      return false;
+    }
+  }
+  return true;
+}
+
+}  // namespace internal
+}  // namespace rfl
+
+#endif
@@ -0,0 +1,159 @@
+#ifndef RFL_INTERNAL_REGEX_DFA_HPP_
+#define RFL_INTERNAL_REGEX_DFA_HPP_
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <map>
+#include <optional>
+#include <string_view>
+#include <vector>
+
+#include "rfl/internal/regex/NFA.hpp"
+
+namespace rfl {
+namespace internal {
+namespace regex {
+
+/// A deterministic finite automaton, built from an NFA using the subset
+/// construction. Matching takes one table lookup per byte and never
+/// backtracks.
+class DFA {
+  static constexpr size_t max_states_ = 4096;
+
+ public:
+  /// Returns std::nullopt, if the DFA would have too many states.
+  static std::optional<DFA> from_nfa(const NFA& _nfa) {
+    auto dfa = DFA();
+    dfa.init_byte_classes(_nfa);
+
+    auto ixs = std::map<std::vector<int>, int>();
+    auto queue = std::vector<std::vector<int>>();
+
+    const auto add_state = [&](std::vector<int>&& _set) -> int {
+      const auto it = ixs.find(_set);
+      if (it != ixs.end()) {
+        return it->second;
+      }
+      const auto ix = static_cast<int>(queue.size());
+      dfa.accepting_.push_back(contains(_set, 0));
+      ixs[_set] = ix;
+      queue.emplace_back(std::move(_set));
+      return ix;
+    };
+
+    add_state(closure(_nfa, {_nfa.start_}));
+
+    for (size_t ix = 0; ix < queue.size(); ++ix) {
+      if (queue.size() > max_states_) {
+        return std::nullopt;
+      }
+      for (size_t cl = 0; cl < dfa.num_classes_; ++cl) {
+        const auto c = dfa.representatives_[cl];
+        auto next = std::vector<int>();
+        for (const auto s : queue[ix]) {
+          const auto& state = _nfa.states_[s];
+          if (state.next_ >= 0 && state.set_.test(c)) {
+            next.push_back(state.next_);
+          }
+        }
+        const auto target =
+            next.empty() ? -1 : add_state(closure(_nfa, std::move(next)));
+        dfa.transitions_.push_back(target);
+      }
+    }
+
+    return dfa;
+  }
+
+  /// Whether the automaton accepts the entire string.
+  bool match(const std::string_view& _str) const noexcept {
+    std::int32_t state = 0;
+    for (const char c : _str) {
+      state = transitions_[static_cast<size_t>(state) * num_classes_ +
+                           byte_classes_[static_cast<unsigned char>(c)]];
+      if (state < 0) {
+        return false;
+      }
+    }
+    return accepting_[static_cast<size_t>(state)];
+  }
+
+ private:
+  DFA() = default;
+
+  /// Bytes that are contained in exactly the same sets of the NFA can never
+  /// be distinguished, so they share a column in the transition table.
+  void init_byte_classes(const NFA& _nfa) {
+    auto signatures = std::map<std::vector<bool>, std::uint8_t>();
+    for (size_t c = 0; c < 256; ++c) {
+      auto signature = std::vector<bool>();
+      signature.reserve(_nfa.states_.size());
+      for (const auto& state : _nfa.states_) {
+        signature.push_back(state.next_ >= 0 && state.set_.test(c));
+      }
+      const auto it = signatures.find(signature);
+      if (it != signatures.end()) {
+        byte_classes_[c] = it->second;
+        continue;
+      }
+      const auto cl = static_cast<std::uint8_t>(signatures.size());
+      signatures[signature] = cl;
+      byte_classes_[c] = cl;
+      representatives_.push_back(c);
+    }
+    num_classes_ = signatures.size();
+  }
+
+  /// All states reachable from _states without consuming any input. Only
+  /// states that consume input or accept are retained, so equivalent sets are
+  /// represented identically.
+  static std::vector<int> closure(const NFA& _nfa,
+                                  std::vector<int>&& _states) {
+    auto visited = std::vector<bool>(_nfa.states_.size());
+    auto result = std::vector<int>();
+    auto stack = std::move(_states);
+    while (!stack.empty()) {
+      const auto s = stack.back();
+      stack.pop_back();
+      if (visited[s]) {
+        continue;
+      }
+      visited[s] = true;
+      const auto& state = _nfa.states_[s];
+      if (s == 0 || state.next_ >= 0) {
+        result.push_back(s);
+      }
+      stack.insert(stack.end(), state.eps_.begin(), state.eps_.end());
+    }
+    std::sort(result.begin(), result.end());
+    return result;
+  }
+
+  static bool contains(const std::vector<int>& _sorted, const int _s) {
+    return std::binary_search(_sorted.begin(), _sorted.end(), _s);
+  }
+
+ private:
+  /// Whether a state is accepting.
+  std::vector<bool> accepting_;
+
+  /// Maps every byte to its class.
+  std::array<std::uint8_t, 256> byte_classes_{};
+
+  /// The number of byte classes.
+  size_t num_classes_ = 0;
+
+  /// One byte for every class.
+  std::vector<size_t> representatives_;
+
+  /// The next state for every state and byte class, -1 if there is none.
+  std::vector<std::int32_t> transitions_;
+};
+
+}  // namespace regex
+}  // namespace internal
+}  // namespace rfl
+
+#endif
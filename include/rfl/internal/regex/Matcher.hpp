@@ -0,0 +1,61 @@
+#ifndef RFL_INTERNAL_REGEX_MATCHER_HPP_
+#define RFL_INTERNAL_REGEX_MATCHER_HPP_
+
+#include <optional>
+#include <regex>
+#include <string>
+#include <string_view>
+
+#include "rfl/internal/regex/DFA.hpp"
+#include "rfl/internal/regex/NFA.hpp"
+
+namespace rfl {
+namespace internal {
+namespace regex {
+
+/// Matches entire strings against a regex. Whenever possible, the regex is
+/// compiled into a DFA, which runs in linear time. Regexes using features the
+/// DFA does not support fall back to std::regex.
+class Matcher {
+ public:
+  /// Returns std::nullopt, if the regex could not be compiled.
+  static std::optional<Matcher> make(const std::string& _regex) noexcept {
+    try {
+      auto matcher = Matcher();
+      const auto nfa = NFABuilder::build(_regex);
+      if (nfa) {
+        matcher.dfa_ = DFA::from_nfa(*nfa);
+      }
+      if (!matcher.dfa_) {
+        matcher.regex_ = std::regex(_regex);
+      }
+      return matcher;
+    } catch (std::exception& e) {
+      return std::nullopt;
+    }
+  }
+
+  /// Whether the entire string matches the regex.
+  bool match(const std::string_view& _str) const noexcept {
+    if (dfa_) {
+      return dfa_->match(_str);
+    }
+    return std::regex_match(_str.begin(), _str.end(), *regex_);
+  }
+
+ private:
+  Matcher() = default;
+
+ private:
+  /// The compiled automaton, if the regex is supported.
+  std::optional<DFA> dfa_;
+
+  /// The fallback for all other regexes.
+  std::optional<std::regex> regex_;
+};
+
+}  // namespace regex
+}  // namespace internal
+}  // namespace rfl
+
+#endif
@@ -0,0 +1,500 @@
+#ifndef RFL_INTERNAL_REGEX_NFA_HPP_
+#define RFL_INTERNAL_REGEX_NFA_HPP_
+
+#include <bitset>
+#include <cstddef>
+#include <optional>
+#include <string_view>
+#include <vector>
+
+namespace rfl {
+namespace internal {
+namespace regex {
+
+/// A set of bytes.
+using CharSet = std::bitset<256>;
+
+/// A state in a Thompson NFA. A state either consumes a byte contained in
+/// set_ and moves on to next_ or it moves on to all states in eps_ without
+/// consuming anything.
+struct NFAState {
+  CharSet set_ = CharSet();
+  int next_ = -1;
+  std::vector<int> eps_ = std::vector<int>();
+};
+
+/// A nondeterministic finite automaton. The state at index 0 is the only
+/// accepting state.
+struct NFA {
+  std::vector<NFAState> states_;
+  int start_ = 0;
+};
+
+/// Parses a subset of the ECMAScript regex syntax, which is what std::regex
+/// uses by default, and builds an NFA from it. The subset consists of
+/// literals, escapes, character classes, '.', groups, alternations and all
+/// quantifiers. Returns std::nullopt for everything else, such as
+/// backreferences, lookaheads or word boundaries, in which case the caller
+/// should fall back to std::regex.
+class NFABuilder {
+  static constexpr size_t max_states_ = 20000;
+
+  /// A node in the syntax tree.
+  struct Node {
+    enum class Kind { set, concat, alternation, repeat };
+    Kind kind_;
+    CharSet set_ = CharSet();
+    std::vector<size_t> children_ = std::vector<size_t>();
+    int min_ = 0;
+    int max_ = 0;
+  };
+
+ public:
+  static std::optional<NFA> build(const std::string_view& _regex) {
+    auto builder = NFABuilder(_regex);
+    const auto root = builder.parse_alternation();
+    if (!root || builder.pos_ != _regex.size()) {
+      return std::nullopt;
+    }
+    auto nfa = NFA{};
+    nfa.states_.emplace_back();
+    const auto start = builder.compile(*root, 0, &nfa);
+    if (!start) {
+      return std::nullopt;
+    }
+    nfa.start_ = *start;
+    return nfa;
+  }
+
+ private:
+  explicit NFABuilder(const std::string_view& _regex) : regex_(_regex) {}
+
+  bool at_end() const { return pos_ == regex_.size(); }
+
+  char peek() const { return regex_[pos_]; }
+
+  size_t add(Node&& _node) {
+    nodes_.emplace_back(std::move(_node));
+    return nodes_.size() - 1;
+  }
+
+  size_t add_set(const CharSet& _set) {
+    return add(Node{.kind_ = Node::Kind::set, .set_ = _set});
+  }
+
+  size_t add_empty() { return add(Node{.kind_ = Node::Kind::concat}); }
+
+  std::optional<size_t> parse_alternation() {
+    auto children = std::vector<size_t>();
+    while (true) {
+      const auto concat = parse_concat();
+      if (!concat) {
+        return std::nullopt;
+      }
+      children.push_back(*concat);
+      if (at_end() || peek() != '|') {
+        break;
+      }
+      ++pos_;
+    }
+    if (children.size() == 1) {
+      return children[0];
+    }
+    return add(Node{.kind_ = Node::Kind::alternation,
+                    .children_ = std::move(children)});
+  }
+
+  std::optional<size_t> parse_concat() {
+    auto children = std::vector<size_t>();
+    while (!at_end() && peek() != '|' && peek() != ')') {
+      const auto repeat = parse_repeat();
+      if (!repeat) {
+        return std::nullopt;
+      }
+      children.push_back(*repeat);
+    }
+    return add(
+        Node{.kind_ = Node::Kind::concat, .children_ = std::move(children)});
+  }
+
+  std::optional<size_t> parse_repeat() {
+    auto atom = parse_atom();
+    while (atom && !at_end()) {
+      int min = 0;
+      int max = -1;
+      const char c = peek();
+      if (c == '*') {
+        ++pos_;
+      } else if (c == '+') {
+        min = 1;
+        ++pos_;
+      } else if (c == '?') {
+        max = 1;
+        ++pos_;
+      } else if (c == '{') {
+        ++pos_;
+        if (!parse_bounds(&min, &max)) {
+          return std::nullopt;
+        }
+      } else {
+        break;
+      }
+      // Lazy quantifiers match the same set of strings.
+      if (!at_end() && peek() == '?') {
+        ++pos_;
+      }
+      atom = add(Node{.kind_ = Node::Kind::repeat,
+                      .children_ = {*atom},
+                      .min_ = min,
+                      .max_ = max});
+    }
+    return atom;
+  }
+
+  bool parse_bounds(int* _min, int* _max) {
+    const auto min = parse_number();
+    if (!min) {
+      return false;
+    }
+    *_min = *_max = *min;
+    if (!at_end() && peek() == ',') {
+      ++pos_;
+      *_max = -1;
+      if (!at_end() && peek() != '}') {
+        const auto max = parse_number();
+        if (!max || *max < *min) {
+          return false;
+        }
+        *_max = *max;
+      }
+    }
+    if (at_end() || peek() != '}') {
+      return false;
+    }
+    ++pos_;
+    return true;
+  }
+
+  std::optional<int> parse_number() {
+    int n = 0;
+    const auto begin = pos_;
+    while (!at_end() && peek() >= '0' && peek() <= '9' && n <= 1000) {
+      n = n * 10 + (peek() - '0');
+      ++pos_;
+    }
+    if (pos_ == begin || n > 1000) {
+      return std::nullopt;
+    }
+    return n;
+  }
+
+  std::optional<size_t> parse_atom() {
+    const char c = peek();
+    switch (c) {
+      case '(': {
+        ++pos_;
+        if (!at_end() && peek() == '?') {
+          if (pos_ + 1 == regex_.size() || regex_[pos_ + 1] != ':') {
+            return std::nullopt;
+          }
+          pos_ += 2;
+        }
+        const auto inner = parse_alternation();
+        if (!inner || at_end() || peek() != ')') {
+          return std::nullopt;
+        }
+        ++pos_;
+        return inner;
+      }
+
+      case '[':
+        ++pos_;
+        return parse_class();
+
+      case '.': {
+        ++pos_;
+        auto set = CharSet().set();
+        set.reset('\n');
+        set.reset('\r');
+        return add_set(set);
+      }
+
+      case '\\': {
+        ++pos_;
+        auto set = CharSet();
+        if (!parse_escape(false, &set)) {
+          return std::nullopt;
+        }
+        return add_set(set);
+      }
+
+      case '^':
+        // Anchors are only supported where they are implied by a full match.
+        if (pos_ != 0) {
+          return std::nullopt;
+        }
+        ++pos_;
+        return add_empty();
+
+      case '$':
+        if (pos_ + 1 != regex_.size()) {
+          return std::nullopt;
+        }
+        ++pos_;
+        return add_empty();
+
+      case '*':
+      case '+':
+      case '?':
+      case '{':
+        return std::nullopt;
+
+      default:
+        ++pos_;
+        return add_set(CharSet().set(static_cast<unsigned char>(c)));
+    }
+  }
+
+  std::optional<size_t> parse_class() {
+    auto set = CharSet();
+    bool negate = false;
+    if (!at_end() && peek() == '^') {
+      negate = true;
+      ++pos_;
+    }
+    while (!at_end() && peek() != ']') {
+      auto lower = CharSet();
+      if (!parse_class_atom(&lower)) {
+        return std::nullopt;
+      }
+      if (pos_ + 1 < regex_.size() && peek() == '-' &&
+          regex_[pos_ + 1] != ']') {
+        ++pos_;
+        auto upper = CharSet();
+        if (!parse_class_atom(&upper) || lower.count() != 1 ||
+            upper.count() != 1) {
+          return std::nullopt;
+        }
+        const auto lo = first(lower);
+        const auto hi = first(upper);
+        if (lo > hi) {
+          return std::nullopt;
+        }
+        for (size_t i = lo; i <= hi; ++i) {
+          set.set(i);
+        }
+      } else {
+        set |= lower;
+      }
+    }
+    if (at_end()) {
+      return std::nullopt;
+    }
+    ++pos_;
+    return add_set(negate ? ~set : set);
+  }
+
+  bool parse_class_atom(CharSet* _set) {
+    const char c = peek();
+    ++pos_;
+    if (c == '\\') {
+      return parse_escape(true, _set);
+    }
+    _set->set(static_cast<unsigned char>(c));
+    return true;
+  }
+
+  bool parse_escape(const bool _in_class, CharSet* _set) {
+    if (at_end()) {
+      return false;
+    }
+    const char c = peek();
+    ++pos_;
+    switch (c) {
+      case 'd':
+      case 'D':
+        set_range('0', '9', _set);
+        break;
+      case 'w':
+      case 'W':
+        set_range('a', 'z', _set);
+        set_range('A', 'Z', _set);
+        set_range('0', '9', _set);
+        _set->set('_');
+        break;
+      case 's':
+      case 'S':
+        for (const char s : {' ', '\t', '\n', '\v', '\f', '\r'}) {
+          _set->set(static_cast<unsigned char>(s));
+        }
+        break;
+      case 't':
+        _set->set('\t');
+        return true;
+      case 'n':
+        _set->set('\n');
+        return true;
+      case 'r':
+        _set->set('\r');
+        return true;
+      case 'f':
+        _set->set('\f');
+        return true;
+      case 'v':
+        _set->set('\v');
+        return true;
+      case '0':
+        _set->set(0);
+        return true;
+      case 'b':
+        // Outside of a class, \b is a word boundary.
+        if (!_in_class) {
+          return false;
+        }
+        _set->set('\b');
+        return true;
+      case 'x': {
+        if (pos_ + 2 > regex_.size()) {
+          return false;
+        }
+        const auto hi = hex_value(regex_[pos_]);
+        const auto lo = hex_value(regex_[pos_ + 1]);
+        if (hi < 0 || lo < 0) {
+          return false;
+        }
+        pos_ += 2;
+        _set->set(static_cast<size_t>(hi * 16 + lo));
+        return true;
+      }
+      default:
+        // Backreferences, \B, \c, \u and unknown escapes are not supported.
+        if ((c >= 'a' && c <= 'z') || (c >= 'A' && c <= 'Z') ||
+            (c >= '0' && c <= '9')) {
+          return false;
+        }
+        _set->set(static_cast<unsigned char>(c));
+        return true;
+    }
+    if (c >= 'A' && c <= 'Z') {
+      if (_in_class) {
+        // Negated classes inside a class, like [^\D], are rare enough.
+        return false;
+      }
+      _set->flip();
+    }
+    return true;
+  }
+
+  static void set_range(const char _lo, const char _hi, CharSet* _set) {
+    for (char c = _lo; c <= _hi; ++c) {
+      _set->set(static_cast<unsigned char>(c));
+    }
+  }
+
+  static size_t first(const CharSet& _set) {
+    size_t i = 0;
+    while (!_set.test(i)) {
+      ++i;
+    }
+    return i;
+  }
+
+  static int hex_value(const char _c) {
+    if (_c >= '0' && _c <= '9') {
+      return _c - '0';
+    } else if (_c >= 'a' && _c <= 'f') {
+      return _c - 'a' + 10;
+    } else if (_c >= 'A' && _c <= 'F') {
+      return _c - 'A' + 10;
+    }
+    return -1;
+  }
+
+  /// Compiles the node into states that continue with _next once the node
+  /// has been matched. Returns the state to start with.
+  std::optional<int> compile(const size_t _ix, const int _next,
+                             NFA* _nfa) const {
+    if (_nfa->states_.size() > max_states_) {
+      return std::nullopt;
+    }
+    const auto& node = nodes_[_ix];
+    switch (node.kind_) {
+      case Node::Kind::set: {
+        _nfa->states_.push_back(NFAState{.set_ = node.set_, .next_ = _next});
+        return static_cast<int>(_nfa->states_.size() - 1);
+      }
+
+      case Node::Kind::concat: {
+        std::optional<int> next = _next;
+        for (auto it = node.children_.rbegin();
+             next && it != node.children_.rend(); ++it) {
+          next = compile(*it, *next, _nfa);
+        }
+        return next;
+      }
+
+      case Node::Kind::alternation: {
+        auto eps = std::vector<int>();
+        for (const auto child : node.children_) {
+          const auto start = compile(child, _next, _nfa);
+          if (!start) {
+            return std::nullopt;
+          }
+          eps.push_back(*start);
+        }
+        _nfa->states_.push_back(NFAState{.eps_ = std::move(eps)});
+        return static_cast<int>(_nfa->states_.size() - 1);
+      }
+
+      case Node::Kind::repeat:
+        return compile_repeat(node, _next, _nfa);
+    }
+    return std::nullopt;
+  }
+
+  std::optional<int> compile_repeat(const Node& _node, const int _next,
+                                    NFA* _nfa) const {
+    const auto child = _node.children_[0];
+    std::optional<int> next = _next;
+    if (_node.max_ < 0) {
+      // The loop: Either match the child once more or continue.
+      _nfa->states_.emplace_back();
+      const auto loop = static_cast<int>(_nfa->states_.size() - 1);
+      const auto start = compile(child, loop, _nfa);
+      if (!start) {
+        return std::nullopt;
+      }
+      _nfa->states_[loop].eps_ = {*start, _next};
+      next = loop;
+    } else {
+      for (int i = _node.min_; next && i < _node.max_; ++i) {
+        const auto start = compile(child, *next, _nfa);
+        if (!start) {
+          return std::nullopt;
+        }
+        _nfa->states_.push_back(NFAState{.eps_ = {*start, _next}});
+        next = static_cast<int>(_nfa->states_.size() - 1);
+      }
+    }
+    for (int i = 0; next && i < _node.min_; ++i) {
+      next = compile(child, *next, _nfa);
+    }
+    return next;
+  }
+
+ private:
+  /// The regex to be parsed.
+  std::string_view regex_;
+
+  /// The current position in regex_.
+  size_t pos_ = 0;
+
+  /// The nodes of the syntax tree.
+  std::vector<Node> nodes_;
+};
+
+}  // namespace regex
+}  // namespace internal
+}  // namespace rfl
+
+#endif
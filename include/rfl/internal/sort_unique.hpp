@@ -0,0 +1,34 @@
+#ifndef RFL_INTERNAL_SORT_UNIQUE_HPP_
+#define RFL_INTERNAL_SORT_UNIQUE_HPP_
+
+#include <algorithm>
+#include <functional>
+#include <vector>
+
+namespace rfl {
+namespace internal {
+
+/// Sorts _entries by their projected keys and removes all but the first of
+/// several entries with equivalent keys, which is what inserting them one by
+/// one into a std::map would do. Input that is already strictly sorted is
+/// recognized in a single pass and left untouched.
+template <class T, class Compare, class Proj>
+void sort_unique(std::vector<T>* _entries, const Compare& _comp,
+                 const Proj& _proj) {
+  const auto not_less = [&](const T& _a, const T& _b) {
+    return !_comp(std::invoke(_proj, _a), std::invoke(_proj, _b));
+  };
+  if (std::adjacent_find(_entries->begin(), _entries->end(), not_less) ==
+      _entries->end()) {
+    return;
+  }
+  std::ranges::stable_sort(*_entries, _comp, _proj);
+  const auto last =
+      std::unique(_entries->begin(), _entries->end(), not_less);
+  _entries->erase(last, _entries->end());
+}
+
+}  // namespace internal
+}  // namespace rfl
+
+#endif
@@ -0,0 +1,40 @@
+#ifndef RFL_INTERNAL_SORTED_FIELD_NAMES_HPP_
+#define RFL_INTERNAL_SORTED_FIELD_NAMES_HPP_
+
+#include <algorithm>
+#include <array>
+#include <cstdint>
+#include <string_view>
+
+namespace rfl {
+namespace internal {
+
+/// The name of a field and its index in the NamedTuple.
+struct IndexedName {
+  std::string_view name_;
+  std::int16_t ix_;
+};
+
+/// The names of the fields sorted in lexicographical order, calculated at
+/// compile time.
+template <class... FieldTypes>
+constexpr std::array<IndexedName, sizeof...(FieldTypes)> sorted_field_names() {
+  std::array<IndexedName, sizeof...(FieldTypes)> names;
+  std::int16_t i = 0;
+  ((names[i] = IndexedName{std::string_view(FieldTypes::name_.value_,
+                                            sizeof(FieldTypes::name_.value_) -
+                                                1),
+                           i},
+    ++i),
+   ...);
+  std::sort(names.begin(), names.end(),
+            [](const IndexedName& _a, const IndexedName& _b) {
+              return _a.name_ < _b.name_;
+            });
+  return names;
+}
+
+}  // namespace internal
+}  // namespace rfl
+
+#endif
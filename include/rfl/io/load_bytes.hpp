@@ -11,7 +11,7 @@
 namespace rfl {
 namespace io {
 
-Result<std::vector<unsigned char>> load_bytes(const std::string& _fname) {
+inline Result<std::vector<unsigned char>> load_bytes(const std::string& _fname) {
   std::ifstream input(_fname, std::ios::binary);
   if (input.is_open()) {
     std::istreambuf_iterator<char> begin(input), end;
@@ -11,8 +11,8 @@
 namespace rfl {
 namespace io {
 
-Result<Nothing> save_bytes(const std::string& _fname,
-                           const std::vector<unsigned char>& _bytes) {
+inline Result<Nothing> save_bytes(const std::string& _fname,
+                                  const std::vector<unsigned char>& _bytes) {
   try {
     std::ofstream output(_fname, std::ios::out | std::ios::binary);
     output.write(reinterpret_cast<const char*>(_bytes.data()), _bytes.size());
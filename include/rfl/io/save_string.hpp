@@ -10,8 +10,8 @@
 namespace rfl {
 namespace io {
 
-Result<Nothing> save_string(const std::string& _fname,
-                            const std::string& _str) {
+inline Result<Nothing> save_string(const std::string& _fname,
+                                   const std::string& _str) {
     try {
         std::ofstream outfile;
         outfile.open(_fname);
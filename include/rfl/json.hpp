@@ -4,9 +4,13 @@
 #include "rfl/json/Parser.hpp"
 #include "rfl/json/Reader.hpp"
 #include "rfl/json/Writer.hpp"
+#include "rfl/json/apply_patch.hpp"
+#include "rfl/json/diff.hpp"
 #include "rfl/json/load.hpp"
 #include "rfl/json/read.hpp"
+#include "rfl/json/read_into.hpp"
 #include "rfl/json/save.hpp"
+#include "rfl/json/serializers.hpp"
 #include "rfl/json/write.hpp"
 
 #endif
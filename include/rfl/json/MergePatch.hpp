@@ -0,0 +1,416 @@
+#ifndef RFL_JSON_MERGEPATCH_HPP_
+#define RFL_JSON_MERGEPATCH_HPP_
+
+#include <yyjson.h>
+
+#include <map>
+#include <memory>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <tuple>
+#include <type_traits>
+#include <unordered_map>
+#include <vector>
+
+#include "rfl/Box.hpp"
+#include "rfl/Result.hpp"
+#include "rfl/internal/has_fields.hpp"
+#include "rfl/internal/has_reflection_type_v.hpp"
+#include "rfl/internal/is_basic_type.hpp"
+#include "rfl/internal/is_named_tuple.hpp"
+#include "rfl/internal/nt_to_ptr_named_tuple.hpp"
+#include "rfl/internal/to_ptr_named_tuple.hpp"
+#include "rfl/json/Parser.hpp"
+#include "rfl/json/Reader.hpp"
+#include "rfl/json/Writer.hpp"
+#include "rfl/named_tuple_t.hpp"
+#include "rfl/parsing/InPlaceParser.hpp"
+#include "rfl/parsing/is_required.hpp"
+#include "rfl/parsing/to_single_error.hpp"
+
+namespace rfl {
+namespace json {
+
+/// Generates and applies JSON merge patches as defined in RFC 7396. Structs,
+/// named tuples and string-keyed maps are compared field by field, so only
+/// the fields that have actually changed end up in the patch. Everything
+/// else is compared by its JSON representation, so that a receiver merging
+/// the patch recursively, as RFC 7396 requires, ends up with the same value.
+template <class T>
+struct MergePatch;
+
+/// Generates the merge patch that turns the JSON value _old into _new or
+/// returns nullptr, if they are equal. Objects are compared key by key and
+/// keys that are missing in _new are marked as null, because a receiver
+/// merges objects rather than replacing them. Everything else is replaced.
+inline yyjson_mut_val* diff_values(yyjson_mut_doc* _doc, yyjson_mut_val* _old,
+                                   yyjson_mut_val* _new) noexcept {
+  if (!yyjson_mut_is_obj(_old) || !yyjson_mut_is_obj(_new)) {
+    return yyjson_mut_equals(_old, _new) ? nullptr : _new;
+  }
+
+  auto patch = yyjson_mut_obj(_doc);
+
+  size_t ix = 0, max = 0;
+  yyjson_mut_val *key = nullptr, *val = nullptr;
+
+  yyjson_mut_obj_foreach(_new, ix, max, key, val) {
+    const auto old_val = yyjson_mut_obj_getn(_old, yyjson_mut_get_str(key),
+                                             yyjson_mut_get_len(key));
+    const auto p = old_val ? diff_values(_doc, old_val, val) : val;
+    if (p) {
+      // Values are linked into their parent, so they must be copied before
+      // they can be added to the patch.
+      yyjson_mut_obj_add(patch, yyjson_mut_val_mut_copy(_doc, key),
+                         p == val ? yyjson_mut_val_mut_copy(_doc, val) : p);
+    }
+  }
+
+  yyjson_mut_obj_foreach(_old, ix, max, key, val) {
+    if (!yyjson_mut_obj_getn(_new, yyjson_mut_get_str(key),
+                             yyjson_mut_get_len(key))) {
+      yyjson_mut_obj_add(patch, yyjson_mut_val_mut_copy(_doc, key),
+                         yyjson_mut_null(_doc));
+    }
+  }
+
+  return yyjson_mut_obj_size(patch) != 0 ? patch : nullptr;
+}
+
+/// Whether T is expressed as a JSON object that can be diffed field by field.
+template <class T>
+constexpr bool is_patchable_struct() {
+  if constexpr (Reader::has_custom_constructor<T> ||
+                internal::has_reflection_type_v<T>) {
+    return false;
+  } else if constexpr (internal::is_named_tuple_v<T>) {
+    return true;
+  } else if constexpr (std::is_class_v<T> && std::is_aggregate_v<T>) {
+    return internal::has_fields<T>();
+  } else {
+    return false;
+  }
+}
+
+/// Generates a named tuple of pointers to the fields of _t.
+template <class T>
+auto to_patch_ptrs(const T& _t) {
+  if constexpr (internal::is_named_tuple_v<T>) {
+    return internal::nt_to_ptr_named_tuple(_t);
+  } else {
+    return internal::to_ptr_named_tuple(_t);
+  }
+}
+
+// ----------------------------------------------------------------------------
+
+/// Default case - structs, named tuples and everything that is replaced as a
+/// whole.
+template <class T>
+struct MergePatch {
+  using InputVarType = typename Reader::InputVarType;
+  using OutputVarType = typename Writer::OutputVarType;
+
+  /// Returns the patch that turns _old into _new or std::nullopt, if they
+  /// are identical.
+  static std::optional<OutputVarType> diff(const Writer& _w, const T& _old,
+                                           const T& _new) noexcept {
+    if constexpr (is_patchable_struct<T>()) {
+      const auto old_ptrs = to_patch_ptrs(_old);
+      const auto new_ptrs = to_patch_ptrs(_new);
+      auto obj = _w.new_object();
+      if (!diff_field_by_field(_w, old_ptrs, new_ptrs, &obj)) {
+        return std::nullopt;
+      }
+      return OutputVarType(obj);
+    } else if constexpr (internal::is_basic_type_v<T>) {
+      if (_old == _new) {
+        return std::nullopt;
+      }
+      return Parser<T>::write(_w, _new);
+    } else {
+      const auto old_var = Parser<T>::write(_w, _old);
+      const auto new_var = Parser<T>::write(_w, _new);
+      const auto patch = diff_values(_w.doc_, old_var.val_, new_var.val_);
+      if (!patch) {
+        return std::nullopt;
+      }
+      return OutputVarType(patch);
+    }
+  }
+
+  /// Applies _patch to _target, touching only the fields contained in the
+  /// patch.
+  static Result<Nothing> apply(const Reader& _r, const InputVarType& _patch,
+                               T* _target) noexcept {
+    if (_r.is_empty(_patch)) {
+      return remove(_target);
+    }
+    if constexpr (is_patchable_struct<T>()) {
+      auto ptrs = to_patch_ptrs(*_target);
+      return apply_to_fields(_r, _patch, &ptrs);
+    } else if constexpr (internal::is_basic_type_v<T>) {
+      return parsing::InPlaceParser<Reader, Writer, T>::read(_r, _patch,
+                                                             _target);
+    } else {
+      if (!yyjson_is_obj(_patch.val_)) {
+        return parsing::InPlaceParser<Reader, Writer, T>::read(_r, _patch,
+                                                               _target);
+      }
+      return merge_and_read(_r, _patch, _target);
+    }
+  }
+
+  /// Handles null values in the patch, which signify removal.
+  static Result<Nothing> remove(T* _target) noexcept {
+    if constexpr (parsing::is_required<T>()) {
+      return Error("Value cannot be removed, because it is required.");
+    } else {
+      *_target = T();
+      return Nothing{};
+    }
+  }
+
+ private:
+  template <int _i = 0, class PtrNamedTupleType>
+  static bool diff_field_by_field(const Writer& _w,
+                                  const PtrNamedTupleType& _old_ptrs,
+                                  const PtrNamedTupleType& _new_ptrs,
+                                  typename Writer::OutputObjectType* _obj,
+                                  const bool _changed = false) noexcept {
+    using Fields = typename PtrNamedTupleType::Fields;
+    if constexpr (_i == std::tuple_size_v<Fields>) {
+      return _changed;
+    } else {
+      using FieldType = std::tuple_element_t<_i, Fields>;
+      using ValueType = std::remove_cvref_t<
+          std::remove_pointer_t<typename FieldType::Type>>;
+      const auto patch = MergePatch<ValueType>::diff(
+          _w, *rfl::get<_i>(_old_ptrs), *rfl::get<_i>(_new_ptrs));
+      if (patch) {
+        _w.set_field(FieldType::name_.str(), *patch, _obj);
+      }
+      return diff_field_by_field<_i + 1>(_w, _old_ptrs, _new_ptrs, _obj,
+                                         _changed || patch);
+    }
+  }
+
+  template <class PtrNamedTupleType>
+  static Result<Nothing> apply_to_fields(const Reader& _r,
+                                         const InputVarType& _patch,
+                                         PtrNamedTupleType* _ptrs) noexcept {
+    using NamedTupleType =
+        typename remove_ptrs_nt<PtrNamedTupleType>::NamedTupleType;
+
+    const auto to_fields_array = [&](auto _obj) {
+      return Parser<NamedTupleType>::match_fields(_r, _obj);
+    };
+    const auto apply_fields = [&](const auto& _fields_arr) -> Result<Nothing> {
+      std::vector<Error> errors;
+      apply_field_by_field(_r, _fields_arr, _ptrs, &errors);
+      if (errors.size() != 0) {
+        return parsing::to_single_error(std::move(errors));
+      }
+      return Nothing{};
+    };
+    return _r.to_object(_patch).transform(to_fields_array).and_then(
+        apply_fields);
+  }
+
+  /// Merges the patch into the JSON representation of _target, as described
+  /// in RFC 7396, and reads the result back into _target. Used for types
+  /// that are written as objects but cannot be patched field by field, like
+  /// variants or custom classes.
+  static Result<Nothing> merge_and_read(const Reader& _r,
+                                        const InputVarType& _patch,
+                                        T* _target) noexcept {
+    using MutDocPtr =
+        std::unique_ptr<yyjson_mut_doc, void (*)(yyjson_mut_doc*)>;
+    using DocPtr = std::unique_ptr<yyjson_doc, void (*)(yyjson_doc*)>;
+
+    const auto w = Writer(yyjson_mut_doc_new(NULL));
+    const auto mut_doc = MutDocPtr(w.doc_, yyjson_mut_doc_free);
+
+    const auto merged = yyjson_mut_merge_patch(
+        w.doc_, Parser<T>::write(w, *_target).val_,
+        yyjson_val_mut_copy(w.doc_, _patch.val_));
+    if (!merged) {
+      return Error("Could not merge the patch.");
+    }
+
+    const auto doc = DocPtr(yyjson_mut_val_imut_copy(merged, NULL),
+                            yyjson_doc_free);
+    if (!doc) {
+      return Error("Could not merge the patch.");
+    }
+
+    return parsing::InPlaceParser<Reader, Writer, T>::read(
+        _r, InputVarType(yyjson_doc_get_root(doc.get())), _target);
+  }
+
+  /// Fields that are not contained in the patch remain untouched.
+  template <int _i = 0, class FieldsArrayType, class PtrNamedTupleType>
+  static void apply_field_by_field(const Reader& _r,
+                                   const FieldsArrayType& _fields_arr,
+                                   PtrNamedTupleType* _ptrs,
+                                   std::vector<Error>* _errors) noexcept {
+    using Fields = typename PtrNamedTupleType::Fields;
+    if constexpr (_i < std::tuple_size_v<Fields>) {
+      using FieldType = std::tuple_element_t<_i, Fields>;
+      using ValueType = std::remove_cvref_t<
+          std::remove_pointer_t<typename FieldType::Type>>;
+      const auto& f = std::get<_i>(_fields_arr);
+      if (f) {
+        auto ptr = const_cast<ValueType*>(rfl::get<_i>(*_ptrs));
+        const auto res = MergePatch<ValueType>::apply(_r, *f, ptr);
+        if (!res) {
+          _errors->emplace_back(Error("Failed to patch field '" +
+                                      FieldType::name_.str() +
+                                      "': " + res.error()->what()));
+        }
+      }
+      apply_field_by_field<_i + 1>(_r, _fields_arr, _ptrs, _errors);
+    }
+  }
+};
+
+// ----------------------------------------------------------------------------
+
+template <class T>
+struct MergePatch<std::optional<T>> {
+  using InputVarType = typename Reader::InputVarType;
+  using OutputVarType = typename Writer::OutputVarType;
+
+  static std::optional<OutputVarType> diff(const Writer& _w,
+                                           const std::optional<T>& _old,
+                                           const std::optional<T>& _new) {
+    if (_old && _new) {
+      return MergePatch<std::decay_t<T>>::diff(_w, *_old, *_new);
+    } else if (!_old && !_new) {
+      return std::nullopt;
+    } else {
+      return Parser<std::optional<T>>::write(_w, _new);
+    }
+  }
+
+  static Result<Nothing> apply(const Reader& _r, const InputVarType& _patch,
+                               std::optional<T>* _target) noexcept {
+    if (_r.is_empty(_patch)) {
+      _target->reset();
+      return Nothing{};
+    }
+    if (*_target) {
+      return MergePatch<std::decay_t<T>>::apply(_r, _patch, &(**_target));
+    }
+    const auto emplace = [_target](T&& _t) {
+      _target->emplace(std::move(_t));
+      return Nothing{};
+    };
+    return Parser<std::decay_t<T>>::read(_r, _patch).transform(emplace);
+  }
+};
+
+// ----------------------------------------------------------------------------
+
+template <class T>
+struct MergePatch<Box<T>> {
+  using InputVarType = typename Reader::InputVarType;
+  using OutputVarType = typename Writer::OutputVarType;
+
+  static std::optional<OutputVarType> diff(const Writer& _w,
+                                           const Box<T>& _old,
+                                           const Box<T>& _new) {
+    return MergePatch<std::decay_t<T>>::diff(_w, *_old, *_new);
+  }
+
+  static Result<Nothing> apply(const Reader& _r, const InputVarType& _patch,
+                               Box<T>* _target) noexcept {
+    return MergePatch<std::decay_t<T>>::apply(_r, _patch, _target->get());
+  }
+};
+
+// ----------------------------------------------------------------------------
+
+/// Keys that were removed are marked as null, keys that were added or
+/// changed are diffed recursively.
+template <class MapType>
+struct MapMergePatch {
+  using InputVarType = typename Reader::InputVarType;
+  using OutputVarType = typename Writer::OutputVarType;
+  using ValueType = std::decay_t<typename MapType::mapped_type>;
+
+  static std::optional<OutputVarType> diff(const Writer& _w,
+                                           const MapType& _old,
+                                           const MapType& _new) noexcept {
+    auto obj = _w.new_object();
+    bool changed = false;
+    for (const auto& [k, v] : _new) {
+      const auto it = _old.find(k);
+      if (it == _old.end()) {
+        _w.set_field(k, Parser<ValueType>::write(_w, v), &obj);
+        changed = true;
+      } else if (const auto patch =
+                     MergePatch<ValueType>::diff(_w, it->second, v)) {
+        _w.set_field(k, *patch, &obj);
+        changed = true;
+      }
+    }
+    for (const auto& [k, v] : _old) {
+      if (_new.find(k) == _new.end()) {
+        _w.set_field(k, _w.empty_var(), &obj);
+        changed = true;
+      }
+    }
+    if (!changed) {
+      return std::nullopt;
+    }
+    return OutputVarType(obj);
+  }
+
+  static Result<Nothing> apply(const Reader& _r, const InputVarType& _patch,
+                               MapType* _target) noexcept {
+    if (_r.is_empty(_patch)) {
+      return Error("Value cannot be removed, because it is required.");
+    }
+    const auto apply_to_map = [&](const auto& _obj) -> Result<Nothing> {
+      const auto m = _r.to_map(_obj);
+      for (const auto& [k, v] : m) {
+        const auto it = _target->find(k);
+        if (_r.is_empty(v)) {
+          if (it != _target->end()) {
+            _target->erase(it);
+          }
+          continue;
+        }
+        if (it != _target->end()) {
+          const auto res = MergePatch<ValueType>::apply(_r, v, &it->second);
+          if (!res) {
+            return res;
+          }
+        } else {
+          auto res = Parser<ValueType>::read(_r, v);
+          if (!res) {
+            return *res.error();
+          }
+          _target->emplace(k, std::move(*res));
+        }
+      }
+      return Nothing{};
+    };
+    return _r.to_object(_patch).and_then(apply_to_map);
+  }
+};
+
+template <class T>
+struct MergePatch<std::map<std::string, T>>
+    : public MapMergePatch<std::map<std::string, T>> {};
+
+template <class T>
+struct MergePatch<std::unordered_map<std::string, T>>
+    : public MapMergePatch<std::unordered_map<std::string, T>> {};
+
+}  // namespace json
+}  // namespace rfl
+
+#endif
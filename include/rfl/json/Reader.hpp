@@ -81,7 +81,7 @@ struct Reader {
       if (r == NULL) {
         return rfl::Error("Could not cast to string.");
       }
-      return std::string(r);
+      return std::string(r, yyjson_get_len(_var.val_));
     } else if constexpr (std::is_same<std::decay_t<T>, bool>()) {
       if (!yyjson_is_bool(_var.val_)) {
         return rfl::Error("Could not cast to boolean.");
@@ -102,6 +102,17 @@ struct Reader {
     }
   }
 
+  /// Returns a view into the underlying document, which is only valid as
+  /// long as the document is alive.
+  rfl::Result<std::string_view> to_string_view(
+      const InputVarType _var) const noexcept {
+    const auto r = yyjson_get_str(_var.val_);
+    if (r == NULL) {
+      return rfl::Error("Could not cast to string.");
+    }
+    return std::string_view(r, yyjson_get_len(_var.val_));
+  }
+
   rfl::Result<InputArrayType> to_array(const InputVarType _var) const noexcept {
     if (!yyjson_is_arr(_var.val_)) {
       return rfl::Error("Could not cast to array!");
@@ -126,6 +137,26 @@ struct Reader {
     return f_arr;
   }
 
+  /// Calls _f(key, value) for every entry of the object, until _f returns
+  /// false. The keys are views into the underlying document.
+  template <class F>
+  void for_each_entry(const InputObjectType _obj, const F& _f) const noexcept {
+    yyjson_obj_iter iter;
+    yyjson_obj_iter_init(_obj.val_, &iter);
+    yyjson_val* key;
+    while ((key = yyjson_obj_iter_next(&iter))) {
+      const auto k = std::string_view(yyjson_get_str(key), yyjson_get_len(key));
+      if (!_f(k, InputVarType(yyjson_obj_iter_get_val(key)))) {
+        return;
+      }
+    }
+  }
+
+  /// The number of entries in the object.
+  size_t object_size(const InputObjectType _obj) const noexcept {
+    return yyjson_obj_size(_obj.val_);
+  }
+
   std::vector<std::pair<std::string, InputVarType>> to_map(
       const InputObjectType _obj) const noexcept {
     std::vector<std::pair<std::string, InputVarType>> m;
@@ -148,6 +179,25 @@ struct Reader {
     return InputObjectType(_var.val_);
   }
 
+  /// Calls _f(value) for every element of the array, until _f returns false.
+  template <class F>
+  void for_each_element(const InputArrayType _arr,
+                        const F& _f) const noexcept {
+    yyjson_val* val;
+    yyjson_arr_iter iter;
+    yyjson_arr_iter_init(_arr.val_, &iter);
+    while ((val = yyjson_arr_iter_next(&iter))) {
+      if (!_f(InputVarType(val))) {
+        return;
+      }
+    }
+  }
+
+  /// The number of elements in the array.
+  size_t array_size(const InputArrayType _arr) const noexcept {
+    return yyjson_arr_size(_arr.val_);
+  }
+
   std::vector<InputVarType> to_vec(const InputArrayType _arr) const noexcept {
     std::vector<InputVarType> vec;
     yyjson_val* val;
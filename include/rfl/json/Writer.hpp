@@ -71,6 +71,12 @@ struct Writer {
         }
     }
 
+    OutputVarType from_string_view(
+        const std::string_view _str) const noexcept {
+        return OutputVarType(
+            yyjson_mut_strncpy(doc_, _str.data(), _str.size()));
+    }
+
     OutputArrayType new_array() const noexcept {
         return OutputArrayType(yyjson_mut_arr(doc_));
     }
@@ -0,0 +1,37 @@
+#ifndef RFL_JSON_APPLY_PATCH_HPP_
+#define RFL_JSON_APPLY_PATCH_HPP_
+
+#include <yyjson.h>
+
+#include <memory>
+#include <string>
+
+#include "rfl/Result.hpp"
+#include "rfl/json/MergePatch.hpp"
+#include "rfl/json/Reader.hpp"
+
+namespace rfl {
+namespace json {
+
+/// Applies a JSON merge patch (RFC 7396) to _obj in place. Only the fields
+/// contained in the patch are touched. If an error occurs, _obj may be
+/// partially patched.
+template <class T>
+Result<Nothing> apply_patch(T& _obj, const Reader::InputVarType& _patch) {
+  const auto r = Reader();
+  return MergePatch<T>::apply(r, _patch, &_obj);
+}
+
+/// Applies a JSON merge patch (RFC 7396) to _obj in place.
+template <class T>
+Result<Nothing> apply_patch(T& _obj, const std::string& _patch) {
+  using PtrType = std::unique_ptr<yyjson_doc, void (*)(yyjson_doc*)>;
+  yyjson_doc* doc = yyjson_read(_patch.c_str(), _patch.size(), 0);
+  const auto ptr = PtrType(doc, yyjson_doc_free);
+  return apply_patch(_obj, Reader::InputVarType(yyjson_doc_get_root(doc)));
+}
+
+}  // namespace json
+}  // namespace rfl
+
+#endif
@@ -0,0 +1,44 @@
+#ifndef RFL_JSON_DIFF_HPP_
+#define RFL_JSON_DIFF_HPP_
+
+#include <yyjson.h>
+
+#include <string>
+
+#include "rfl/json/MergePatch.hpp"
+#include "rfl/json/Parser.hpp"
+
+namespace rfl {
+namespace json {
+
+/// Generates a JSON merge patch (RFC 7396) that contains only the fields
+/// that differ between _old and _new. Removed fields are marked as null. If
+/// the two objects are identical, the patch is an empty object.
+///
+/// Note that RFC 7396 cannot express setting a field to null, only removing
+/// it. Empty optional fields are therefore patched correctly, but map
+/// entries with a null value are removed by a receiver applying the patch.
+template <class T>
+std::string diff(const T& _old, const T& _new) {
+  auto w = Writer(yyjson_mut_doc_new(NULL));
+  const auto patch = MergePatch<T>::diff(w, _old, _new);
+  if (patch) {
+    yyjson_mut_doc_set_root(w.doc_, patch->val_);
+  } else {
+    // Merging an empty object changes nothing. Values that are not objects
+    // replace the target, so the unchanged value is its own patch.
+    const auto var = Parser<T>::write(w, _new);
+    yyjson_mut_doc_set_root(
+        w.doc_, yyjson_mut_is_obj(var.val_) ? w.new_object().val_ : var.val_);
+  }
+  const char* json_c_str = yyjson_mut_write(w.doc_, 0, NULL);
+  const auto json_str = std::string(json_c_str);
+  free((void*)json_c_str);
+  yyjson_mut_doc_free(w.doc_);
+  return json_str;
+}
+
+}  // namespace json
+}  // namespace rfl
+
+#endif
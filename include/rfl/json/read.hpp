@@ -3,10 +3,13 @@
 
 #include <yyjson.h>
 
+#include <memory_resource>
 #include <string>
 
 #include "rfl/json/Parser.hpp"
 #include "rfl/json/Reader.hpp"
+#include "rfl/json/Writer.hpp"
+#include "rfl/parsing/ReaderWithResource.hpp"
 
 namespace rfl {
 namespace json {
@@ -30,6 +33,29 @@ Result<T> read(const std::string& _json_str) {
     return read<T>(InputVarType(yyjson_doc_get_root(doc)));
 }
 
+/// Parses an object from a JSON var. Containers and strings with polymorphic
+/// allocators, like std::pmr::vector or std::pmr::string, are allocated from
+/// _resource.
+template <class T>
+Result<T> read(const InputVarType& _obj,
+               std::pmr::memory_resource* _resource) {
+    using ReaderType = parsing::ReaderWithResource<Reader>;
+    const auto r = ReaderType(Reader(), _resource);
+    return parsing::Parser<ReaderType, Writer, T>::read(r, _obj);
+}
+
+/// Parses an object from JSON using reflection. Containers and strings with
+/// polymorphic allocators, like std::pmr::vector or std::pmr::string, are
+/// allocated from _resource.
+template <class T>
+Result<T> read(const std::string& _json_str,
+               std::pmr::memory_resource* _resource) {
+    using PtrType = std::unique_ptr<yyjson_doc, void (*)(yyjson_doc*)>;
+    yyjson_doc* doc = yyjson_read(_json_str.c_str(), _json_str.size(), 0);
+    const auto ptr = PtrType(doc, yyjson_doc_free);
+    return read<T>(InputVarType(yyjson_doc_get_root(doc)), _resource);
+}
+
 }  // namespace json
 }  // namespace rfl
 
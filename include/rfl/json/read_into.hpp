@@ -0,0 +1,38 @@
+#ifndef RFL_JSON_READ_INTO_HPP_
+#define RFL_JSON_READ_INTO_HPP_
+
+#include <yyjson.h>
+
+#include <memory>
+#include <string>
+
+#include "rfl/Result.hpp"
+#include "rfl/json/Reader.hpp"
+#include "rfl/json/Writer.hpp"
+#include "rfl/parsing/InPlaceParser.hpp"
+
+namespace rfl {
+namespace json {
+
+/// Parses a JSON var into an existing object. Strings and containers that
+/// already exist in _obj are overwritten in place, so their capacity is
+/// reused. If an error occurs, _obj may be partially overwritten.
+template <class T>
+Result<Nothing> read_into(T& _obj, const Reader::InputVarType& _var) {
+  const auto r = Reader();
+  return parsing::InPlaceParser<Reader, Writer, T>::read(r, _var, &_obj);
+}
+
+/// Parses JSON into an existing object using reflection.
+template <class T>
+Result<Nothing> read_into(T& _obj, const std::string& _json_str) {
+  using PtrType = std::unique_ptr<yyjson_doc, void (*)(yyjson_doc*)>;
+  yyjson_doc* doc = yyjson_read(_json_str.c_str(), _json_str.size(), 0);
+  const auto ptr = PtrType(doc, yyjson_doc_free);
+  return read_into(_obj, Reader::InputVarType(yyjson_doc_get_root(doc)));
+}
+
+}  // namespace json
+}  // namespace rfl
+
+#endif
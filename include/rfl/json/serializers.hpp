@@ -0,0 +1,30 @@
+#ifndef RFL_JSON_SERIALIZERS_HPP_
+#define RFL_JSON_SERIALIZERS_HPP_
+
+#include <memory_resource>
+#include <string>
+
+#include "rfl/json/read.hpp"
+#include "rfl/json/write.hpp"
+#include "rfl/serializers.hpp"
+
+/// The JSON serializers, for use by RFL_DECLARE_SERIALIZERS and
+/// RFL_DEFINE_SERIALIZERS.
+#define RFL_SERIALIZERS_json(_extern, T)                                       \
+  _extern template rfl::Result<T> rfl::json::read<T>(                          \
+      const rfl::json::InputVarType&);                                         \
+  _extern template rfl::Result<T> rfl::json::read<T>(const std::string&);      \
+  _extern template rfl::Result<T> rfl::json::read<T>(                          \
+      const rfl::json::InputVarType&, std::pmr::memory_resource*);             \
+  _extern template rfl::Result<T> rfl::json::read<T>(                          \
+      const std::string&, std::pmr::memory_resource*);                         \
+  _extern template std::string rfl::json::write<T>(const T&);
+
+/// Ordinary overloads of write, see RFL_DECLARE_SERIALIZERS.
+#define RFL_SERIALIZER_OVERLOADS_json(T, _body)                                \
+  namespace rfl::json {                                                        \
+  std::string write(const T& _obj)                                             \
+      _body({ return write<T>(_obj); })                                        \
+  }
+
+#endif
@@ -0,0 +1,13 @@
+#ifndef RFL_MSGPACK_HPP_
+#define RFL_MSGPACK_HPP_
+
+#include "rfl/msgpack/Parser.hpp"
+#include "rfl/msgpack/Reader.hpp"
+#include "rfl/msgpack/Writer.hpp"
+#include "rfl/msgpack/load.hpp"
+#include "rfl/msgpack/read.hpp"
+#include "rfl/msgpack/save.hpp"
+#include "rfl/msgpack/serializers.hpp"
+#include "rfl/msgpack/write.hpp"
+
+#endif
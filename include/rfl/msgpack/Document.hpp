@@ -0,0 +1,357 @@
+#ifndef RFL_MSGPACK_DOCUMENT_HPP_
+#define RFL_MSGPACK_DOCUMENT_HPP_
+
+#include <bit>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include "rfl/Result.hpp"
+
+namespace rfl {
+namespace msgpack {
+
+/// A node in the decoded MessagePack document. The nodes are stored in a
+/// flat vector in the order in which they appear in the input: The children of
+/// an array or map directly follow the node itself (for maps, keys and values
+/// alternate) and next_ points to the first node after the entire subtree.
+struct Node {
+  enum class Type : std::uint8_t {
+    nil,
+    boolean,
+    int64,
+    uint64,
+    float64,
+    str,
+    bin,
+    ext,
+    array,
+    map
+  };
+
+  Type type_;
+
+  /// The number of elements for arrays and maps, the number of bytes for
+  /// strings, binary data and extensions.
+  std::uint32_t size_;
+
+  /// The index of the next sibling.
+  std::uint32_t next_;
+
+  union {
+    bool bool_;
+    std::int64_t int_;
+    std::uint64_t uint_;
+    double double_;
+    const char* data_;
+  };
+};
+
+/// Decodes the entire buffer in a single pass. The document does not own the
+/// buffer, so the buffer must outlive the document.
+class Document {
+ public:
+  using NodeType = Node;
+
+  /// Documents more deeply nested than this are rejected, so that malicious
+  /// input cannot overflow the stack.
+  static constexpr size_t max_depth_ = 1024;
+
+  static Result<Document> parse(const unsigned char* _bytes,
+                                const size_t _size) noexcept {
+    auto doc = Document(_bytes, _size);
+    if (!doc.parse_value(0)) {
+      return Error(doc.error_);
+    }
+    if (doc.pos_ != doc.end_) {
+      return Error("Found " + std::to_string(doc.end_ - doc.pos_) +
+                   " unexpected bytes after the end of the document.");
+    }
+    return doc;
+  }
+
+  /// Returns the node at position _ix.
+  const Node& node(const size_t _ix) const noexcept { return nodes_[_ix]; }
+
+  /// The root node is always at position 0.
+  static constexpr size_t root() noexcept { return 0; }
+
+ private:
+  Document(const unsigned char* _bytes, const size_t _size)
+      : pos_(_bytes), end_(_bytes + _size) {
+    // A node is much larger than the smallest value it can represent, so
+    // reserving for the densest possible input would take up several times
+    // the size of the input. We reserve at most 1.5 times the input instead
+    // and let the vector grow geometrically, if there are more nodes.
+    nodes_.reserve(_size / 16 + 1);
+  }
+
+  /// Reads an unsigned big-endian integer of type T.
+  template <class T>
+  bool read_big_endian(T* _val) noexcept {
+    if (static_cast<size_t>(end_ - pos_) < sizeof(T)) {
+      error_ = "Unexpected end of input.";
+      return false;
+    }
+    T val = 0;
+    for (size_t i = 0; i < sizeof(T); ++i) {
+      val = static_cast<T>((val << 8) | pos_[i]);
+    }
+    pos_ += sizeof(T);
+    *_val = val;
+    return true;
+  }
+
+  template <class LengthType>
+  bool read_length(std::uint32_t* _size) noexcept {
+    LengthType len = 0;
+    if (!read_big_endian(&len)) {
+      return false;
+    }
+    *_size = static_cast<std::uint32_t>(len);
+    return true;
+  }
+
+  /// Strings, binary data and extensions - the node points to the raw bytes.
+  bool parse_raw(const Node::Type _type, const std::uint32_t _size,
+                 Node* _node) noexcept {
+    if (static_cast<size_t>(end_ - pos_) < _size) {
+      error_ = "Unexpected end of input.";
+      return false;
+    }
+    _node->type_ = _type;
+    _node->size_ = _size;
+    _node->data_ = reinterpret_cast<const char*>(pos_);
+    pos_ += _size;
+    return true;
+  }
+
+  /// Extensions are preceded by a one-byte type, which we do not interpret.
+  bool parse_ext(const std::uint32_t _size, Node* _node) noexcept {
+    if (pos_ == end_) {
+      error_ = "Unexpected end of input.";
+      return false;
+    }
+    ++pos_;
+    return parse_raw(Node::Type::ext, _size, _node);
+  }
+
+  bool parse_children(const size_t _ix, const Node::Type _type,
+                      const std::uint32_t _size, const size_t _depth) noexcept {
+    nodes_[_ix].type_ = _type;
+    nodes_[_ix].size_ = _size;
+    const auto num_children =
+        _type == Node::Type::map ? 2 * static_cast<size_t>(_size) : _size;
+    for (size_t i = 0; i < num_children; ++i) {
+      if (!parse_value(_depth + 1)) {
+        return false;
+      }
+    }
+    return true;
+  }
+
+  bool parse_value(const size_t _depth) noexcept {
+    if (_depth > max_depth_) {
+      error_ = "Maximum nesting depth of " + std::to_string(max_depth_) +
+               " exceeded.";
+      return false;
+    }
+    if (pos_ == end_) {
+      error_ = "Unexpected end of input.";
+      return false;
+    }
+    const auto ix = nodes_.size();
+    nodes_.emplace_back();
+    nodes_[ix].size_ = 0;
+    if (!parse_value_at(ix, _depth)) {
+      return false;
+    }
+    nodes_[ix].next_ = static_cast<std::uint32_t>(nodes_.size());
+    return true;
+  }
+
+  bool parse_value_at(const size_t _ix, const size_t _depth) noexcept {
+    const unsigned char marker = *(pos_++);
+    auto* node = &nodes_[_ix];
+    std::uint32_t size = 0;
+
+    if (marker <= 0x7f) {
+      node->type_ = Node::Type::uint64;
+      node->uint_ = marker;
+      return true;
+    } else if (marker >= 0xe0) {
+      node->type_ = Node::Type::int64;
+      node->int_ = static_cast<std::int8_t>(marker);
+      return true;
+    } else if ((marker & 0xe0) == 0xa0) {
+      return parse_raw(Node::Type::str, marker & 0x1f, node);
+    } else if ((marker & 0xf0) == 0x90) {
+      return parse_children(_ix, Node::Type::array, marker & 0x0f, _depth);
+    } else if ((marker & 0xf0) == 0x80) {
+      return parse_children(_ix, Node::Type::map, marker & 0x0f, _depth);
+    }
+
+    switch (marker) {
+      case 0xc0:
+        node->type_ = Node::Type::nil;
+        return true;
+
+      case 0xc2:
+      case 0xc3:
+        node->type_ = Node::Type::boolean;
+        node->bool_ = (marker == 0xc3);
+        return true;
+
+      case 0xc4:
+        return read_length<std::uint8_t>(&size) &&
+               parse_raw(Node::Type::bin, size, node);
+
+      case 0xc5:
+        return read_length<std::uint16_t>(&size) &&
+               parse_raw(Node::Type::bin, size, node);
+
+      case 0xc6:
+        return read_length<std::uint32_t>(&size) &&
+               parse_raw(Node::Type::bin, size, node);
+
+      case 0xc7:
+        return read_length<std::uint8_t>(&size) && parse_ext(size, node);
+
+      case 0xc8:
+        return read_length<std::uint16_t>(&size) && parse_ext(size, node);
+
+      case 0xc9:
+        return read_length<std::uint32_t>(&size) && parse_ext(size, node);
+
+      case 0xca: {
+        std::uint32_t u = 0;
+        if (!read_big_endian(&u)) {
+          return false;
+        }
+        node->type_ = Node::Type::float64;
+        node->double_ = static_cast<double>(std::bit_cast<float>(u));
+        return true;
+      }
+
+      case 0xcb: {
+        std::uint64_t u = 0;
+        if (!read_big_endian(&u)) {
+          return false;
+        }
+        node->type_ = Node::Type::float64;
+        node->double_ = std::bit_cast<double>(u);
+        return true;
+      }
+
+      case 0xcc:
+        return parse_uint<std::uint8_t>(node);
+
+      case 0xcd:
+        return parse_uint<std::uint16_t>(node);
+
+      case 0xce:
+        return parse_uint<std::uint32_t>(node);
+
+      case 0xcf:
+        return parse_uint<std::uint64_t>(node);
+
+      case 0xd0:
+        return parse_int<std::uint8_t, std::int8_t>(node);
+
+      case 0xd1:
+        return parse_int<std::uint16_t, std::int16_t>(node);
+
+      case 0xd2:
+        return parse_int<std::uint32_t, std::int32_t>(node);
+
+      case 0xd3:
+        return parse_int<std::uint64_t, std::int64_t>(node);
+
+      case 0xd4:
+        return parse_ext(1, node);
+
+      case 0xd5:
+        return parse_ext(2, node);
+
+      case 0xd6:
+        return parse_ext(4, node);
+
+      case 0xd7:
+        return parse_ext(8, node);
+
+      case 0xd8:
+        return parse_ext(16, node);
+
+      case 0xd9:
+        return read_length<std::uint8_t>(&size) &&
+               parse_raw(Node::Type::str, size, node);
+
+      case 0xda:
+        return read_length<std::uint16_t>(&size) &&
+               parse_raw(Node::Type::str, size, node);
+
+      case 0xdb:
+        return read_length<std::uint32_t>(&size) &&
+               parse_raw(Node::Type::str, size, node);
+
+      case 0xdc:
+        return read_length<std::uint16_t>(&size) &&
+               parse_children(_ix, Node::Type::array, size, _depth);
+
+      case 0xdd:
+        return read_length<std::uint32_t>(&size) &&
+               parse_children(_ix, Node::Type::array, size, _depth);
+
+      case 0xde:
+        return read_length<std::uint16_t>(&size) &&
+               parse_children(_ix, Node::Type::map, size, _depth);
+
+      case 0xdf:
+        return read_length<std::uint32_t>(&size) &&
+               parse_children(_ix, Node::Type::map, size, _depth);
+
+      default:
+        error_ = "Unknown type marker " + std::to_string(marker) + ".";
+        return false;
+    }
+  }
+
+  template <class T>
+  bool parse_uint(Node* _node) noexcept {
+    T u = 0;
+    if (!read_big_endian(&u)) {
+      return false;
+    }
+    _node->type_ = Node::Type::uint64;
+    _node->uint_ = u;
+    return true;
+  }
+
+  template <class UnsignedType, class SignedType>
+  bool parse_int(Node* _node) noexcept {
+    UnsignedType u = 0;
+    if (!read_big_endian(&u)) {
+      return false;
+    }
+    _node->type_ = Node::Type::int64;
+    _node->int_ = static_cast<SignedType>(u);
+    return true;
+  }
+
+  /// The current position in the input.
+  const unsigned char* pos_;
+
+  /// The end of the input.
+  const unsigned char* end_;
+
+  /// The error message, if parsing failed.
+  std::string error_;
+
+  /// The decoded nodes.
+  std::vector<Node> nodes_;
+};
+
+}  // namespace msgpack
+}  // namespace rfl
+
+#endif
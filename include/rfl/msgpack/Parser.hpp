@@ -0,0 +1,17 @@
+#ifndef RFL_MSGPACK_PARSER_HPP_
+#define RFL_MSGPACK_PARSER_HPP_
+
+#include "rfl/msgpack/Reader.hpp"
+#include "rfl/msgpack/Writer.hpp"
+#include "rfl/parsing/Parser.hpp"
+
+namespace rfl {
+namespace msgpack {
+
+template <class T>
+using Parser = parsing::Parser<Reader, Writer, T>;
+
+}
+}  // namespace rfl
+
+#endif
@@ -0,0 +1,47 @@
+#ifndef RFL_MSGPACK_READER_HPP_
+#define RFL_MSGPACK_READER_HPP_
+
+#include <exception>
+#include <type_traits>
+
+#include "rfl/Result.hpp"
+#include "rfl/msgpack/Document.hpp"
+#include "rfl/parsing/NodeReader.hpp"
+
+namespace rfl {
+namespace msgpack {
+
+struct Reader : public parsing::NodeReader<Document> {
+  template <class T, class = void>
+  struct has_from_msgpack : std::false_type {};
+
+  template <class T>
+  struct has_from_msgpack<
+      T, std::enable_if_t<std::is_invocable_r<T, decltype(T::from_msgpack),
+                                              InputVarType>::value>>
+      : std::true_type {};
+
+  template <class T>
+  struct has_from_msgpack<
+      T, std::enable_if_t<std::is_invocable_r<
+             rfl::Result<T>, decltype(T::from_msgpack), InputVarType>::value>>
+      : std::true_type {};
+
+  template <class T>
+  static constexpr bool has_custom_constructor = has_from_msgpack<T>::value;
+
+  template <class T>
+  rfl::Result<T> use_custom_constructor(
+      const InputVarType& _var) const noexcept {
+    try {
+      return T::from_msgpack(_var);
+    } catch (std::exception& e) {
+      return rfl::Error(e.what());
+    }
+  }
+};
+
+}  // namespace msgpack
+}  // namespace rfl
+
+#endif
@@ -0,0 +1,18 @@
+#ifndef RFL_MSGPACK_WRITER_HPP_
+#define RFL_MSGPACK_WRITER_HPP_
+
+#include "rfl/msgpack/pack.hpp"
+#include "rfl/parsing/BufferWriter.hpp"
+
+namespace rfl {
+namespace msgpack {
+
+/// Writes MessagePack into a single buffer. See parsing::BufferWriter.
+struct Writer : public parsing::BufferWriter<Encoder> {
+  using parsing::BufferWriter<Encoder>::BufferWriter;
+};
+
+}  // namespace msgpack
+}  // namespace rfl
+
+#endif
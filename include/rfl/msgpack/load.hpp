@@ -0,0 +1,20 @@
+#ifndef RFL_MSGPACK_LOAD_HPP_
+#define RFL_MSGPACK_LOAD_HPP_
+
+#include "rfl/Result.hpp"
+#include "rfl/io/load_bytes.hpp"
+#include "rfl/msgpack/read.hpp"
+
+namespace rfl {
+namespace msgpack {
+
+template <class T>
+Result<T> load(const std::string& _fname) {
+  const auto read_bytes = [](const auto& _bytes) { return read<T>(_bytes); };
+  return rfl::io::load_bytes(_fname).and_then(read_bytes);
+}
+
+}  // namespace msgpack
+}  // namespace rfl
+
+#endif
@@ -0,0 +1,172 @@
+#ifndef RFL_MSGPACK_PACK_HPP_
+#define RFL_MSGPACK_PACK_HPP_
+
+#include <bit>
+#include <cstdint>
+#include <cstring>
+#include <limits>
+#include <string_view>
+#include <type_traits>
+#include <vector>
+
+namespace rfl {
+namespace msgpack {
+
+/// Appends _val to _bytes in big-endian byte order, as required by the
+/// MessagePack specification.
+template <class T>
+inline void pack_big_endian(const T _val, std::vector<unsigned char>* _bytes) {
+  static_assert(std::is_unsigned_v<T>, "T must be unsigned.");
+  for (int shift = (sizeof(T) - 1) * 8; shift >= 0; shift -= 8) {
+    _bytes->push_back(static_cast<unsigned char>(_val >> shift));
+  }
+}
+
+/// Appends a type marker followed by _val.
+template <class T>
+inline void pack_marker_and_value(const unsigned char _marker, const T _val,
+                                  std::vector<unsigned char>* _bytes) {
+  _bytes->push_back(_marker);
+  pack_big_endian(_val, _bytes);
+}
+
+inline void pack_nil(std::vector<unsigned char>* _bytes) {
+  _bytes->push_back(0xc0);
+}
+
+inline void pack_bool(const bool _b, std::vector<unsigned char>* _bytes) {
+  _bytes->push_back(_b ? 0xc3 : 0xc2);
+}
+
+/// Uses the smallest encoding that can represent _u.
+inline void pack_uint(const std::uint64_t _u,
+                      std::vector<unsigned char>* _bytes) {
+  if (_u <= 0x7f) {
+    _bytes->push_back(static_cast<unsigned char>(_u));
+  } else if (_u <= std::numeric_limits<std::uint8_t>::max()) {
+    pack_marker_and_value(0xcc, static_cast<std::uint8_t>(_u), _bytes);
+  } else if (_u <= std::numeric_limits<std::uint16_t>::max()) {
+    pack_marker_and_value(0xcd, static_cast<std::uint16_t>(_u), _bytes);
+  } else if (_u <= std::numeric_limits<std::uint32_t>::max()) {
+    pack_marker_and_value(0xce, static_cast<std::uint32_t>(_u), _bytes);
+  } else {
+    pack_marker_and_value(0xcf, _u, _bytes);
+  }
+}
+
+/// Uses the smallest encoding that can represent _i. Non-negative integers
+/// are always written using the unsigned encodings.
+inline void pack_int(const std::int64_t _i,
+                     std::vector<unsigned char>* _bytes) {
+  if (_i >= 0) {
+    pack_uint(static_cast<std::uint64_t>(_i), _bytes);
+  } else if (_i >= -32) {
+    _bytes->push_back(static_cast<unsigned char>(static_cast<std::int8_t>(_i)));
+  } else if (_i >= std::numeric_limits<std::int8_t>::min()) {
+    pack_marker_and_value(
+        0xd0, static_cast<std::uint8_t>(static_cast<std::int8_t>(_i)), _bytes);
+  } else if (_i >= std::numeric_limits<std::int16_t>::min()) {
+    pack_marker_and_value(
+        0xd1, static_cast<std::uint16_t>(static_cast<std::int16_t>(_i)),
+        _bytes);
+  } else if (_i >= std::numeric_limits<std::int32_t>::min()) {
+    pack_marker_and_value(
+        0xd2, static_cast<std::uint32_t>(static_cast<std::int32_t>(_i)),
+        _bytes);
+  } else {
+    pack_marker_and_value(0xd3, static_cast<std::uint64_t>(_i), _bytes);
+  }
+}
+
+inline void pack_float(const float _f, std::vector<unsigned char>* _bytes) {
+  pack_marker_and_value(0xca, std::bit_cast<std::uint32_t>(_f), _bytes);
+}
+
+inline void pack_double(const double _d, std::vector<unsigned char>* _bytes) {
+  pack_marker_and_value(0xcb, std::bit_cast<std::uint64_t>(_d), _bytes);
+}
+
+inline void pack_str(const std::string_view& _str,
+                     std::vector<unsigned char>* _bytes) {
+  const auto size = _str.size();
+  if (size <= 31) {
+    _bytes->push_back(static_cast<unsigned char>(0xa0 | size));
+  } else if (size <= std::numeric_limits<std::uint8_t>::max()) {
+    pack_marker_and_value(0xd9, static_cast<std::uint8_t>(size), _bytes);
+  } else if (size <= std::numeric_limits<std::uint16_t>::max()) {
+    pack_marker_and_value(0xda, static_cast<std::uint16_t>(size), _bytes);
+  } else {
+    pack_marker_and_value(0xdb, static_cast<std::uint32_t>(size), _bytes);
+  }
+  _bytes->insert(_bytes->end(), _str.begin(), _str.end());
+}
+
+inline void pack_array_header(const size_t _size,
+                              std::vector<unsigned char>* _bytes) {
+  if (_size <= 15) {
+    _bytes->push_back(static_cast<unsigned char>(0x90 | _size));
+  } else if (_size <= std::numeric_limits<std::uint16_t>::max()) {
+    pack_marker_and_value(0xdc, static_cast<std::uint16_t>(_size), _bytes);
+  } else {
+    pack_marker_and_value(0xdd, static_cast<std::uint32_t>(_size), _bytes);
+  }
+}
+
+inline void pack_map_header(const size_t _size,
+                            std::vector<unsigned char>* _bytes) {
+  if (_size <= 15) {
+    _bytes->push_back(static_cast<unsigned char>(0x80 | _size));
+  } else if (_size <= std::numeric_limits<std::uint16_t>::max()) {
+    pack_marker_and_value(0xde, static_cast<std::uint16_t>(_size), _bytes);
+  } else {
+    pack_marker_and_value(0xdf, static_cast<std::uint32_t>(_size), _bytes);
+  }
+}
+
+/// Bundles the functions above, so they can be passed to
+/// parsing::BufferWriter.
+struct Encoder {
+  static void nil(std::vector<unsigned char>* _bytes) { pack_nil(_bytes); }
+
+  static void boolean(const bool _b, std::vector<unsigned char>* _bytes) {
+    pack_bool(_b, _bytes);
+  }
+
+  static void uint64(const std::uint64_t _u,
+                     std::vector<unsigned char>* _bytes) {
+    pack_uint(_u, _bytes);
+  }
+
+  static void int64(const std::int64_t _i,
+                    std::vector<unsigned char>* _bytes) {
+    pack_int(_i, _bytes);
+  }
+
+  static void float32(const float _f, std::vector<unsigned char>* _bytes) {
+    pack_float(_f, _bytes);
+  }
+
+  static void float64(const double _d, std::vector<unsigned char>* _bytes) {
+    pack_double(_d, _bytes);
+  }
+
+  static void str(const std::string_view& _str,
+                  std::vector<unsigned char>* _bytes) {
+    pack_str(_str, _bytes);
+  }
+
+  static void array_header(const size_t _size,
+                           std::vector<unsigned char>* _bytes) {
+    pack_array_header(_size, _bytes);
+  }
+
+  static void map_header(const size_t _size,
+                         std::vector<unsigned char>* _bytes) {
+    pack_map_header(_size, _bytes);
+  }
+};
+
+}  // namespace msgpack
+}  // namespace rfl
+
+#endif
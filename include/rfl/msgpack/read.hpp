@@ -0,0 +1,40 @@
+#ifndef RFL_MSGPACK_READ_HPP_
+#define RFL_MSGPACK_READ_HPP_
+
+#include <vector>
+
+#include "rfl/Result.hpp"
+#include "rfl/msgpack/Document.hpp"
+#include "rfl/msgpack/Parser.hpp"
+
+namespace rfl {
+namespace msgpack {
+
+using InputVarType = typename Reader::InputVarType;
+
+/// Parses an object from a MessagePack var.
+template <class T>
+Result<T> read(const InputVarType& _obj) {
+  const auto r = Reader();
+  return Parser<T>::read(r, _obj);
+}
+
+/// Parses an object from MessagePack using reflection.
+template <class T>
+Result<T> read(const unsigned char* _bytes, const size_t _size) {
+  const auto read_root = [](const Document& _doc) {
+    return read<T>(InputVarType(&_doc, Document::root()));
+  };
+  return Document::parse(_bytes, _size).and_then(read_root);
+}
+
+/// Parses an object from MessagePack using reflection.
+template <class T>
+Result<T> read(const std::vector<unsigned char>& _bytes) {
+  return read<T>(_bytes.data(), _bytes.size());
+}
+
+}  // namespace msgpack
+}  // namespace rfl
+
+#endif
@@ -0,0 +1,21 @@
+#ifndef RFL_MSGPACK_SAVE_HPP_
+#define RFL_MSGPACK_SAVE_HPP_
+
+#include <string>
+
+#include "rfl/Result.hpp"
+#include "rfl/io/save_bytes.hpp"
+#include "rfl/msgpack/write.hpp"
+
+namespace rfl {
+namespace msgpack {
+
+template <class T>
+Result<Nothing> save(const std::string& _fname, const T& _obj) {
+  return rfl::io::save_bytes(_fname, write(_obj));
+}
+
+}  // namespace msgpack
+}  // namespace rfl
+
+#endif
@@ -0,0 +1,29 @@
+#ifndef RFL_MSGPACK_SERIALIZERS_HPP_
+#define RFL_MSGPACK_SERIALIZERS_HPP_
+
+#include <cstddef>
+#include <vector>
+
+#include "rfl/msgpack/read.hpp"
+#include "rfl/msgpack/write.hpp"
+#include "rfl/serializers.hpp"
+
+/// The MessagePack serializers, for use by RFL_DECLARE_SERIALIZERS and
+/// RFL_DEFINE_SERIALIZERS.
+#define RFL_SERIALIZERS_msgpack(_extern, T)                                    \
+  _extern template rfl::Result<T> rfl::msgpack::read<T>(                       \
+      const rfl::msgpack::InputVarType&);                                      \
+  _extern template rfl::Result<T> rfl::msgpack::read<T>(                       \
+      const unsigned char*, const size_t);                                     \
+  _extern template rfl::Result<T> rfl::msgpack::read<T>(                       \
+      const std::vector<unsigned char>&);                                      \
+  _extern template std::vector<unsigned char> rfl::msgpack::write<T>(const T&);
+
+/// Ordinary overloads of write, see RFL_DECLARE_SERIALIZERS.
+#define RFL_SERIALIZER_OVERLOADS_msgpack(T, _body)                             \
+  namespace rfl::msgpack {                                                     \
+  std::vector<unsigned char> write(const T& _obj)                              \
+      _body({ return write<T>(_obj); })                                        \
+  }
+
+#endif
@@ -0,0 +1,25 @@
+#ifndef RFL_MSGPACK_WRITE_HPP_
+#define RFL_MSGPACK_WRITE_HPP_
+
+#include <vector>
+
+#include "rfl/msgpack/Parser.hpp"
+
+namespace rfl {
+namespace msgpack {
+
+/// Writes an object to MessagePack.
+template <class T>
+std::vector<unsigned char> write(const T& _obj) {
+  auto buf = Writer::Buffer();
+  const auto w = Writer(&buf);
+  Parser<T>::write(w, _obj);
+  std::vector<unsigned char> bytes;
+  buf.flush(&bytes);
+  return bytes;
+}
+
+}  // namespace msgpack
+}  // namespace rfl
+
+#endif
@@ -0,0 +1,181 @@
+#ifndef RFL_PARSING_BUFFERWRITER_HPP_
+#define RFL_PARSING_BUFFERWRITER_HPP_
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include <type_traits>
+#include <vector>
+
+#include "rfl/always_false.hpp"
+
+namespace rfl {
+namespace parsing {
+
+/// The shared part of the writers for binary formats that prefix arrays and
+/// maps with their number of elements, like MessagePack or rfl::bin. Encoder
+/// must provide static functions that append the encoded values to a byte
+/// vector.
+///
+/// The writer is streaming: Every value is appended to a single buffer as
+/// soon as it is created. The number of elements of an array or map is not
+/// known when it is opened, so only its position is recorded and the headers
+/// are inserted when the buffer is flushed, which copies every byte exactly
+/// once.
+template <class Encoder>
+struct BufferWriter {
+  static constexpr bool streaming = true;
+
+  /// The position of a header in the buffer, which is not known until the
+  /// array or map is complete.
+  struct Header {
+    size_t pos_;
+    size_t size_;
+    bool is_map_;
+  };
+
+  /// Everything is written into the buffer. It can be reused for several
+  /// documents, if it is cleared in between.
+  struct Buffer {
+    /// Appends the encoded document to _out.
+    void flush(std::vector<unsigned char>* _out) const {
+      _out->reserve(_out->size() + bytes_.size() + headers_.size() * 5);
+      size_t pos = 0;
+      for (const auto& h : headers_) {
+        _out->insert(_out->end(), bytes_.begin() + pos,
+                     bytes_.begin() + h.pos_);
+        if (h.is_map_) {
+          Encoder::map_header(h.size_, _out);
+        } else {
+          Encoder::array_header(h.size_, _out);
+        }
+        pos = h.pos_;
+      }
+      _out->insert(_out->end(), bytes_.begin() + pos, bytes_.end());
+    }
+
+    void clear() {
+      bytes_.clear();
+      headers_.clear();
+    }
+
+    /// The values, without the headers of the arrays and maps.
+    std::vector<unsigned char> bytes_;
+
+    /// The headers in the order in which the arrays and maps were opened,
+    /// which is also the order of their positions.
+    std::vector<Header> headers_;
+  };
+
+  struct BufferOutputArray {
+    Buffer* buf_;
+    size_t header_ix_;
+    size_t size_;
+  };
+
+  struct BufferOutputObject {
+    Buffer* buf_;
+    size_t header_ix_;
+    size_t size_;
+  };
+
+  struct BufferOutputVar {
+    BufferOutputVar(const bool _null) : null_(_null) {}
+
+    /// The array is complete when it is turned into a var, so this is when
+    /// its size is known.
+    BufferOutputVar(const BufferOutputArray& _arr) : null_(false) {
+      _arr.buf_->headers_[_arr.header_ix_].size_ = _arr.size_;
+    }
+
+    BufferOutputVar(const BufferOutputObject& _obj) : null_(false) {
+      _obj.buf_->headers_[_obj.header_ix_].size_ = _obj.size_;
+    }
+
+    bool null_;
+  };
+
+  using OutputArrayType = BufferOutputArray;
+  using OutputObjectType = BufferOutputObject;
+  using OutputVarType = BufferOutputVar;
+
+  BufferWriter(Buffer* _buf) : buf_(_buf) {}
+
+  ~BufferWriter() = default;
+
+  /// The element has already been written when this is called.
+  void add(const OutputVarType& _var, OutputArrayType* _arr) const noexcept {
+    ++_arr->size_;
+  }
+
+  /// Must be called before the value of the field is written.
+  void add_key(const std::string_view& _name,
+               OutputObjectType* _obj) const noexcept {
+    Encoder::str(_name, &buf_->bytes_);
+    ++_obj->size_;
+  }
+
+  OutputVarType empty_var() const noexcept {
+    Encoder::nil(&buf_->bytes_);
+    return OutputVarType(true);
+  }
+
+  template <class T>
+  OutputVarType from_basic_type(const T& _var) const noexcept {
+    auto* bytes = &buf_->bytes_;
+    if constexpr (std::is_same<std::decay_t<T>, std::string>()) {
+      Encoder::str(_var, bytes);
+    } else if constexpr (std::is_same<std::decay_t<T>, bool>()) {
+      Encoder::boolean(_var, bytes);
+    } else if constexpr (std::is_same<std::decay_t<T>, float>()) {
+      Encoder::float32(_var, bytes);
+    } else if constexpr (std::is_floating_point<std::decay_t<T>>()) {
+      Encoder::float64(static_cast<double>(_var), bytes);
+    } else if constexpr (std::is_unsigned<std::decay_t<T>>()) {
+      Encoder::uint64(static_cast<std::uint64_t>(_var), bytes);
+    } else if constexpr (std::is_integral<std::decay_t<T>>()) {
+      Encoder::int64(static_cast<std::int64_t>(_var), bytes);
+    } else {
+      static_assert(rfl::always_false_v<T>, "Unsupported type.");
+    }
+    return OutputVarType(false);
+  }
+
+  OutputVarType from_string_view(const std::string_view _str) const noexcept {
+    Encoder::str(_str, &buf_->bytes_);
+    return OutputVarType(false);
+  }
+
+  OutputArrayType new_array() const noexcept {
+    return OutputArrayType{buf_, open(false), 0};
+  }
+
+  OutputObjectType new_object() const noexcept {
+    return OutputObjectType{buf_, open(true), 0};
+  }
+
+  bool is_empty(const OutputVarType& _var) const noexcept {
+    return _var.null_;
+  }
+
+  /// Never called, because the keys are added using add_key(...).
+  void set_field(const std::string& _name, const OutputVarType& _var,
+                 OutputObjectType* _obj) const noexcept {}
+
+ private:
+  /// Records the position of a new header and returns its index.
+  size_t open(const bool _is_map) const noexcept {
+    buf_->headers_.push_back(Header{buf_->bytes_.size(), 0, _is_map});
+    return buf_->headers_.size() - 1;
+  }
+
+ private:
+  /// The buffer everything is written into.
+  Buffer* buf_;
+};
+
+}  // namespace parsing
+}  // namespace rfl
+
+#endif
@@ -0,0 +1,81 @@
+#ifndef RFL_PARSING_FLATBUILDER_HPP_
+#define RFL_PARSING_FLATBUILDER_HPP_
+
+#include <functional>
+#include <utility>
+#include <vector>
+
+#if __has_include(<flat_map>)
+#include <flat_map>
+#endif
+
+#if __has_include(<flat_set>)
+#include <flat_set>
+#endif
+
+#include "rfl/FlatMap.hpp"
+#include "rfl/internal/sort_unique.hpp"
+
+namespace rfl {
+namespace parsing {
+
+/// Flat containers keep their entries in contiguous storage, so inserting
+/// the entries one by one would take quadratic time. Instead, the parsers
+/// collect all entries of type EntryType first and then build the container
+/// in one go, which sorts the entries at most once.
+template <class T>
+struct FlatBuilder {};
+
+template <class K, class V, class C>
+struct FlatBuilder<FlatMap<K, V, C>> {
+  using EntryType = std::pair<K, V>;
+
+  static FlatMap<K, V, C> build(std::vector<EntryType>&& _entries) {
+    return FlatMap<K, V, C>(std::move(_entries));
+  }
+};
+
+#ifdef __cpp_lib_flat_map
+template <class K, class V, class C, class KC, class MC>
+struct FlatBuilder<std::flat_map<K, V, C, KC, MC>> {
+  using EntryType = std::pair<K, V>;
+
+  static std::flat_map<K, V, C, KC, MC> build(
+      std::vector<EntryType>&& _entries) {
+    internal::sort_unique(&_entries, C(), &EntryType::first);
+    auto keys = KC();
+    auto values = MC();
+    for (auto& [k, v] : _entries) {
+      keys.push_back(std::move(k));
+      values.push_back(std::move(v));
+    }
+    return std::flat_map<K, V, C, KC, MC>(std::sorted_unique, std::move(keys),
+                                          std::move(values));
+  }
+};
+#endif
+
+#ifdef __cpp_lib_flat_set
+template <class T, class C, class KC>
+struct FlatBuilder<std::flat_set<T, C, KC>> {
+  using EntryType = T;
+
+  static std::flat_set<T, C, KC> build(std::vector<EntryType>&& _entries) {
+    internal::sort_unique(&_entries, C(), std::identity());
+    auto keys = KC(std::make_move_iterator(_entries.begin()),
+                   std::make_move_iterator(_entries.end()));
+    return std::flat_set<T, C, KC>(std::sorted_unique, std::move(keys));
+  }
+};
+#endif
+
+/// Whether T is a flat container that can be built by FlatBuilder.
+template <class T>
+constexpr bool is_flat() {
+  return requires { typename FlatBuilder<T>::EntryType; };
+}
+
+}  // namespace parsing
+}  // namespace rfl
+
+#endif
@@ -0,0 +1,623 @@
+#ifndef RFL_PARSING_INPLACEPARSER_HPP_
+#define RFL_PARSING_INPLACEPARSER_HPP_
+
+#include <algorithm>
+#include <array>
+#include <concepts>
+#include <map>
+#include <memory>
+#include <memory_resource>
+#include <optional>
+#include <span>
+#include <string>
+#include <string_view>
+#include <tuple>
+#include <type_traits>
+#include <unordered_map>
+#include <vector>
+
+#include "rfl/Box.hpp"
+#include "rfl/NamedTuple.hpp"
+#include "rfl/Result.hpp"
+#include "rfl/Validator.hpp"
+#include "rfl/internal/has_fields.hpp"
+#include "rfl/internal/has_reflection_type_v.hpp"
+#include "rfl/internal/nt_to_ptr_named_tuple.hpp"
+#include "rfl/internal/to_ptr_named_tuple.hpp"
+#include "rfl/internal/to_ptr_tuple.hpp"
+#include "rfl/named_tuple_t.hpp"
+#include "rfl/parsing/AreReaderAndWriter.hpp"
+#include "rfl/parsing/Parser.hpp"
+#include "rfl/parsing/SupportsArrayIteration.hpp"
+#include "rfl/parsing/SupportsObjectIteration.hpp"
+#include "rfl/parsing/SupportsStringViews.hpp"
+#include "rfl/parsing/is_positional.hpp"
+#include "rfl/parsing/is_required.hpp"
+#include "rfl/parsing/to_single_error.hpp"
+
+namespace rfl {
+namespace parsing {
+
+/// The InPlaceParser overwrites an existing object instead of creating a new
+/// one. Wherever possible, it recurses into the existing object, so the
+/// capacity of containers and strings is retained. Everything else is parsed
+/// by the Parser and then move-assigned. If an error occurs, the target may be
+/// partially overwritten.
+template <class R, class W, class T>
+requires AreReaderAndWriter<R, W, T>
+struct InPlaceParser;
+
+// ----------------------------------------------------------------------------
+
+/// Calls _f(var) for every element of the array, until _f returns false.
+/// Readers that cannot iterate over arrays directly fall back to to_vec(...),
+/// which allocates a temporary vector.
+template <class R, class F>
+void iterate_elements(const R& _r, const typename R::InputArrayType& _arr,
+                      const F& _f) noexcept {
+  if constexpr (SupportsArrayIteration<R>) {
+    _r.for_each_element(_arr, _f);
+  } else {
+    for (const auto& v : _r.to_vec(_arr)) {
+      if (!_f(v)) {
+        return;
+      }
+    }
+  }
+}
+
+/// The number of elements in the array.
+template <class R>
+size_t array_size(const R& _r,
+                  const typename R::InputArrayType& _arr) noexcept {
+  if constexpr (SupportsArrayIteration<R>) {
+    return _r.array_size(_arr);
+  } else {
+    return _r.to_vec(_arr).size();
+  }
+}
+
+// ----------------------------------------------------------------------------
+
+/// Helper class for anything that is expressed as a named tuple of pointers.
+template <class R, class W, class NamedTupleType>
+requires AreReaderAndWriter<R, W, NamedTupleType>
+struct InPlaceNamedTupleParser {
+  using InputVarType = typename R::InputVarType;
+
+  static constexpr size_t size_ =
+      std::tuple_size_v<typename NamedTupleType::Fields>;
+
+  using FieldsArrayType = std::array<std::optional<InputVarType>, size_>;
+
+  /// _ptrs is a named tuple containing pointers to the fields of the target.
+  template <class PtrNamedTupleType>
+  static Result<Nothing> read(const R& _r, const InputVarType& _var,
+                              PtrNamedTupleType* _ptrs) noexcept {
+    const auto set_fields =
+        [&](const FieldsArrayType& _fields_arr) -> Result<Nothing> {
+      std::vector<Error> errors;
+      set_field_by_field(_r, _fields_arr, _ptrs, &errors);
+      if (errors.size() != 0) {
+        return to_single_error(std::move(errors));
+      }
+      return Nothing{};
+    };
+    if constexpr (is_positional<R, W>()) {
+      const auto to_fields_array = [&](auto _arr) {
+        FieldsArrayType fields_arr;
+        size_t i = 0;
+        iterate_elements(_r, _arr, [&](const InputVarType& _v) {
+          if (i == size_) {
+            return false;
+          }
+          fields_arr[i++] = _v;
+          return true;
+        });
+        return fields_arr;
+      };
+      return _r.to_array(_var).transform(to_fields_array).and_then(set_fields);
+    } else {
+      const auto to_fields_array = [&](auto _obj) {
+        return Parser<R, W, NamedTupleType>::match_fields(_r, _obj);
+      };
+      return _r.to_object(_var).transform(to_fields_array).and_then(
+          set_fields);
+    }
+  }
+
+ private:
+  /// Overwrites the fields one by one and collects all errors.
+  template <int _i = 0, class PtrNamedTupleType>
+  static void set_field_by_field(const R& _r,
+                                 const FieldsArrayType& _fields_arr,
+                                 PtrNamedTupleType* _ptrs,
+                                 std::vector<Error>* _errors) noexcept {
+    if constexpr (_i < size_) {
+      using FieldType = typename std::tuple_element<
+          _i, typename NamedTupleType::Fields>::type;
+
+      using ValueType = std::decay_t<typename FieldType::Type>;
+
+      // The pointers might be const, because they were generated from a
+      // const reference, but the target itself is always mutable.
+      auto ptr = const_cast<ValueType*>(rfl::get<_i>(*_ptrs));
+
+      const auto& f = std::get<_i>(_fields_arr);
+
+      if (!f) {
+        if constexpr (is_required<ValueType>()) {
+          // Same wording as the Parser, which ends the first error with an
+          // exclamation mark.
+          const auto punct = _errors->size() == 0 ? "!" : ".";
+          _errors->emplace_back(Error("Field named '" + FieldType::name_.str() +
+                                      "' not found" + punct));
+        } else {
+          *ptr = ValueType();
+        }
+      } else {
+        const auto res = InPlaceParser<R, W, ValueType>::read(_r, *f, ptr);
+        if (!res) {
+          _errors->emplace_back(Error("Failed to parse field '" +
+                                      FieldType::name_.str() +
+                                      "': " + res.error()->what()));
+        }
+      }
+
+      set_field_by_field<_i + 1>(_r, _fields_arr, _ptrs, _errors);
+    }
+  }
+};
+
+// ----------------------------------------------------------------------------
+
+/// Default case - anything that cannot be explicitly matched.
+template <class R, class W, class T>
+requires AreReaderAndWriter<R, W, T>
+struct InPlaceParser {
+  using InputVarType = typename R::InputVarType;
+
+  static Result<Nothing> read(const R& _r, const InputVarType& _var,
+                              T* _target) noexcept {
+    if constexpr (R::template has_custom_constructor<T> ||
+                  internal::has_reflection_type_v<T>) {
+      return assign(_r, _var, _target);
+    } else if constexpr (std::is_class_v<T> && std::is_aggregate_v<T>) {
+      if constexpr (internal::has_fields<T>()) {
+        auto ptr_named_tuple = internal::to_ptr_named_tuple(*_target);
+        return InPlaceNamedTupleParser<R, W, named_tuple_t<T>>::read(
+            _r, _var, &ptr_named_tuple);
+      } else {
+        const auto ptr_tuple = internal::to_ptr_tuple(*_target);
+        constexpr auto size = std::tuple_size_v<decltype(ptr_tuple)>;
+        const auto set_elements = [&](const auto& _arr) {
+          return set_element_by_element(
+              _r, to_elements_array<size>(_r, _arr), ptr_tuple);
+        };
+        return _r.to_array(_var).and_then(set_elements);
+      }
+    } else if constexpr ((std::is_same<T, std::string>() ||
+                          std::is_same<T, std::pmr::string>()) &&
+                         SupportsStringViews<R>) {
+      const auto assign_str = [_target](std::string_view&& _str) {
+        _target->assign(_str.data(), _str.size());
+        return Nothing{};
+      };
+      return _r.to_string_view(_var).transform(assign_str);
+    } else {
+      return assign(_r, _var, _target);
+    }
+  }
+
+ private:
+  /// Parses a new value and moves it into the target.
+  static Result<Nothing> assign(const R& _r, const InputVarType& _var,
+                                T* _target) noexcept {
+    const auto move_into_target = [_target](T&& _t) {
+      *_target = std::move(_t);
+      return Nothing{};
+    };
+    return Parser<R, W, T>::read(_r, _var).transform(move_into_target);
+  }
+
+  /// The elements of an array expressing a struct without field names, along
+  /// with the total number of elements in the array.
+  template <size_t _size>
+  struct ElementsArray {
+    std::array<std::optional<InputVarType>, _size> vars_;
+    size_t size_ = 0;
+  };
+
+  /// Collects the elements of the array without allocating.
+  template <size_t _size, class ArrayType>
+  static ElementsArray<_size> to_elements_array(
+      const R& _r, const ArrayType& _arr) noexcept {
+    ElementsArray<_size> elements;
+    iterate_elements(_r, _arr, [&](const InputVarType& _v) {
+      if (elements.size_ < _size) {
+        elements.vars_[elements.size_] = _v;
+      }
+      ++elements.size_;
+      return true;
+    });
+    return elements;
+  }
+
+  /// For structs without field names, which are expressed as arrays.
+  template <int _i = 0, class PtrTupleType, size_t _size>
+  static Result<Nothing> set_element_by_element(
+      const R& _r, const ElementsArray<_size>& _elements,
+      const PtrTupleType& _ptr_tuple) noexcept {
+    constexpr auto size = std::tuple_size_v<PtrTupleType>;
+    if constexpr (_i == 0) {
+      if (_elements.size_ > size) {
+        return Error("Expected " + std::to_string(size) + " fields, got " +
+                     std::to_string(_elements.size_) + ".");
+      }
+    }
+    if constexpr (_i == size) {
+      return Nothing{};
+    } else {
+      using ValueType = std::remove_cvref_t<
+          std::remove_pointer_t<std::tuple_element_t<_i, PtrTupleType>>>;
+
+      auto ptr = const_cast<ValueType*>(std::get<_i>(_ptr_tuple));
+
+      if (_i >= _elements.size_) {
+        if constexpr (is_required<ValueType>()) {
+          return Error("Array is of length " +
+                       std::to_string(_elements.size_) +
+                       ", but field " + std::to_string(_i + 1) +
+                       " is required.");
+        } else {
+          *ptr = ValueType();
+          return set_element_by_element<_i + 1>(_r, _elements, _ptr_tuple);
+        }
+      }
+
+      const auto set_next = [&](Nothing&&) {
+        return set_element_by_element<_i + 1>(_r, _elements, _ptr_tuple);
+      };
+
+      return InPlaceParser<R, W, ValueType>::read(_r, *_elements.vars_[_i],
+                                                  ptr)
+          .and_then(set_next);
+    }
+  }
+};
+
+// ----------------------------------------------------------------------------
+
+template <class R, class W, class T, size_t _size>
+requires AreReaderAndWriter<R, W, std::array<T, _size>>
+struct InPlaceParser<R, W, std::array<T, _size>> {
+  using InputVarType = typename R::InputVarType;
+
+  static Result<Nothing> read(const R& _r, const InputVarType& _var,
+                              std::array<T, _size>* _arr) noexcept {
+    const auto set_elements = [&](const auto& _a) -> Result<Nothing> {
+      const auto size = array_size(_r, _a);
+      if (size != _size) {
+        return Error("Expected " + std::to_string(_size) + " fields, got " +
+                     std::to_string(size) + ".");
+      }
+      size_t i = 0;
+      std::optional<Error> err;
+      iterate_elements(_r, _a, [&](const InputVarType& _v) {
+        auto res =
+            InPlaceParser<R, W, std::decay_t<T>>::read(_r, _v, &(*_arr)[i++]);
+        if (!res) {
+          err = std::move(*res.error());
+          return false;
+        }
+        return true;
+      });
+      if (err) {
+        return std::move(*err);
+      }
+      return Nothing{};
+    };
+
+    return _r.to_array(_var).and_then(set_elements);
+  }
+};
+
+// ----------------------------------------------------------------------------
+
+template <class R, class W, class T>
+requires AreReaderAndWriter<R, W, Box<T>>
+struct InPlaceParser<R, W, Box<T>> {
+  using InputVarType = typename R::InputVarType;
+
+  static Result<Nothing> read(const R& _r, const InputVarType& _var,
+                              Box<T>* _box) noexcept {
+    return InPlaceParser<R, W, std::decay_t<T>>::read(_r, _var, _box->get());
+  }
+};
+
+// ----------------------------------------------------------------------------
+
+/// Used for maps for which the key type is std::string or std::pmr::string.
+/// Values belonging to keys that already exist are overwritten in place, keys
+/// that are no longer contained in the object are removed.
+template <class R, class W, class MapType>
+requires AreReaderAndWriter<R, W, MapType>
+struct InPlaceMapParser {
+  using InputVarType = typename R::InputVarType;
+
+  using KeyType = typename MapType::key_type;
+
+  using ValueType = std::decay_t<typename MapType::mapped_type>;
+
+  static Result<Nothing> read(const R& _r, const InputVarType& _var,
+                              MapType* _map) noexcept {
+    const auto set_values = [&](const auto& _obj) -> Result<Nothing> {
+      std::optional<Error> err;
+      size_t num_entries = 0;
+
+      // The lookups need a key of the map's own type. Reusing it means that
+      // keys only allocate, if they are too long for the small string buffer.
+      KeyType key;
+
+      const auto set_value = [&](std::string_view _k,
+                                 const InputVarType& _v) -> bool {
+        ++num_entries;
+        key.assign(_k.data(), _k.size());
+        const auto it = _map->find(key);
+        if (it != _map->end()) {
+          auto res = InPlaceParser<R, W, ValueType>::read(_r, _v, &it->second);
+          if (!res) {
+            err = std::move(*res.error());
+            return false;
+          }
+        } else {
+          auto res = Parser<R, W, ValueType>::read(_r, _v);
+          if (!res) {
+            err = std::move(*res.error());
+            return false;
+          }
+          _map->emplace(key, std::move(*res));
+        }
+        return true;
+      };
+
+      // Every key in the input is now contained in the map, so if the sizes
+      // match, there are no stale keys and we do not need to collect them.
+      if constexpr (SupportsObjectIteration<R>) {
+        _r.for_each_entry(_obj, set_value);
+        if (!err && _map->size() != num_entries) {
+          std::vector<std::string_view> keys;
+          keys.reserve(num_entries);
+          _r.for_each_entry(_obj, [&](std::string_view _k, const auto&) {
+            keys.push_back(_k);
+            return true;
+          });
+          remove_stale_keys(std::move(keys), _map);
+        }
+      } else {
+        const auto m = _r.to_map(_obj);
+        for (const auto& [k, v] : m) {
+          if (!set_value(k, v)) {
+            break;
+          }
+        }
+        if (!err && _map->size() != num_entries) {
+          std::vector<std::string_view> keys;
+          keys.reserve(m.size());
+          for (const auto& p : m) {
+            keys.push_back(p.first);
+          }
+          remove_stale_keys(std::move(keys), _map);
+        }
+      }
+
+      if (err) {
+        return std::move(*err);
+      }
+      return Nothing{};
+    };
+
+    return _r.to_object(_var).and_then(set_values);
+  }
+
+ private:
+  /// Removes all keys that are not contained in _keys.
+  static void remove_stale_keys(std::vector<std::string_view>&& _keys,
+                                MapType* _map) noexcept {
+    std::sort(_keys.begin(), _keys.end());
+    for (auto it = _map->begin(); it != _map->end();) {
+      if (!std::binary_search(_keys.begin(), _keys.end(),
+                              std::string_view(it->first))) {
+        it = _map->erase(it);
+      } else {
+        ++it;
+      }
+    }
+  }
+};
+
+template <class R, class W, class T, class C, class A>
+requires AreReaderAndWriter<R, W, std::map<std::string, T, C, A>>
+struct InPlaceParser<R, W, std::map<std::string, T, C, A>>
+    : public InPlaceMapParser<R, W, std::map<std::string, T, C, A>> {
+};
+
+template <class R, class W, class T, class C, class A>
+requires AreReaderAndWriter<R, W, std::map<std::pmr::string, T, C, A>>
+struct InPlaceParser<R, W, std::map<std::pmr::string, T, C, A>>
+    : public InPlaceMapParser<R, W, std::map<std::pmr::string, T, C, A>> {
+};
+
+template <class R, class W, class T, class H, class E, class A>
+requires AreReaderAndWriter<R, W, std::unordered_map<std::string, T, H, E, A>>
+struct InPlaceParser<R, W, std::unordered_map<std::string, T, H, E, A>>
+    : public InPlaceMapParser<R, W,
+                              std::unordered_map<std::string, T, H, E, A>> {
+};
+
+template <class R, class W, class T, class H, class E, class A>
+requires AreReaderAndWriter<R, W,
+                            std::unordered_map<std::pmr::string, T, H, E, A>>
+struct InPlaceParser<R, W, std::unordered_map<std::pmr::string, T, H, E, A>>
+    : public InPlaceMapParser<
+          R, W, std::unordered_map<std::pmr::string, T, H, E, A>> {
+};
+
+// ----------------------------------------------------------------------------
+
+template <class R, class W, class... FieldTypes>
+requires AreReaderAndWriter<R, W, NamedTuple<FieldTypes...>>
+struct InPlaceParser<R, W, NamedTuple<FieldTypes...>> {
+  using InputVarType = typename R::InputVarType;
+
+  static Result<Nothing> read(const R& _r, const InputVarType& _var,
+                              NamedTuple<FieldTypes...>* _tup) noexcept {
+    auto ptr_named_tuple = internal::nt_to_ptr_named_tuple(*_tup);
+    return InPlaceNamedTupleParser<R, W, NamedTuple<FieldTypes...>>::read(
+        _r, _var, &ptr_named_tuple);
+  }
+};
+
+// ----------------------------------------------------------------------------
+
+template <class R, class W, class T>
+requires AreReaderAndWriter<R, W, std::optional<T>>
+struct InPlaceParser<R, W, std::optional<T>> {
+  using InputVarType = typename R::InputVarType;
+
+  static Result<Nothing> read(const R& _r, const InputVarType& _var,
+                              std::optional<T>* _o) noexcept {
+    if (_r.is_empty(_var)) {
+      _o->reset();
+      return Nothing{};
+    }
+    if (*_o) {
+      return InPlaceParser<R, W, std::decay_t<T>>::read(_r, _var, &(**_o));
+    }
+    const auto emplace = [_o](T&& _t) {
+      _o->emplace(std::move(_t));
+      return Nothing{};
+    };
+    return Parser<R, W, std::decay_t<T>>::read(_r, _var).transform(emplace);
+  }
+};
+
+// ----------------------------------------------------------------------------
+
+template <class R, class W, class T>
+requires AreReaderAndWriter<R, W, std::unique_ptr<T>>
+struct InPlaceParser<R, W, std::unique_ptr<T>> {
+  using InputVarType = typename R::InputVarType;
+
+  static Result<Nothing> read(const R& _r, const InputVarType& _var,
+                              std::unique_ptr<T>* _ptr) noexcept {
+    if (_r.is_empty(_var)) {
+      _ptr->reset();
+      return Nothing{};
+    }
+    if (*_ptr) {
+      return InPlaceParser<R, W, std::decay_t<T>>::read(_r, _var,
+                                                        _ptr->get());
+    }
+    const auto make = [_ptr](T&& _t) {
+      *_ptr = std::make_unique<T>(std::move(_t));
+      return Nothing{};
+    };
+    return Parser<R, W, std::decay_t<T>>::read(_r, _var).transform(make);
+  }
+};
+
+// ----------------------------------------------------------------------------
+
+/// Elements that already exist are overwritten in place, surplus elements are
+/// removed and missing elements are appended. The capacity of the vector is
+/// always retained, so reading input of the same shape does not allocate.
+template <class R, class W, class T, class A>
+requires AreReaderAndWriter<R, W, std::vector<T, A>>
+struct InPlaceParser<R, W, std::vector<T, A>> {
+  using InputVarType = typename R::InputVarType;
+
+  using VecType = std::vector<T, A>;
+
+  static Result<Nothing> read(const R& _r, const InputVarType& _var,
+                              VecType* _vec) noexcept {
+    if constexpr (std::is_same<std::decay_t<T>, bool>()) {
+      const auto move_into_target = [_vec](VecType&& _v) {
+        *_vec = std::move(_v);
+        return Nothing{};
+      };
+      return Parser<R, W, VecType>::read(_r, _var).transform(
+          move_into_target);
+    } else {
+      const auto set_elements = [&](const auto& _arr) {
+        return set_element_by_element(_r, _arr, _vec);
+      };
+      return _r.to_array(_var).and_then(set_elements);
+    }
+  }
+
+ private:
+  static Result<Nothing> set_element_by_element(
+      const R& _r, const typename R::InputArrayType& _arr,
+      VecType* _vec) noexcept {
+    const auto size = array_size(_r, _arr);
+    if (_vec->size() > size) {
+      _vec->erase(_vec->begin() + size, _vec->end());
+    }
+    _vec->reserve(size);
+    const auto existing = _vec->size();
+    size_t i = 0;
+    std::optional<Error> err;
+    iterate_elements(_r, _arr, [&](const InputVarType& _v) {
+      if (i < existing) {
+        auto res =
+            InPlaceParser<R, W, std::decay_t<T>>::read(_r, _v, &(*_vec)[i]);
+        if (!res) {
+          err = std::move(*res.error());
+          return false;
+        }
+      } else {
+        auto res = Parser<R, W, std::decay_t<T>>::read(_r, _v);
+        if (!res) {
+          err = std::move(*res.error());
+          return false;
+        }
+        _vec->emplace_back(std::move(*res));
+      }
+      ++i;
+      return true;
+    });
+    if (err) {
+      return std::move(*err);
+    }
+    return Nothing{};
+  }
+};
+
+// ----------------------------------------------------------------------------
+
+/// Vectors of validated numbers are decoded as plain numbers first, so that
+/// they can be validated in a single pass, just like Parser::read does. The
+/// numbers are decoded into a buffer that is kept for every thread, so
+/// reading arrays of the same size does not allocate.
+template <class R, class W, class T, class V, class A>
+requires(AreReaderAndWriter<R, W, std::vector<Validator<T, V>, A>> &&
+         std::is_arithmetic_v<T>)
+struct InPlaceParser<R, W, std::vector<Validator<T, V>, A>> {
+  using InputVarType = typename R::InputVarType;
+
+  static Result<Nothing> read(const R& _r, const InputVarType& _var,
+                              std::vector<Validator<T, V>, A>* _vec) noexcept {
+    thread_local auto values = std::vector<T>();
+    const auto assign = [&](const Nothing&) {
+      return Validator<T, V>::assign_values(std::span<T>(values), _vec);
+    };
+    return InPlaceParser<R, W, std::vector<T>>::read(_r, _var, &values)
+        .and_then(assign);
+  }
+};
+
+}  // namespace parsing
+}  // namespace rfl
+
+#endif
@@ -0,0 +1,66 @@
+#ifndef RFL_PARSING_MAPKEY_HPP_
+#define RFL_PARSING_MAPKEY_HPP_
+
+#include <charconv>
+#include <limits>
+#include <string>
+#include <string_view>
+#include <system_error>
+#include <type_traits>
+
+#include "rfl/Literal.hpp"
+#include "rfl/Result.hpp"
+#include "rfl/internal/StringLiteral.hpp"
+
+namespace rfl {
+namespace parsing {
+
+/// Converts the keys of maps that are written as objects from and to
+/// strings. Only implemented for key types with an unambiguous string
+/// representation.
+template <class K>
+struct MapKey {};
+
+template <class K>
+requires(std::is_integral_v<K> && !std::is_same_v<K, bool>)
+struct MapKey<K> {
+  static Result<K> from_string(const std::string_view _str) noexcept {
+    K key = 0;
+    const auto end = _str.data() + _str.size();
+    const auto [ptr, ec] = std::from_chars(_str.data(), end, key);
+    if (ec != std::errc() || ptr != end) {
+      return Error("Could not parse key '" + std::string(_str) +
+                   "' as an integer.");
+    }
+    return key;
+  }
+
+  static std::string to_string(const K _key) {
+    char buf[std::numeric_limits<K>::digits10 + 3];
+    const auto [ptr, ec] = std::to_chars(buf, buf + sizeof(buf), _key);
+    return std::string(buf, ptr);
+  }
+};
+
+template <internal::StringLiteral... _fields>
+struct MapKey<Literal<_fields...>> {
+  static Result<Literal<_fields...>> from_string(
+      const std::string_view _str) noexcept {
+    return Literal<_fields...>::from_string(std::string(_str));
+  }
+
+  static std::string to_string(const Literal<_fields...>& _key) {
+    return _key.name();
+  }
+};
+
+/// Whether maps with keys of type K can be written as objects.
+template <class K>
+constexpr bool is_map_key() {
+  return requires(K _k) { MapKey<K>::to_string(_k); };
+}
+
+}  // namespace parsing
+}  // namespace rfl
+
+#endif
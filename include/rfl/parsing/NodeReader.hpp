@@ -0,0 +1,225 @@
+#ifndef RFL_PARSING_NODEREADER_HPP_
+#define RFL_PARSING_NODEREADER_HPP_
+
+#include <array>
+#include <cstddef>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "rfl/Result.hpp"
+#include "rfl/always_false.hpp"
+
+namespace rfl {
+namespace parsing {
+
+/// The shared part of the readers for formats that are decoded into a flat
+/// vector of nodes, like MessagePack or rfl::bin. DocumentType must define
+/// NodeType and node(ix). The children of an array or map directly follow
+/// the node itself (for maps, keys and values alternate) and next_ points to
+/// the first node after the entire subtree. The formats derive from this and
+/// add their custom constructors.
+template <class DocumentType>
+struct NodeReader {
+  using Node = typename DocumentType::NodeType;
+
+  struct NodeInputArray {
+    NodeInputArray(const DocumentType* _doc, const size_t _ix)
+        : doc_(_doc), ix_(_ix) {}
+    const DocumentType* doc_;
+    size_t ix_;
+  };
+
+  struct NodeInputObject {
+    NodeInputObject(const DocumentType* _doc, const size_t _ix)
+        : doc_(_doc), ix_(_ix) {}
+    const DocumentType* doc_;
+    size_t ix_;
+  };
+
+  struct NodeInputVar {
+    NodeInputVar() : doc_(nullptr), ix_(0) {}
+    NodeInputVar(const DocumentType* _doc, const size_t _ix)
+        : doc_(_doc), ix_(_ix) {}
+    const Node& node() const { return doc_->node(ix_); }
+    const DocumentType* doc_;
+    size_t ix_;
+  };
+
+  using InputArrayType = NodeInputArray;
+  using InputObjectType = NodeInputObject;
+  using InputVarType = NodeInputVar;
+
+  rfl::Result<InputVarType> get_field(
+      const std::string& _name, const InputObjectType& _obj) const noexcept {
+    std::optional<InputVarType> field;
+    for_each_entry(_obj, [&](std::string_view _key, InputVarType _var) {
+      if (_key == _name) {
+        field = _var;
+        return false;
+      }
+      return true;
+    });
+    if (!field) {
+      return rfl::Error("Map does not contain any element called '" + _name +
+                        "'.");
+    }
+    return *field;
+  }
+
+  bool is_empty(const InputVarType& _var) const noexcept {
+    return !_var.doc_ || _var.node().type_ == Node::Type::nil;
+  }
+
+  template <class T>
+  rfl::Result<T> to_basic_type(const InputVarType& _var) const noexcept {
+    const auto& node = _var.node();
+    if constexpr (std::is_same<std::decay_t<T>, std::string>()) {
+      if (node.type_ != Node::Type::str) {
+        return rfl::Error("Could not cast to string.");
+      }
+      return std::string(node.data_, node.size_);
+    } else if constexpr (std::is_same<std::decay_t<T>, bool>()) {
+      if (node.type_ != Node::Type::boolean) {
+        return rfl::Error("Could not cast to boolean.");
+      }
+      return node.bool_;
+    } else if constexpr (std::is_floating_point<std::decay_t<T>>()) {
+      switch (node.type_) {
+        case Node::Type::float64:
+          return static_cast<T>(node.double_);
+        case Node::Type::int64:
+          return static_cast<T>(node.int_);
+        case Node::Type::uint64:
+          return static_cast<T>(node.uint_);
+        default:
+          return rfl::Error("Could not cast to double.");
+      }
+    } else if constexpr (std::is_integral<std::decay_t<T>>()) {
+      switch (node.type_) {
+        case Node::Type::int64:
+          return static_cast<T>(node.int_);
+        case Node::Type::uint64:
+          return static_cast<T>(node.uint_);
+        default:
+          return rfl::Error("Could not cast to int.");
+      }
+    } else {
+      static_assert(rfl::always_false_v<T>, "Unsupported type.");
+    }
+  }
+
+  /// Returns a view into the underlying buffer, which is only valid as long
+  /// as the buffer is alive.
+  rfl::Result<std::string_view> to_string_view(
+      const InputVarType& _var) const noexcept {
+    const auto& node = _var.node();
+    if (node.type_ != Node::Type::str) {
+      return rfl::Error("Could not cast to string.");
+    }
+    return std::string_view(node.data_, node.size_);
+  }
+
+  rfl::Result<InputArrayType> to_array(
+      const InputVarType& _var) const noexcept {
+    if (_var.node().type_ != Node::Type::array) {
+      return rfl::Error("Could not cast to array!");
+    }
+    return InputArrayType(_var.doc_, _var.ix_);
+  }
+
+  template <size_t size, class FunctionType>
+  std::array<std::optional<InputVarType>, size> to_fields_array(
+      const FunctionType& _fct, const InputObjectType& _obj) const noexcept {
+    std::array<std::optional<InputVarType>, size> f_arr;
+    for_each_entry(_obj, [&](std::string_view _key, InputVarType _var) {
+      const auto field_ix = _fct(_key);
+      if (field_ix != -1) {
+        f_arr[field_ix] = _var;
+      }
+      return true;
+    });
+    return f_arr;
+  }
+
+  /// Calls _f(key, value) for every entry with a string key, until _f
+  /// returns false. The keys are views into the underlying buffer.
+  template <class F>
+  void for_each_entry(const InputObjectType& _obj,
+                      const F& _f) const noexcept {
+    const auto& node = _obj.doc_->node(_obj.ix_);
+    auto ix = _obj.ix_ + 1;
+    for (size_t i = 0; i < node.size_; ++i) {
+      const auto& key = _obj.doc_->node(ix);
+      const auto value_ix = key.next_;
+      if (key.type_ == Node::Type::str) {
+        if (!_f(std::string_view(key.data_, key.size_),
+                InputVarType(_obj.doc_, value_ix))) {
+          return;
+        }
+      }
+      ix = _obj.doc_->node(value_ix).next_;
+    }
+  }
+
+  /// The number of entries in the map.
+  size_t object_size(const InputObjectType& _obj) const noexcept {
+    return _obj.doc_->node(_obj.ix_).size_;
+  }
+
+  std::vector<std::pair<std::string, InputVarType>> to_map(
+      const InputObjectType& _obj) const noexcept {
+    std::vector<std::pair<std::string, InputVarType>> m;
+    m.reserve(object_size(_obj));
+    for_each_entry(_obj, [&](std::string_view _key, InputVarType _var) {
+      m.emplace_back(std::string(_key), _var);
+      return true;
+    });
+    return m;
+  }
+
+  rfl::Result<InputObjectType> to_object(
+      const InputVarType& _var) const noexcept {
+    if (_var.node().type_ != Node::Type::map) {
+      return rfl::Error("Could not cast to map!");
+    }
+    return InputObjectType(_var.doc_, _var.ix_);
+  }
+
+  /// Calls _f(value) for every element of the array, until _f returns false.
+  template <class F>
+  void for_each_element(const InputArrayType& _arr,
+                        const F& _f) const noexcept {
+    const auto& node = _arr.doc_->node(_arr.ix_);
+    auto ix = _arr.ix_ + 1;
+    for (size_t i = 0; i < node.size_; ++i) {
+      if (!_f(InputVarType(_arr.doc_, ix))) {
+        return;
+      }
+      ix = _arr.doc_->node(ix).next_;
+    }
+  }
+
+  /// The number of elements in the array.
+  size_t array_size(const InputArrayType& _arr) const noexcept {
+    return _arr.doc_->node(_arr.ix_).size_;
+  }
+
+  std::vector<InputVarType> to_vec(const InputArrayType& _arr) const noexcept {
+    std::vector<InputVarType> vec;
+    vec.reserve(array_size(_arr));
+    for_each_element(_arr, [&](InputVarType _var) {
+      vec.emplace_back(_var);
+      return true;
+    });
+    return vec;
+  }
+};
+
+}  // namespace parsing
+}  // namespace rfl
+
+#endif
@@ -1,7 +1,9 @@
 #ifndef RFL_PARSING_PARSER_HPP_
 #define RFL_PARSING_PARSER_HPP_
 
+#include <algorithm>
 #include <array>
+#include <concepts>
 #include <cstddef>
 #include <cstdint>
 #include <deque>
@@ -10,9 +12,12 @@
 #include <list>
 #include <map>
 #include <memory>
+#include <memory_resource>
+#include <optional>
 #include <set>
 #include <stdexcept>
 #include <string>
+#include <string_view>
 #include <tuple>
 #include <type_traits>
 #include <unordered_map>
@@ -21,31 +26,47 @@
 #include <vector>
 
 #include "rfl/Box.hpp"
+#include "rfl/FlatMap.hpp"
 #include "rfl/Literal.hpp"
+#include "rfl/ObjectMap.hpp"
 #include "rfl/NamedTuple.hpp"
 #include "rfl/Ref.hpp"
 #include "rfl/Result.hpp"
 #include "rfl/TaggedUnion.hpp"
+#include "rfl/Timestamp.hpp"
+#include "rfl/Validator.hpp"
 #include "rfl/always_false.hpp"
 #include "rfl/field_type.hpp"
 #include "rfl/from_named_tuple.hpp"
-#include "rfl/internal/Memoization.hpp"
+#include "rfl/internal/FieldIndices.hpp"
 #include "rfl/internal/StringLiteral.hpp"
 #include "rfl/internal/all_fields.hpp"
 #include "rfl/internal/has_fields.hpp"
 #include "rfl/internal/has_reflection_method_v.hpp"
 #include "rfl/internal/has_reflection_type_v.hpp"
 #include "rfl/internal/is_basic_type.hpp"
+#include "rfl/internal/is_field.hpp"
 #include "rfl/internal/no_duplicate_field_names.hpp"
+#include "rfl/internal/sorted_field_names.hpp"
 #include "rfl/internal/to_ptr_named_tuple.hpp"
 #include "rfl/internal/to_ptr_tuple.hpp"
 #include "rfl/internal/tuple_t.hpp"
 #include "rfl/named_tuple_t.hpp"
 #include "rfl/parsing/AreReaderAndWriter.hpp"
+#include "rfl/parsing/FlatBuilder.hpp"
+#include "rfl/parsing/MapKey.hpp"
+#include "rfl/parsing/SupportsObjectIteration.hpp"
+#include "rfl/parsing/SupportsStringViewOutput.hpp"
+#include "rfl/parsing/SupportsStringViews.hpp"
+#include "rfl/parsing/has_sorted_keys.hpp"
 #include "rfl/parsing/is_forward_list.hpp"
 #include "rfl/parsing/is_map_like.hpp"
+#include "rfl/parsing/is_positional.hpp"
 #include "rfl/parsing/is_required.hpp"
+#include "rfl/parsing/is_streaming.hpp"
 #include "rfl/parsing/is_set_like.hpp"
+#include "rfl/parsing/memory_resource.hpp"
+#include "rfl/parsing/to_single_error.hpp"
 #include "rfl/to_named_tuple.hpp"
 
 namespace rfl {
@@ -57,6 +78,10 @@ template <class R, class W, class T>
 requires AreReaderAndWriter<R, W, T>
 struct Parser;
 
+template <class R, class W, class T>
+requires AreReaderAndWriter<R, W, T>
+struct InPlaceParser;
+
 // ----------------------------------------------------------------------------
 
 /// Default case - anything that cannot be explicitly matched.
@@ -73,16 +98,30 @@ struct Parser {
     } else {
       if constexpr (internal::has_reflection_type_v<T>) {
         using ReflectionType = std::decay_t<typename T::ReflectionType>;
-        const auto wrap_in_t = [](auto _named_tuple) -> Result<T> {
-          try {
-            return T(_named_tuple);
-          } catch (std::exception& e) {
-            return Error(e.what());
+        const auto wrap_in_t = [](ReflectionType&& _named_tuple) -> Result<T> {
+          if constexpr (requires {
+                          {
+                            T::from_value(std::move(_named_tuple))
+                            } -> std::same_as<Result<T>>;
+                        }) {
+            // Exception-free and moves the value instead of copying it.
+            return T::from_value(std::move(_named_tuple));
+          } else {
+            try {
+              return T(std::move(_named_tuple));
+            } catch (std::exception& e) {
+              return Error(e.what());
+            }
           }
         };
         return Parser<R, W, ReflectionType>::read(_r, _var).and_then(wrap_in_t);
       } else if constexpr (std::is_class_v<T> && std::is_aggregate_v<T>) {
-        if constexpr (internal::has_fields<T>()) {
+        // Default-constructed members would not use the reader's memory
+        // resource, so the struct is then assembled from its fields instead.
+        if constexpr (std::is_nothrow_default_constructible_v<T> &&
+                      !has_memory_resource<R>()) {
+          return read_in_place(_r, _var);
+        } else if constexpr (internal::has_fields<T>()) {
           using NamedTupleType = named_tuple_t<T>;
           const auto to_struct = [](NamedTupleType&& _n) -> Result<T> {
             try {
@@ -144,6 +183,22 @@ struct Parser {
                     "support for your own classes.");
     }
   }
+
+ private:
+  /// Default-constructs the struct and decodes every field straight into its
+  /// final storage, so the fields are not moved out of an intermediate named
+  /// tuple or tuple. Only used for structs that can be default-constructed
+  /// without throwing, which excludes fields that are validators themselves,
+  /// but not vectors of validators.
+  static Result<T> read_in_place(const R& _r,
+                                 const InputVarType& _var) noexcept {
+    auto t = T();
+    const auto res = InPlaceParser<R, W, T>::read(_r, _var, &t);
+    if (!res) {
+      return *res.error();
+    }
+    return t;
+  }
 };
 
 // ----------------------------------------------------------------------------
@@ -266,8 +321,8 @@ struct Parser<R, W, Box<T>> {
 
 // ----------------------------------------------------------------------------
 
-/// Used for maps for which the key type is std::string. These are
-/// represented as objects.
+/// Used for maps for which the key type is std::string and for maps wrapped
+/// in rfl::ObjectMap. These are represented as objects.
 template <class R, class W, class MapType>
 requires AreReaderAndWriter<R, W, MapType>
 struct MapParser {
@@ -278,29 +333,35 @@ struct MapParser {
   using OutputObjectType = typename W::OutputObjectType;
   using OutputVarType = typename W::OutputVarType;
 
+  using KeyType = std::remove_cvref_t<typename MapType::key_type>;
   using ValueType = std::decay_t<typename MapType::value_type::second_type>;
 
-  static Result<MapType> read(const R& _r, const InputVarType& _var) noexcept {
-    const auto get_pair = [&](auto& _pair) {
-      const auto to_pair = [&](ValueType&& _val) {
-        return std::make_pair(std::move(_pair.first), std::move(_val));
-      };
-      return Parser<R, W, std::decay_t<ValueType>>::read(_r, _pair.second)
-          .transform(to_pair)
-          .value();
-    };
+  static constexpr bool has_string_keys_ =
+      std::is_same<KeyType, std::string>() ||
+      std::is_same<KeyType, std::pmr::string>();
 
-    const auto to_map = [&_r, get_pair](const auto& _obj) -> Result<MapType> {
-      auto m = _r.to_map(_obj);
-      MapType res;
-      try {
-        for (auto& p : m) {
-          res.insert(get_pair(p));
+  static_assert(has_string_keys_ || is_map_key<KeyType>(),
+                "Maps can only be written as objects, if the keys are "
+                "strings, integers or rfl::Literal.");
+
+  static Result<MapType> read(const R& _r, const InputVarType& _var) noexcept {
+    const auto to_map = [&_r](const auto& _obj) -> Result<MapType> {
+      if constexpr (is_flat<MapType>()) {
+        using EntryType = typename FlatBuilder<MapType>::EntryType;
+        auto entries = std::vector<EntryType>();
+        const auto err = read_entries(_r, _obj, &entries);
+        if (err) {
+          return *err;
         }
-      } catch (std::exception& e) {
-        return Error(e.what());
+        return FlatBuilder<MapType>::build(std::move(entries));
+      } else {
+        auto res = make_empty<MapType>(_r);
+        const auto err = read_entries(_r, _obj, &res);
+        if (err) {
+          return *err;
+        }
+        return res;
       }
-      return res;
     };
 
     return _r.to_object(_var).and_then(to_map);
@@ -309,23 +370,225 @@ struct MapParser {
   static OutputVarType write(const W& _w, const MapType& _m) noexcept {
     auto obj = _w.new_object();
     for (const auto& [k, v] : _m) {
-      _w.set_field(k, Parser<R, W, std::decay_t<ValueType>>::write(_w, v),
-                   &obj);
+      if constexpr (is_streaming<W>()) {
+        _w.add_key(to_key(k), &obj);
+        Parser<R, W, std::decay_t<ValueType>>::write(_w, v);
+      } else {
+        _w.set_field(to_key(k),
+                     Parser<R, W, std::decay_t<ValueType>>::write(_w, v),
+                     &obj);
+      }
     }
     return obj;
   }
+
+ private:
+  /// The writers expect the keys to be of type std::string.
+  static decltype(auto) to_key(const KeyType& _k) {
+    if constexpr (std::is_same<KeyType, std::string>()) {
+      return (_k);
+    } else if constexpr (has_string_keys_) {
+      return std::string(_k);
+    } else {
+      return MapKey<KeyType>::to_string(_k);
+    }
+  }
+
+  /// Adds an entry to the map or, for flat maps, to the entries the map will
+  /// be built from. Ordered maps are given the end as a hint, so sorted input
+  /// is inserted in amortized constant time.
+  template <class ContainerType, class K>
+  static void add_entry(K&& _key, ValueType&& _val,
+                        ContainerType* _container) {
+    if constexpr (is_flat<MapType>()) {
+      _container->emplace_back(std::forward<K>(_key), std::move(_val));
+    } else if constexpr (requires { typename ContainerType::key_compare; }) {
+      _container->emplace_hint(_container->end(), std::forward<K>(_key),
+                               std::move(_val));
+    } else {
+      _container->emplace(std::forward<K>(_key), std::move(_val));
+    }
+  }
+
+  /// Parses all entries of the object in a single pass. Where the reader
+  /// supports it, the keys are constructed directly from the underlying
+  /// buffer, otherwise they are moved out of the result of to_map.
+  template <class ContainerType>
+  static std::optional<Error> read_entries(const R& _r,
+                                           const InputObjectType& _obj,
+                                           ContainerType* _container) noexcept {
+    std::optional<Error> err;
+
+    const auto read_entry = [&](auto&& _key, const InputVarType& _v) {
+      auto val = Parser<R, W, ValueType>::read(_r, _v);
+      if (!val) {
+        err = *val.error();
+        return false;
+      }
+      if constexpr (has_string_keys_) {
+        add_entry(std::forward<decltype(_key)>(_key), std::move(*val),
+                  _container);
+      } else {
+        auto key = MapKey<KeyType>::from_string(_key);
+        if (!key) {
+          err = *key.error();
+          return false;
+        }
+        add_entry(std::move(*key), std::move(*val), _container);
+      }
+      return true;
+    };
+
+    if constexpr (SupportsObjectIteration<R>) {
+      if constexpr (requires { _container->reserve(size_t()); }) {
+        _container->reserve(_r.object_size(_obj));
+      }
+      _r.for_each_entry(_obj, read_entry);
+    } else {
+      auto m = _r.to_map(_obj);
+      if constexpr (requires { _container->reserve(size_t()); }) {
+        _container->reserve(m.size());
+      }
+      for (auto& [k, v] : m) {
+        if (!read_entry(std::move(k), v)) {
+          break;
+        }
+      }
+    }
+
+    return err;
+  }
 };
 
-template <class R, class W, class T>
-requires AreReaderAndWriter<R, W, std::map<std::string, T>>
-struct Parser<R, W, std::map<std::string, T>>
-    : public MapParser<R, W, std::map<std::string, T>> {
+template <class R, class W, class T, class C, class A>
+requires AreReaderAndWriter<R, W, std::map<std::string, T, C, A>>
+struct Parser<R, W, std::map<std::string, T, C, A>>
+    : public MapParser<R, W, std::map<std::string, T, C, A>> {
 };
 
-template <class R, class W, class T>
-requires AreReaderAndWriter<R, W, std::unordered_map<std::string, T>>
-struct Parser<R, W, std::unordered_map<std::string, T>>
-    : public MapParser<R, W, std::unordered_map<std::string, T>> {
+template <class R, class W, class T, class C, class A>
+requires AreReaderAndWriter<R, W, std::map<std::pmr::string, T, C, A>>
+struct Parser<R, W, std::map<std::pmr::string, T, C, A>>
+    : public MapParser<R, W, std::map<std::pmr::string, T, C, A>> {
+};
+
+template <class R, class W, class T, class H, class E, class A>
+requires AreReaderAndWriter<R, W, std::unordered_map<std::string, T, H, E, A>>
+struct Parser<R, W, std::unordered_map<std::string, T, H, E, A>>
+    : public MapParser<R, W, std::unordered_map<std::string, T, H, E, A>> {
+};
+
+template <class R, class W, class T, class H, class E, class A>
+requires AreReaderAndWriter<R, W,
+                            std::unordered_map<std::pmr::string, T, H, E, A>>
+struct Parser<R, W, std::unordered_map<std::pmr::string, T, H, E, A>>
+    : public MapParser<R, W,
+                       std::unordered_map<std::pmr::string, T, H, E, A>> {
+};
+
+template <class R, class W, class T, class C>
+requires AreReaderAndWriter<R, W, FlatMap<std::string, T, C>>
+struct Parser<R, W, FlatMap<std::string, T, C>>
+    : public MapParser<R, W, FlatMap<std::string, T, C>> {
+};
+
+#ifdef __cpp_lib_flat_map
+template <class R, class W, class T, class C, class KC, class MC>
+requires AreReaderAndWriter<R, W, std::flat_map<std::string, T, C, KC, MC>>
+struct Parser<R, W, std::flat_map<std::string, T, C, KC, MC>>
+    : public MapParser<R, W, std::flat_map<std::string, T, C, KC, MC>> {
+};
+#endif
+
+template <class R, class W, class MapType>
+requires AreReaderAndWriter<R, W, ObjectMap<MapType>>
+struct Parser<R, W, ObjectMap<MapType>> {
+  using InputVarType = typename R::InputVarType;
+  using OutputVarType = typename W::OutputVarType;
+
+  static Result<ObjectMap<MapType>> read(const R& _r,
+                                         const InputVarType& _var) noexcept {
+    const auto wrap = [](MapType&& _m) {
+      return ObjectMap<MapType>(std::move(_m));
+    };
+    return MapParser<R, W, MapType>::read(_r, _var).transform(wrap);
+  }
+
+  static OutputVarType write(const W& _w,
+                             const ObjectMap<MapType>& _m) noexcept {
+    return MapParser<R, W, MapType>::write(_w, _m.get());
+  }
+};
+
+// ----------------------------------------------------------------------------
+
+/// Writes a string that is not stored in a std::string. A temporary
+/// std::string is only needed for writers that do not support string views.
+template <class W>
+auto write_string_view(const W& _w, const std::string_view _str) noexcept {
+  if constexpr (SupportsStringViewOutput<W>) {
+    return _w.from_string_view(_str);
+  } else {
+    return _w.from_basic_type(std::string(_str));
+  }
+}
+
+// ----------------------------------------------------------------------------
+
+/// Strings with a polymorphic allocator are allocated from the reader's
+/// memory resource. Where the reader supports it, they are copied straight
+/// from the underlying buffer.
+template <class R, class W>
+requires AreReaderAndWriter<R, W, std::pmr::string>
+struct Parser<R, W, std::pmr::string> {
+  using InputVarType = typename R::InputVarType;
+  using OutputVarType = typename W::OutputVarType;
+
+  static Result<std::pmr::string> read(const R& _r,
+                                       const InputVarType& _var) noexcept {
+    const auto to_pmr_string = [&](const auto& _str) {
+      return std::pmr::string(_str.data(), _str.size(),
+                              get_memory_resource(_r));
+    };
+    if constexpr (SupportsStringViews<R>) {
+      return _r.to_string_view(_var).transform(to_pmr_string);
+    } else {
+      return _r.template to_basic_type<std::string>(_var).transform(
+          to_pmr_string);
+    }
+  }
+
+  static OutputVarType write(const W& _w,
+                             const std::pmr::string& _str) noexcept {
+    return write_string_view(_w, _str);
+  }
+};
+
+// ----------------------------------------------------------------------------
+
+/// Time stamps are formatted into a buffer on the stack, so writing them does
+/// not allocate.
+template <class R, class W, internal::StringLiteral _format>
+requires AreReaderAndWriter<R, W, Timestamp<_format>>
+struct Parser<R, W, Timestamp<_format>> {
+  using InputVarType = typename R::InputVarType;
+  using OutputVarType = typename W::OutputVarType;
+
+  using TimestampType = Timestamp<_format>;
+
+  static Result<TimestampType> read(const R& _r,
+                                    const InputVarType& _var) noexcept {
+    const auto from_string = [](const std::string& _str) {
+      return TimestampType::from_string(_str);
+    };
+    return Parser<R, W, std::string>::read(_r, _var).and_then(from_string);
+  }
+
+  static OutputVarType write(const W& _w, const TimestampType& _ts) noexcept {
+    char buf[TimestampType::max_size_];
+    const auto size = _ts.write_to(buf);
+    return write_string_view(_w, std::string_view(buf, size));
+  }
 };
 
 // ----------------------------------------------------------------------------
@@ -336,6 +599,7 @@ struct Parser<R, W, NamedTuple<FieldTypes...>> {
   using InputObjectType = typename R::InputObjectType;
   using InputVarType = typename R::InputVarType;
 
+  using OutputArrayType = typename W::OutputArrayType;
   using OutputObjectType = typename W::OutputObjectType;
   using OutputVarType = typename W::OutputVarType;
 
@@ -343,13 +607,59 @@ struct Parser<R, W, NamedTuple<FieldTypes...>> {
   /// Generates a NamedTuple from a JSON Object.
   static Result<NamedTuple<FieldTypes...>> read(
       const R& _r, const InputVarType& _var) noexcept {
-    const auto& indices = field_indices();
-    const auto fct = [&](const std::string_view& _str) -> std::int16_t {
-      const auto it = indices.find(_str);
-      return it != indices.end() ? it->second : static_cast<std::uint16_t>(-1);
-    };
-    const auto to_fields_array = [&](auto _obj) {
+    if constexpr (is_positional<R, W>()) {
+      return read_positional(_r, _var);
+    } else {
+      return read_named(_r, _var);
+    }
+  }
+
+  /// Transforms a NamedTuple into a JSON object.
+  static OutputVarType write(const W& _w,
+                             const NamedTuple<FieldTypes...>& _tup) noexcept {
+    if constexpr (is_positional<R, W>()) {
+      auto arr = _w.new_array();
+      build_array_recursively(_w, _tup, &arr);
+      return OutputVarType(arr);
+    } else {
+      auto obj = _w.new_object();
+      build_object_recursively(_w, _tup, &obj);
+      return OutputVarType(obj);
+    }
+  }
+
+  /// Uses a memoization pattern to retrieve the field indices.
+  /// There are some objects that we are likely to parse many times,
+  /// so we only calculate these indices once.
+  static const auto& field_indices() noexcept {
+    return internal::FieldIndices<FieldTypes::name_...>::get();
+  }
+
+  /// Assigns the values in the object to the fields.
+  static std::array<std::optional<InputVarType>, sizeof...(FieldTypes)>
+  match_fields(const R& _r, const InputObjectType& _obj) noexcept {
+    if constexpr (has_sorted_keys<R>()) {
+      constexpr auto sorted_names =
+          internal::sorted_field_names<FieldTypes...>();
+      return _r.template to_fields_array_sorted<sizeof...(FieldTypes)>(
+          sorted_names, _obj);
+    } else {
+      const auto& indices = field_indices();
+      const auto fct = [&](const std::string_view& _str) -> std::int16_t {
+        const auto it = indices.find(_str);
+        return it != indices.end() ? it->second
+                                   : static_cast<std::uint16_t>(-1);
+      };
       return _r.template to_fields_array<sizeof...(FieldTypes)>(fct, _obj);
+    }
+  }
+
+ private:
+  /// Reads the fields by their names.
+  static Result<NamedTuple<FieldTypes...>> read_named(
+      const R& _r, const InputVarType& _var) noexcept {
+    const auto to_fields_array = [&](auto _obj) {
+      return match_fields(_r, _obj);
     };
     const auto build = [&](auto _fields_vec) {
       return build_named_tuple_recursively(_r, _fields_vec);
@@ -357,15 +667,25 @@ struct Parser<R, W, NamedTuple<FieldTypes...>> {
     return _r.to_object(_var).transform(to_fields_array).and_then(build);
   }
 
-  /// Transforms a NamedTuple into a JSON object.
-  static OutputVarType write(const W& _w,
-                             const NamedTuple<FieldTypes...>& _tup) noexcept {
-    auto obj = _w.new_object();
-    build_object_recursively(_w, _tup, &obj);
-    return OutputVarType(obj);
+  /// Reads the fields by their position. Fields missing at the end of the
+  /// array are treated like fields missing from an object.
+  static Result<NamedTuple<FieldTypes...>> read_positional(
+      const R& _r, const InputVarType& _var) noexcept {
+    const auto to_fields_array = [&](auto _arr) {
+      const auto vec = _r.to_vec(_arr);
+      std::array<std::optional<InputVarType>, sizeof...(FieldTypes)> f_arr;
+      const auto size = std::min(vec.size(), f_arr.size());
+      for (size_t i = 0; i < size; ++i) {
+        f_arr[i] = vec[i];
+      }
+      return f_arr;
+    };
+    const auto build = [&](auto _fields_vec) {
+      return build_named_tuple_recursively(_r, _fields_vec);
+    };
+    return _r.to_array(_var).transform(to_fields_array).and_then(build);
   }
 
- private:
   /// Builds the named tuple field by field.
   template <class... Args>
   static Result<NamedTuple<FieldTypes...>> build_named_tuple_recursively(
@@ -421,16 +741,7 @@ struct Parser<R, W, NamedTuple<FieldTypes...>> {
           _fields_arr,
       std::vector<Error> _errors) noexcept {
     if constexpr (_i == sizeof...(FieldTypes)) {
-      if (_errors.size() == 1) {
-        return std::move(_errors[0]);
-      } else {
-        std::string msg =
-            "Found " + std::to_string(_errors.size()) + " errors:";
-        for (size_t i = 0; i < _errors.size(); ++i) {
-          msg += "\n" + std::to_string(i + 1) + ") " + _errors.at(i).what();
-        }
-        return Error(msg);
-      }
+      return to_single_error(std::move(_errors));
     } else {
       using FieldType = typename std::tuple_element<
           _i, typename NamedTuple<FieldTypes...>::Fields>::type;
@@ -470,24 +781,55 @@ struct Parser<R, W, NamedTuple<FieldTypes...>> {
       using FieldType =
           typename std::tuple_element<_i, std::tuple<FieldTypes...>>::type;
       using ValueType = std::decay_t<typename FieldType::Type>;
-      auto value = Parser<R, W, ValueType>::write(_w, rfl::get<_i>(_tup));
-      const auto name = FieldType::name_.str();
-      if constexpr (!is_required<ValueType>()) {
-        if (!_w.is_empty(value)) {
-          _w.set_field(name, value, _ptr);
+      if constexpr (is_streaming<W>()) {
+        if (!is_empty_value(rfl::get<_i>(_tup))) {
+          _w.add_key(FieldType::name_.string_view(), _ptr);
+          Parser<R, W, ValueType>::write(_w, rfl::get<_i>(_tup));
         }
+        return build_object_recursively<_i + 1>(_w, _tup, _ptr);
       } else {
-        _w.set_field(name, value, _ptr);
+        auto value = Parser<R, W, ValueType>::write(_w, rfl::get<_i>(_tup));
+        const auto name = FieldType::name_.str();
+        if constexpr (!is_required<ValueType>()) {
+          if (!_w.is_empty(value)) {
+            _w.set_field(name, value, _ptr);
+          }
+        } else {
+          _w.set_field(name, value, _ptr);
+        }
+        return build_object_recursively<_i + 1>(_w, _tup, _ptr);
       }
-      return build_object_recursively<_i + 1>(_w, _tup, _ptr);
     }
   }
 
-  /// Uses a memoization pattern to retrieve the field indices.
-  /// There are some objects that we are likely to parse many times,
-  /// so we only calculate these indices once.
-  static const auto& field_indices() noexcept {
-    return field_indices_.value(set_field_indices<0>);
+  /// Streaming writers must know whether a field is empty before its name is
+  /// written, so this is determined from the value itself.
+  template <class T>
+  static bool is_empty_value(const T& _val) noexcept {
+    if constexpr (std::is_pointer_v<T>) {
+      return !_val || is_empty_value(*_val);
+    } else if constexpr (!is_required<T>()) {
+      return !_val;
+    } else {
+      return false;
+    }
+  }
+
+  /// Builds the array field by field. Empty values must be written as well,
+  /// because the position is all that identifies a field.
+  template <int _i = 0>
+  static void build_array_recursively(const W& _w,
+                                      const NamedTuple<FieldTypes...>& _tup,
+                                      OutputArrayType* _ptr) noexcept {
+    if constexpr (_i >= sizeof...(FieldTypes)) {
+      return;
+    } else {
+      using FieldType =
+          typename std::tuple_element<_i, std::tuple<FieldTypes...>>::type;
+      using ValueType = std::decay_t<typename FieldType::Type>;
+      _w.add(Parser<R, W, ValueType>::write(_w, rfl::get<_i>(_tup)), _ptr);
+      return build_array_recursively<_i + 1>(_w, _tup, _ptr);
+    }
   }
 
   /// Retrieves the value from the object. This is mainly needed to
@@ -501,28 +843,6 @@ struct Parser<R, W, NamedTuple<FieldTypes...>> {
     using ValueType = std::decay_t<typename FieldType::Type>;
     return Parser<R, W, ValueType>::read(_r, _var).or_else(embellish_error);
   }
-
-  /// Builds the object field by field.
-  template <size_t _i = 0>
-  static void set_field_indices(
-      std::unordered_map<std::string_view, std::int16_t>*
-          _field_indices) noexcept {
-    if constexpr (_i >= sizeof...(FieldTypes)) {
-      return;
-    } else {
-      using FieldType =
-          typename std::tuple_element<_i, std::tuple<FieldTypes...>>::type;
-      const auto name = FieldType::name_.string_view();
-      (*_field_indices)[name] = static_cast<std::int16_t>(_i);
-      set_field_indices<_i + 1>(_field_indices);
-    }
-  }
-
- private:
-  /// Maps each of the field names to an index signifying their order.
-  static inline internal::Memoization<
-      std::unordered_map<std::string_view, std::int16_t>>
-      field_indices_;
 };
 
 // ----------------------------------------------------------------------------
@@ -614,7 +934,15 @@ struct Parser<R, W, Result<T>> {
           _w, ErrorType(make_field<"error">(_err.what())));
     };
 
-    return *_r.transform(write_t).or_else(write_err);
+    if constexpr (is_positional<R, W>()) {
+      // Uses the same layout as the IndexedVariantParser.
+      auto arr = _w.new_array();
+      _w.add(_w.from_basic_type(static_cast<size_t>(_r ? 0 : 1)), &arr);
+      _w.add(*_r.transform(write_t).or_else(write_err), &arr);
+      return OutputVarType(arr);
+    } else {
+      return *_r.transform(write_t).or_else(write_err);
+    }
   }
 };
 
@@ -694,15 +1022,27 @@ struct Parser<R, W, TaggedUnion<_discriminator, AlternativeTypes...>> {
 
   /// Expresses the variables as type T.
   static ResultType read(const R& _r, const InputVarType& _var) noexcept {
-    const auto get_disc = [&_r](auto _obj) {
-      return get_discriminator(_r, _obj);
-    };
+    if constexpr (is_positional<R, W>()) {
+      using VariantType =
+          typename TaggedUnion<_discriminator,
+                               AlternativeTypes...>::VariantType;
+      const auto to_tagged_union = [](auto&& _variant) {
+        return TaggedUnion<_discriminator, AlternativeTypes...>(
+            std::move(_variant));
+      };
+      return Parser<R, W, VariantType>::read(_r, _var).transform(
+          to_tagged_union);
+    } else {
+      const auto get_disc = [&_r](auto _obj) {
+        return get_discriminator(_r, _obj);
+      };
 
-    const auto to_result = [&_r, _var](const std::string& _disc_value) {
-      return find_matching_alternative(_r, _disc_value, _var);
-    };
+      const auto to_result = [&_r, _var](const std::string& _disc_value) {
+        return find_matching_alternative(_r, _disc_value, _var);
+      };
 
-    return _r.to_object(_var).and_then(get_disc).and_then(to_result);
+      return _r.to_object(_var).and_then(get_disc).and_then(to_result);
+    }
   }
 
   /// Expresses the variables as a JSON type.
@@ -1010,6 +1350,102 @@ struct FieldVariantParser {
 
 // ----------------------------------------------------------------------------
 
+/// To be used by positional formats, which cannot rely on field names or
+/// discriminators. The variant is written as an array containing the index
+/// of the alternative followed by the alternative itself.
+template <class R, class W, class... AlternativeTypes>
+requires AreReaderAndWriter<R, W, std::variant<AlternativeTypes...>>
+struct IndexedVariantParser {
+  using ResultType = Result<std::variant<AlternativeTypes...>>;
+
+ public:
+  using InputVarType = typename R::InputVarType;
+  using OutputVarType = typename W::OutputVarType;
+
+  /// Expresses the variables as type T.
+  static ResultType read(const R& _r, const InputVarType& _var) noexcept {
+    const auto to_vec = [&](auto _arr) { return _r.to_vec(_arr); };
+
+    const auto to_result = [&](auto _vec) -> ResultType {
+      if (_vec.size() != 2) {
+        return Error(
+            "Could not parse variant: Expected an array of size 2, but "
+            "found " +
+            std::to_string(_vec.size()) + " elements.");
+      }
+      const auto read_alternative = [&](const size_t _index) {
+        return find_matching_alternative(_r, _index, _vec[1]);
+      };
+      return _r.template to_basic_type<size_t>(_vec[0]).and_then(
+          read_alternative);
+    };
+
+    return _r.to_array(_var).transform(to_vec).and_then(to_result);
+  }
+
+  /// Expresses the variables as a JSON type.
+  static OutputVarType write(
+      const W& _w, const std::variant<AlternativeTypes...>& _v) noexcept {
+    const auto handle = [&](const auto& _alt) {
+      using Type = std::decay_t<decltype(_alt)>;
+      if constexpr (internal::is_field_v<Type>) {
+        using ValueType = std::decay_t<typename Type::Type>;
+        return Parser<R, W, ValueType>::write(_w, _alt.value());
+      } else {
+        return Parser<R, W, Type>::write(_w, _alt);
+      }
+    };
+    auto arr = _w.new_array();
+    _w.add(_w.from_basic_type(_v.index()), &arr);
+    _w.add(std::visit(handle, _v), &arr);
+    return OutputVarType(arr);
+  }
+
+ private:
+  template <size_t _i = 0>
+  static ResultType find_matching_alternative(
+      const R& _r, const size_t _index, const InputVarType& _var) noexcept {
+    if constexpr (_i == sizeof...(AlternativeTypes)) {
+      return Error("Could not parse variant: Index " + std::to_string(_index) +
+                   " is out of range.");
+    } else {
+      if (_index == _i) {
+        using AltType = std::decay_t<
+            std::variant_alternative_t<_i, std::variant<AlternativeTypes...>>>;
+        if constexpr (internal::is_field_v<AltType>) {
+          // Fields are written without their names.
+          using ValueType = std::decay_t<typename AltType::Type>;
+          return read_alternative<_i, AltType, ValueType>(_r, _var);
+        } else {
+          return read_alternative<_i, AltType, AltType>(_r, _var);
+        }
+      } else {
+        return find_matching_alternative<_i + 1>(_r, _index, _var);
+      }
+    }
+  }
+
+  template <size_t _i, class AltType, class ValueType>
+  static ResultType read_alternative(const R& _r,
+                                     const InputVarType& _var) noexcept {
+    const auto to_variant = [](ValueType&& _val) {
+      return std::variant<AlternativeTypes...>(std::in_place_index<_i>,
+                                               AltType(std::move(_val)));
+    };
+
+    const auto embellish_error = [](const Error& _e) {
+      return Error("Could not parse variant alternative " +
+                   std::to_string(_i) + ": " + _e.what());
+    };
+
+    return Parser<R, W, ValueType>::read(_r, _var)
+        .transform(to_variant)
+        .or_else(embellish_error);
+  }
+};
+
+// ----------------------------------------------------------------------------
+
 template <class R, class W, class... FieldTypes>
 requires AreReaderAndWriter<R, W, rfl::Variant<FieldTypes...>>
 struct Parser<R, W, rfl::Variant<FieldTypes...>> {
@@ -1047,8 +1483,10 @@ struct Parser<R, W, std::variant<FieldTypes...>> {
   static Result<std::variant<FieldTypes...>> read(
       const R& _r, const InputVarType& _var,
       const std::string _errors = "") noexcept {
-    if constexpr (_i == 0 &&
-                  internal::all_fields<std::tuple<FieldTypes...>>()) {
+    if constexpr (is_positional<R, W>()) {
+      return IndexedVariantParser<R, W, FieldTypes...>::read(_r, _var);
+    } else if constexpr (_i == 0 &&
+                         internal::all_fields<std::tuple<FieldTypes...>>()) {
       return FieldVariantParser<R, W, FieldTypes...>::read(_r, _var);
     } else if constexpr (_i == sizeof...(FieldTypes)) {
       return Error("Could not parse variant: " + _errors);
@@ -1076,7 +1514,9 @@ struct Parser<R, W, std::variant<FieldTypes...>> {
   /// Expresses the variables as a JSON type.
   static OutputVarType write(
       const W& _w, const std::variant<FieldTypes...>& _variant) noexcept {
-    if constexpr (internal::all_fields<std::tuple<FieldTypes...>>()) {
+    if constexpr (is_positional<R, W>()) {
+      return IndexedVariantParser<R, W, FieldTypes...>::write(_w, _variant);
+    } else if constexpr (internal::all_fields<std::tuple<FieldTypes...>>()) {
       return FieldVariantParser<R, W, FieldTypes...>::write(_w, _variant);
     } else {
       const auto handle = [&](const auto& _v) {
@@ -1124,25 +1564,39 @@ struct VectorParser {
 
     const auto to_container = [&](InputArrayType&& _arr) -> Result<VecType> {
       auto input_vars = _r.to_vec(_arr);
-      VecType vec;
-      if constexpr (is_forward_list<VecType>()) {
-        for (auto it = input_vars.rbegin(); it != input_vars.rend(); ++it) {
-          vec.emplace_front(get_elem(*it));
-        }
-      } else if constexpr (is_map_like<VecType>()) {
-        for (auto& v : input_vars) {
-          vec.insert(get_pair(v));
-        }
-      } else if constexpr (is_set_like<VecType>()) {
+      if constexpr (is_flat<VecType>()) {
+        using EntryType = typename FlatBuilder<VecType>::EntryType;
+        auto entries = std::vector<EntryType>();
+        entries.reserve(input_vars.size());
         for (auto& v : input_vars) {
-          vec.insert(get_elem(v));
+          if constexpr (is_map_like<VecType>()) {
+            entries.emplace_back(get_pair(v));
+          } else {
+            entries.emplace_back(get_elem(v));
+          }
         }
+        return FlatBuilder<VecType>::build(std::move(entries));
       } else {
-        for (auto& v : input_vars) {
-          vec.emplace_back(get_elem(v));
+        auto vec = make_empty<VecType>(_r);
+        if constexpr (is_forward_list<VecType>()) {
+          for (auto it = input_vars.rbegin(); it != input_vars.rend(); ++it) {
+            vec.emplace_front(get_elem(*it));
+          }
+        } else if constexpr (is_map_like<VecType>()) {
+          for (auto& v : input_vars) {
+            vec.insert(get_pair(v));
+          }
+        } else if constexpr (is_set_like<VecType>()) {
+          for (auto& v : input_vars) {
+            vec.insert(get_elem(v));
+          }
+        } else {
+          for (auto& v : input_vars) {
+            vec.emplace_back(get_elem(v));
+          }
         }
+        return vec;
       }
-      return vec;
     };
 
     const auto to_result = [&](InputArrayType&& _arr) -> Result<VecType> {
@@ -1166,76 +1620,121 @@ struct VectorParser {
   }
 };
 
-template <class R, class W, class T>
-requires AreReaderAndWriter<R, W, std::deque<T>>
-struct Parser<R, W, std::deque<T>> : public VectorParser<R, W, std::deque<T>> {
+template <class R, class W, class T, class A>
+requires AreReaderAndWriter<R, W, std::deque<T, A>>
+struct Parser<R, W, std::deque<T, A>>
+    : public VectorParser<R, W, std::deque<T, A>> {
 };
 
-template <class R, class W, class T>
-requires AreReaderAndWriter<R, W, std::forward_list<T>>
-struct Parser<R, W, std::forward_list<T>>
-    : public VectorParser<R, W, std::forward_list<T>> {
+template <class R, class W, class K, class V, class C>
+requires AreReaderAndWriter<R, W, FlatMap<K, V, C>>
+struct Parser<R, W, FlatMap<K, V, C>>
+    : public VectorParser<R, W, FlatMap<K, V, C>> {
 };
 
-template <class R, class W, class T>
-requires AreReaderAndWriter<R, W, std::list<T>>
-struct Parser<R, W, std::list<T>> : public VectorParser<R, W, std::list<T>> {
+#ifdef __cpp_lib_flat_map
+template <class R, class W, class K, class V, class C, class KC, class MC>
+requires AreReaderAndWriter<R, W, std::flat_map<K, V, C, KC, MC>>
+struct Parser<R, W, std::flat_map<K, V, C, KC, MC>>
+    : public VectorParser<R, W, std::flat_map<K, V, C, KC, MC>> {
 };
+#endif
 
-template <class R, class W, class K, class V>
-requires AreReaderAndWriter<R, W, std::map<K, V>>
-struct Parser<R, W, std::map<K, V>>
-    : public VectorParser<R, W, std::map<K, V>> {
+#ifdef __cpp_lib_flat_set
+template <class R, class W, class T, class C, class KC>
+requires AreReaderAndWriter<R, W, std::flat_set<T, C, KC>>
+struct Parser<R, W, std::flat_set<T, C, KC>>
+    : public VectorParser<R, W, std::flat_set<T, C, KC>> {
 };
+#endif
 
-template <class R, class W, class K, class V>
-requires AreReaderAndWriter<R, W, std::multimap<K, V>>
-struct Parser<R, W, std::multimap<K, V>>
-    : public VectorParser<R, W, std::multimap<K, V>> {
+template <class R, class W, class T, class A>
+requires AreReaderAndWriter<R, W, std::forward_list<T, A>>
+struct Parser<R, W, std::forward_list<T, A>>
+    : public VectorParser<R, W, std::forward_list<T, A>> {
 };
 
-template <class R, class W, class T>
-requires AreReaderAndWriter<R, W, std::multiset<T>>
-struct Parser<R, W, std::multiset<T>>
-    : public VectorParser<R, W, std::multiset<T>> {
+template <class R, class W, class T, class A>
+requires AreReaderAndWriter<R, W, std::list<T, A>>
+struct Parser<R, W, std::list<T, A>>
+    : public VectorParser<R, W, std::list<T, A>> {
 };
 
-template <class R, class W, class T>
-requires AreReaderAndWriter<R, W, std::set<T>>
-struct Parser<R, W, std::set<T>> : public VectorParser<R, W, std::set<T>> {
+template <class R, class W, class K, class V, class C, class A>
+requires AreReaderAndWriter<R, W, std::map<K, V, C, A>>
+struct Parser<R, W, std::map<K, V, C, A>>
+    : public VectorParser<R, W, std::map<K, V, C, A>> {
 };
 
-template <class R, class W, class K, class V>
-requires AreReaderAndWriter<R, W, std::unordered_map<K, V>>
-struct Parser<R, W, std::unordered_map<K, V>>
-    : public VectorParser<R, W, std::unordered_map<K, V>> {
+template <class R, class W, class K, class V, class C, class A>
+requires AreReaderAndWriter<R, W, std::multimap<K, V, C, A>>
+struct Parser<R, W, std::multimap<K, V, C, A>>
+    : public VectorParser<R, W, std::multimap<K, V, C, A>> {
 };
 
-template <class R, class W, class T>
-requires AreReaderAndWriter<R, W, std::unordered_multiset<T>>
-struct Parser<R, W, std::unordered_multiset<T>>
-    : public VectorParser<R, W, std::unordered_multiset<T>> {
+template <class R, class W, class T, class C, class A>
+requires AreReaderAndWriter<R, W, std::multiset<T, C, A>>
+struct Parser<R, W, std::multiset<T, C, A>>
+    : public VectorParser<R, W, std::multiset<T, C, A>> {
 };
 
-template <class R, class W, class K, class V>
-requires AreReaderAndWriter<R, W, std::unordered_multimap<K, V>>
-struct Parser<R, W, std::unordered_multimap<K, V>>
-    : public VectorParser<R, W, std::unordered_multimap<K, V>> {
+template <class R, class W, class T, class C, class A>
+requires AreReaderAndWriter<R, W, std::set<T, C, A>>
+struct Parser<R, W, std::set<T, C, A>>
+    : public VectorParser<R, W, std::set<T, C, A>> {
 };
 
-template <class R, class W, class T>
-requires AreReaderAndWriter<R, W, std::unordered_set<T>>
-struct Parser<R, W, std::unordered_set<T>>
-    : public VectorParser<R, W, std::unordered_set<T>> {
+template <class R, class W, class K, class V, class H, class E, class A>
+requires AreReaderAndWriter<R, W, std::unordered_map<K, V, H, E, A>>
+struct Parser<R, W, std::unordered_map<K, V, H, E, A>>
+    : public VectorParser<R, W, std::unordered_map<K, V, H, E, A>> {
 };
 
-template <class R, class W, class T>
-requires AreReaderAndWriter<R, W, std::vector<T>>
-struct Parser<R, W, std::vector<T>>
-    : public VectorParser<R, W, std::vector<T>> {
+template <class R, class W, class T, class H, class E, class A>
+requires AreReaderAndWriter<R, W, std::unordered_multiset<T, H, E, A>>
+struct Parser<R, W, std::unordered_multiset<T, H, E, A>>
+    : public VectorParser<R, W, std::unordered_multiset<T, H, E, A>> {
+};
+
+template <class R, class W, class K, class V, class H, class E, class A>
+requires AreReaderAndWriter<R, W, std::unordered_multimap<K, V, H, E, A>>
+struct Parser<R, W, std::unordered_multimap<K, V, H, E, A>>
+    : public VectorParser<R, W, std::unordered_multimap<K, V, H, E, A>> {
+};
+
+template <class R, class W, class T, class H, class E, class A>
+requires AreReaderAndWriter<R, W, std::unordered_set<T, H, E, A>>
+struct Parser<R, W, std::unordered_set<T, H, E, A>>
+    : public VectorParser<R, W, std::unordered_set<T, H, E, A>> {
+};
+
+template <class R, class W, class T, class A>
+requires AreReaderAndWriter<R, W, std::vector<T, A>>
+struct Parser<R, W, std::vector<T, A>>
+    : public VectorParser<R, W, std::vector<T, A>> {
+};
+
+/// Vectors of validated numbers are read as plain numbers first, so that they
+/// can be validated in a single pass.
+template <class R, class W, class T, class V>
+requires(AreReaderAndWriter<R, W, std::vector<Validator<T, V>>> &&
+         std::is_arithmetic_v<T>)
+struct Parser<R, W, std::vector<Validator<T, V>>>
+    : public VectorParser<R, W, std::vector<Validator<T, V>>> {
+  using InputVarType = typename R::InputVarType;
+
+  static Result<std::vector<Validator<T, V>>> read(
+      const R& _r, const InputVarType& _var) noexcept {
+    return Parser<R, W, std::vector<T>>::read(_r, _var).and_then(
+        Validator<T, V>::from_values);
+  }
 };
 
 }  // namespace parsing
 }  // namespace rfl
 
+// The InPlaceParser is needed by Parser::read, but depends on the Parser
+// itself, so it can only be included once the Parser is defined.
+#include "rfl/parsing/InPlaceParser.hpp"
+
 #endif  // JSON_PARSER_HPP_
@@ -0,0 +1,30 @@
+#ifndef RFL_PARSING_READERWITHRESOURCE_HPP_
+#define RFL_PARSING_READERWITHRESOURCE_HPP_
+
+#include <memory_resource>
+
+namespace rfl {
+namespace parsing {
+
+/// Wraps a reader, so that containers and strings with polymorphic
+/// allocators, like std::pmr::vector or std::pmr::string, are allocated
+/// from _resource. For instance, the entire object graph of a request can
+/// live in a std::pmr::monotonic_buffer_resource and be freed at once.
+template <class R>
+struct ReaderWithResource : public R {
+  ReaderWithResource(const R& _r, std::pmr::memory_resource* _resource)
+      : R(_r), resource_(_resource) {}
+
+  /// The memory resource all allocations are drawn from.
+  std::pmr::memory_resource* memory_resource() const noexcept {
+    return resource_;
+  }
+
+ private:
+  std::pmr::memory_resource* resource_;
+};
+
+}  // namespace parsing
+}  // namespace rfl
+
+#endif
@@ -0,0 +1,23 @@
+#ifndef RFL_PARSING_SUPPORTSARRAYITERATION_HPP_
+#define RFL_PARSING_SUPPORTSARRAYITERATION_HPP_
+
+#include <concepts>
+#include <cstddef>
+
+namespace rfl {
+namespace parsing {
+
+/// Readers can optionally iterate over the elements of an array directly.
+/// This allows us to overwrite existing containers without first copying
+/// every element into a temporary vector.
+template <class R>
+concept SupportsArrayIteration =
+    requires(R r, typename R::InputArrayType arr) {
+      { r.array_size(arr) } -> std::convertible_to<size_t>;
+      r.for_each_element(arr, [](typename R::InputVarType) { return true; });
+    };
+
+}  // namespace parsing
+}  // namespace rfl
+
+#endif
@@ -0,0 +1,26 @@
+#ifndef RFL_PARSING_SUPPORTSOBJECTITERATION_HPP_
+#define RFL_PARSING_SUPPORTSOBJECTITERATION_HPP_
+
+#include <concepts>
+#include <cstddef>
+#include <string_view>
+
+namespace rfl {
+namespace parsing {
+
+/// Readers can optionally iterate over the entries of an object directly,
+/// passing the keys as views into the underlying buffer. This allows us to
+/// decode maps without first copying every key into a temporary vector.
+template <class R>
+concept SupportsObjectIteration =
+    requires(R r, typename R::InputObjectType obj) {
+      { r.object_size(obj) } -> std::convertible_to<size_t>;
+      r.for_each_entry(obj, [](std::string_view, typename R::InputVarType) {
+        return true;
+      });
+    };
+
+}  // namespace parsing
+}  // namespace rfl
+
+#endif
@@ -0,0 +1,21 @@
+#ifndef RFL_PARSING_SUPPORTSSTRINGVIEWOUTPUT_HPP_
+#define RFL_PARSING_SUPPORTSSTRINGVIEWOUTPUT_HPP_
+
+#include <concepts>
+#include <string_view>
+
+namespace rfl {
+namespace parsing {
+
+/// Writers can optionally write strings from a std::string_view. This allows
+/// us to write strings that are not stored in a std::string, like formatted
+/// time stamps, without allocating.
+template <class W>
+concept SupportsStringViewOutput = requires(W w, std::string_view str) {
+  { w.from_string_view(str) } -> std::same_as<typename W::OutputVarType>;
+};
+
+}  // namespace parsing
+}  // namespace rfl
+
+#endif
@@ -0,0 +1,22 @@
+#ifndef RFL_PARSING_SUPPORTSSTRINGVIEWS_HPP_
+#define RFL_PARSING_SUPPORTSSTRINGVIEWS_HPP_
+
+#include <concepts>
+#include <string_view>
+
+#include "rfl/Result.hpp"
+
+namespace rfl {
+namespace parsing {
+
+/// Readers can optionally expose strings as views into the underlying
+/// buffer. This allows us to overwrite existing strings without allocating.
+template <class R>
+concept SupportsStringViews = requires(R r, typename R::InputVarType var) {
+  { r.to_string_view(var) } -> std::same_as<rfl::Result<std::string_view>>;
+};
+
+}  // namespace parsing
+}  // namespace rfl
+
+#endif
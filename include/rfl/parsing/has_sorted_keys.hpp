@@ -0,0 +1,29 @@
+#ifndef RFL_PARSING_HAS_SORTED_KEYS_HPP_
+#define RFL_PARSING_HAS_SORTED_KEYS_HPP_
+
+#include <concepts>
+
+namespace rfl {
+namespace parsing {
+
+/// Some formats, such as flexbuffers, always store the keys of an object in
+/// sorted order. Readers for these formats can declare
+/// static constexpr bool sorted_keys = true and provide
+/// to_fields_array_sorted<size>(_names, _obj), where _names are the field
+/// names sorted at compile time. The fields can then be matched in a single
+/// pass over the keys without any hashing.
+template <class R>
+constexpr bool has_sorted_keys() {
+  if constexpr (requires {
+                  { R::sorted_keys } -> std::convertible_to<bool>;
+                }) {
+    return R::sorted_keys;
+  } else {
+    return false;
+  }
+}
+
+}  // namespace parsing
+}  // namespace rfl
+
+#endif
@@ -13,8 +13,8 @@ class is_forward_list;
 template <class T>
 class is_forward_list : public std::false_type {};
 
-template <class T>
-class is_forward_list<std::forward_list<T>> : public std::true_type {};
+template <class T, class A>
+class is_forward_list<std::forward_list<T, A>> : public std::true_type {};
 
 }  // namespace parsing
 }  // namespace rfl
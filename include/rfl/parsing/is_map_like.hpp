@@ -5,6 +5,12 @@
 #include <type_traits>
 #include <unordered_map>
 
+#if __has_include(<flat_map>)
+#include <flat_map>
+#endif
+
+#include "rfl/FlatMap.hpp"
+
 namespace rfl {
 namespace parsing {
 
@@ -14,17 +20,26 @@ class is_map_like;
 template <class T>
 class is_map_like : public std::false_type {};
 
-template <class K, class V>
-class is_map_like<std::map<K, V>> : public std::true_type {};
+template <class K, class V, class C, class A>
+class is_map_like<std::map<K, V, C, A>> : public std::true_type {};
 
-template <class K, class V>
-class is_map_like<std::multimap<K, V>> : public std::true_type {};
+template <class K, class V, class C, class A>
+class is_map_like<std::multimap<K, V, C, A>> : public std::true_type {};
 
-template <class K, class V>
-class is_map_like<std::unordered_map<K, V>> : public std::true_type {};
+template <class K, class V, class H, class E, class A>
+class is_map_like<std::unordered_map<K, V, H, E, A>> : public std::true_type {};
 
-template <class K, class V>
-class is_map_like<std::unordered_multimap<K, V>> : public std::true_type {};
+template <class K, class V, class H, class E, class A>
+class is_map_like<std::unordered_multimap<K, V, H, E, A>>
+    : public std::true_type {};
+
+template <class K, class V, class C>
+class is_map_like<FlatMap<K, V, C>> : public std::true_type {};
+
+#ifdef __cpp_lib_flat_map
+template <class K, class V, class C, class KC, class MC>
+class is_map_like<std::flat_map<K, V, C, KC, MC>> : public std::true_type {};
+#endif
 
 }  // namespace parsing
 }  // namespace rfl
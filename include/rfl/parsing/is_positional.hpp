@@ -0,0 +1,29 @@
+#ifndef RFL_PARSING_IS_POSITIONAL_HPP_
+#define RFL_PARSING_IS_POSITIONAL_HPP_
+
+#include <concepts>
+
+namespace rfl {
+namespace parsing {
+
+/// Positional formats do not write any field names. Instead, the fields of a
+/// struct are written as an array in the order in which they are declared
+/// and variants are written as a pair of the index of the alternative and the
+/// alternative itself. Readers and writers opt in by declaring
+/// static constexpr bool positional = true.
+template <class R, class W>
+constexpr bool is_positional() {
+  if constexpr (requires {
+                  { R::positional } -> std::convertible_to<bool>;
+                  { W::positional } -> std::convertible_to<bool>;
+                }) {
+    return R::positional && W::positional;
+  } else {
+    return false;
+  }
+}
+
+}  // namespace parsing
+}  // namespace rfl
+
+#endif
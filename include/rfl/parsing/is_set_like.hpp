@@ -14,17 +14,18 @@ class is_set_like;
 template <class T>
 class is_set_like : public std::false_type {};
 
-template <class T>
-class is_set_like<std::set<T>> : public std::true_type {};
+template <class T, class C, class A>
+class is_set_like<std::set<T, C, A>> : public std::true_type {};
 
-template <class T>
-class is_set_like<std::unordered_set<T>> : public std::true_type {};
+template <class T, class H, class E, class A>
+class is_set_like<std::unordered_set<T, H, E, A>> : public std::true_type {};
 
-template <class T>
-class is_set_like<std::multiset<T>> : public std::true_type {};
+template <class T, class C, class A>
+class is_set_like<std::multiset<T, C, A>> : public std::true_type {};
 
-template <class T>
-class is_set_like<std::unordered_multiset<T>> : public std::true_type {};
+template <class T, class H, class E, class A>
+class is_set_like<std::unordered_multiset<T, H, E, A>>
+    : public std::true_type {};
 
 }  // namespace parsing
 }  // namespace rfl
@@ -0,0 +1,30 @@
+#ifndef RFL_PARSING_IS_STREAMING_HPP_
+#define RFL_PARSING_IS_STREAMING_HPP_
+
+#include <concepts>
+
+namespace rfl {
+namespace parsing {
+
+/// Streaming writers write every value as soon as it is created instead of
+/// building a tree first, so the arrays and objects are written in the order
+/// in which they are opened. Because of that, they must know the name of a
+/// field before its value is written. Writers opt in by declaring
+/// static constexpr bool streaming = true and by providing
+/// add_key(std::string_view, OutputObjectType*), which is then called instead
+/// of set_field(...).
+template <class W>
+constexpr bool is_streaming() {
+  if constexpr (requires {
+                  { W::streaming } -> std::convertible_to<bool>;
+                }) {
+    return W::streaming;
+  } else {
+    return false;
+  }
+}
+
+}  // namespace parsing
+}  // namespace rfl
+
+#endif
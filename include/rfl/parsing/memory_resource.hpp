@@ -0,0 +1,53 @@
+#ifndef RFL_PARSING_MEMORY_RESOURCE_HPP_
+#define RFL_PARSING_MEMORY_RESOURCE_HPP_
+
+#include <concepts>
+#include <memory_resource>
+#include <type_traits>
+
+namespace rfl {
+namespace parsing {
+
+/// Readers can optionally provide a memory resource, which is then used for
+/// all containers and strings with polymorphic allocators, like
+/// std::pmr::vector or std::pmr::string. See ReaderWithResource.
+template <class R>
+constexpr bool has_memory_resource() {
+  return requires(const R& r) {
+    { r.memory_resource() } -> std::same_as<std::pmr::memory_resource*>;
+  };
+}
+
+/// Whether T allocates through a polymorphic allocator.
+template <class T>
+concept UsesMemoryResource = requires {
+  typename T::allocator_type;
+} && std::is_constructible_v<typename T::allocator_type,
+                             std::pmr::memory_resource*>;
+
+/// Returns the memory resource of the reader, or the default resource, if
+/// the reader does not provide one.
+template <class R>
+std::pmr::memory_resource* get_memory_resource(const R& _r) noexcept {
+  if constexpr (has_memory_resource<R>()) {
+    return _r.memory_resource();
+  } else {
+    return std::pmr::get_default_resource();
+  }
+}
+
+/// Creates an empty container or string. If it uses a polymorphic allocator,
+/// the allocator draws from the reader's memory resource.
+template <class T, class R>
+T make_empty(const R& _r) {
+  if constexpr (UsesMemoryResource<T>) {
+    return T(typename T::allocator_type(get_memory_resource(_r)));
+  } else {
+    return T();
+  }
+}
+
+}  // namespace parsing
+}  // namespace rfl
+
+#endif
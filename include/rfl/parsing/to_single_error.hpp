@@ -0,0 +1,29 @@
+#ifndef RFL_PARSING_TO_SINGLE_ERROR_HPP_
+#define RFL_PARSING_TO_SINGLE_ERROR_HPP_
+
+#include <string>
+#include <vector>
+
+#include "rfl/Result.hpp"
+
+namespace rfl {
+namespace parsing {
+
+/// Combines several errors into a single error message. If something went
+/// wrong, we want to report all of the errors - it's just good UX.
+inline Error to_single_error(std::vector<Error> _errors) noexcept {
+  if (_errors.size() == 1) {
+    return std::move(_errors[0]);
+  } else {
+    std::string msg = "Found " + std::to_string(_errors.size()) + " errors:";
+    for (size_t i = 0; i < _errors.size(); ++i) {
+      msg += "\n" + std::to_string(i + 1) + ") " + _errors.at(i).what();
+    }
+    return Error(msg);
+  }
+}
+
+}  // namespace parsing
+}  // namespace rfl
+
+#endif
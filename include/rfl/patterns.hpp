@@ -1,34 +1,96 @@
 #ifndef RFL_PATTERNS_HPP_
 #define RFL_PATTERNS_HPP_
 
+#include <string_view>
+
 #include "rfl/Pattern.hpp"
+#include "rfl/PatternValidator.hpp"
+#include "rfl/Result.hpp"
 #include "rfl/Validator.hpp"
+#include "rfl/internal/StringLiteral.hpp"
+#include "rfl/internal/pattern_matchers.hpp"
 
 namespace rfl {
+namespace patterns {
+
+inline constexpr internal::StringLiteral base64_encoded =
+    R"(^[A-Za-z0-9+/]*(={0,2})?$)";
+
+inline constexpr internal::StringLiteral email =
+    R"(^[a-zA-Z0-9._%+-]+@[a-zA-Z0-9.-]+\.[a-zA-Z]{2,}$)";
+
+inline constexpr internal::StringLiteral uuid_v1 =
+    R"(^[0-9a-fA-F]{8}-[0-9a-fA-F]{4}-1[0-9a-fA-F]{3}-[89abAB][0-9a-fA-F]{3}-[0-9a-fA-F]{12}$)";
+
+inline constexpr internal::StringLiteral uuid_v2 =
+    R"(^[0-9a-fA-F]{8}-[0-9a-fA-F]{4}-2[0-9a-fA-F]{3}-[89abAB][0-9a-fA-F]{3}-[0-9a-fA-F]{12}$)";
+
+inline constexpr internal::StringLiteral uuid_v3 =
+    R"(^[0-9a-fA-F]{8}-[0-9a-fA-F]{4}-3[0-9a-fA-F]{3}-[89abAB][0-9a-fA-F]{3}-[0-9a-fA-F]{12}$)";
+
+inline constexpr internal::StringLiteral uuid_v4 =
+    R"(^[0-9a-fA-F]{8}-[0-9a-fA-F]{4}-4[0-9a-fA-F]{3}-[89abAB][0-9a-fA-F]{3}-[0-9a-fA-F]{12}$)";
+
+}  // namespace patterns
+
+/// The predefined patterns are matched by hand-written code rather than
+/// a compiled regex.
+template <>
+struct PatternMatcher<patterns::base64_encoded> {
+  static Result<bool> match(const std::string_view& _str) noexcept {
+    return internal::match_base64(_str);
+  }
+};
+
+template <>
+struct PatternMatcher<patterns::email> {
+  static Result<bool> match(const std::string_view& _str) noexcept {
+    return internal::match_email(_str);
+  }
+};
+
+template <>
+struct PatternMatcher<patterns::uuid_v1> {
+  static Result<bool> match(const std::string_view& _str) noexcept {
+    return internal::match_uuid<'1'>(_str);
+  }
+};
+
+template <>
+struct PatternMatcher<patterns::uuid_v2> {
+  static Result<bool> match(const std::string_view& _str) noexcept {
+    return internal::match_uuid<'2'>(_str);
+  }
+};
+
+template <>
+struct PatternMatcher<patterns::uuid_v3> {
+  static Result<bool> match(const std::string_view& _str) noexcept {
+    return internal::match_uuid<'3'>(_str);
+  }
+};
+
+template <>
+struct PatternMatcher<patterns::uuid_v4> {
+  static Result<bool> match(const std::string_view& _str) noexcept {
+    return internal::match_uuid<'4'>(_str);
+  }
+};
 
 /// This pattern will match valid Base64 encoded strings with or without
 /// padding.
-using Base64Encoded = Pattern<R"(^[A-Za-z0-9+/]*(={0,2})?$)", "Base64Encoded">;
+using Base64Encoded = Pattern<patterns::base64_encoded, "Base64Encoded">;
 
 /// This pattern will match email addresses.
-using Email =
-    Pattern<R"(^[a-zA-Z0-9._%+-]+@[a-zA-Z0-9.-]+\.[a-zA-Z]{2,}$)", "Email">;
+using Email = Pattern<patterns::email, "Email">;
 
-using UUIDv1 = Pattern<
-    R"(^[0-9a-fA-F]{8}-[0-9a-fA-F]{4}-1[0-9a-fA-F]{3}-[89abAB][0-9a-fA-F]{3}-[0-9a-fA-F]{12}$)",
-    "UUIDv1">;
+using UUIDv1 = Pattern<patterns::uuid_v1, "UUIDv1">;
 
-using UUIDv2 = Pattern<
-    R"(^[0-9a-fA-F]{8}-[0-9a-fA-F]{4}-2[0-9a-fA-F]{3}-[89abAB][0-9a-fA-F]{3}-[0-9a-fA-F]{12}$)",
-    "UUIDv2">;
+using UUIDv2 = Pattern<patterns::uuid_v2, "UUIDv2">;
 
-using UUIDv3 = Pattern<
-    R"(^[0-9a-fA-F]{8}-[0-9a-fA-F]{4}-3[0-9a-fA-F]{3}-[89abAB][0-9a-fA-F]{3}-[0-9a-fA-F]{12}$)",
-    "UUIDv3">;
+using UUIDv3 = Pattern<patterns::uuid_v3, "UUIDv3">;
 
-using UUIDv4 = Pattern<
-    R"(^[0-9a-fA-F]{8}-[0-9a-fA-F]{4}-4[0-9a-fA-F]{3}-[89abAB][0-9a-fA-F]{3}-[0-9a-fA-F]{12}$)",
-    "UUIDv4">;
+using UUIDv4 = Pattern<patterns::uuid_v4, "UUIDv4">;
 
 }  // namespace rfl
 
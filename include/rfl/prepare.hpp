@@ -0,0 +1,26 @@
+#ifndef RFL_PREPARE_HPP_
+#define RFL_PREPARE_HPP_
+
+#include <chrono>
+
+#include "rfl/internal/Preparer.hpp"
+
+namespace rfl {
+
+/// Builds the tables that are otherwise built on the first read of a type,
+/// such as the field indices of every struct and the compiled regexes of
+/// every pattern. Walks the complete type graph of T: nested structs,
+/// containers, variants, tagged unions and validators. Call it at startup
+/// to keep this work away from the first request. Returns how long the
+/// preparation took. Types with custom parsers are not walked into.
+template <class T>
+std::chrono::nanoseconds prepare() {
+  const auto begin = std::chrono::steady_clock::now();
+  auto prepared = internal::PreparedTypes();
+  internal::prepare_type<T>(&prepared);
+  return std::chrono::steady_clock::now() - begin;
+}
+
+}  // namespace rfl
+
+#endif
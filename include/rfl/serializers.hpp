@@ -0,0 +1,41 @@
+#ifndef RFL_SERIALIZERS_HPP_
+#define RFL_SERIALIZERS_HPP_
+
+/// Every translation unit that reads or writes a type instantiates the whole
+/// parser tree for it. For types that are used in many translation units, you
+/// can instead instantiate the serializers once:
+///
+/// In the header that defines the type:
+///     RFL_DECLARE_SERIALIZERS(Order, json)
+///
+/// In exactly one source file:
+///     RFL_DEFINE_SERIALIZERS(Order, json)
+///
+/// The declaration is an explicit instantiation declaration (extern template)
+/// of the format's read and write functions, so translation units that only
+/// see the declaration call the instantiations in the defining translation
+/// unit instead of compiling their own. Compilers may still instantiate
+/// extern templates for inlining, so write(const T&) is also declared as an
+/// ordinary function, which overload resolution prefers over the template and
+/// which is only ever compiled in the defining translation unit. read<T>
+/// cannot be overloaded like this, because T is not deduced from its
+/// arguments. The format is the name of the format's namespace and its header
+/// must be included first. Types containing commas must be given an alias and
+/// types are looked up from within the format's namespace, so they should be
+/// fully qualified.
+#define RFL_DECLARE_SERIALIZERS(T, format) \
+  RFL_SERIALIZERS_##format(extern, T)      \
+      RFL_SERIALIZER_OVERLOADS_##format(T, RFL_INTERNAL_DECLARE_ONLY)
+
+/// Instantiates the serializers declared by RFL_DECLARE_SERIALIZERS. Must be
+/// used at global scope in exactly one translation unit.
+#define RFL_DEFINE_SERIALIZERS(T, format) \
+  RFL_SERIALIZERS_##format(, T)           \
+      RFL_SERIALIZER_OVERLOADS_##format(T, RFL_INTERNAL_DEFINE_AS)
+
+/// Used by the formats to either declare the overloads or define them with
+/// the body passed as the argument.
+#define RFL_INTERNAL_DECLARE_ONLY(...) ;
+#define RFL_INTERNAL_DEFINE_AS(...) __VA_ARGS__
+
+#endif
@@ -0,0 +1,67 @@
+#ifndef RFL_TO_COLUMNS_HPP_
+#define RFL_TO_COLUMNS_HPP_
+
+#include <tuple>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "rfl/columns_t.hpp"
+#include "rfl/get.hpp"
+#include "rfl/internal/to_ptr_named_tuple.hpp"
+
+namespace rfl {
+namespace internal {
+
+template <class T>
+T* const_cast_ptr(const T* _ptr) {
+  return const_cast<T*>(_ptr);
+}
+
+template <class T, class VecType, size_t... _is>
+columns_t<T> to_columns(VecType&& _vec, std::index_sequence<_is...>) {
+  using ColumnsType = columns_t<T>;
+  typename ColumnsType::Values columns;
+  (std::get<_is>(columns).reserve(_vec.size()), ...);
+  for (auto& t : _vec) {
+    const auto ptr_named_tuple = to_ptr_named_tuple(t);
+    if constexpr (std::is_lvalue_reference<VecType>{}) {
+      (std::get<_is>(columns).push_back(*rfl::get<_is>(ptr_named_tuple)),
+       ...);
+    } else {
+      // The pointers are const, but we own the vector, so we might as well
+      // move the values.
+      (std::get<_is>(columns).push_back(
+           std::move(*const_cast_ptr(rfl::get<_is>(ptr_named_tuple)))),
+       ...);
+    }
+  }
+  return ColumnsType(std::move(std::get<_is>(columns))...);
+}
+
+}  // namespace internal
+
+/// Turns a vector of structs into a named tuple containing one vector per
+/// field (struct-of-arrays), which is often more efficient when you only need
+/// some of the fields.
+template <class T>
+columns_t<T> to_columns(const std::vector<T>& _vec) {
+  using Values = typename columns_t<T>::Values;
+  return internal::to_columns<T>(
+      _vec, std::make_index_sequence<std::tuple_size_v<Values>>());
+}
+
+/// Turns a vector of structs into a named tuple containing one vector per
+/// field (struct-of-arrays). The values are moved out of the structs.
+template <class T>
+columns_t<T> to_columns(std::vector<T>&& _vec) {
+  using Values = typename columns_t<T>::Values;
+  auto columns = internal::to_columns<T>(
+      std::move(_vec), std::make_index_sequence<std::tuple_size_v<Values>>());
+  _vec.clear();
+  return columns;
+}
+
+}  // namespace rfl
+
+#endif
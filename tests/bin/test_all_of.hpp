@@ -0,0 +1,25 @@
+#include <iostream>
+#include <rfl.hpp>
+#include <rfl/bin.hpp>
+#include <string>
+#include <vector>
+
+#include "write_and_read.hpp"
+
+void test_all_of() {
+  std::cout << "test_all_of" << std::endl;
+
+  using Age = rfl::Validator<unsigned int,
+                             rfl::AllOf<rfl::Minimum<0>, rfl::Maximum<130>>>;
+
+  struct Person {
+    rfl::Field<"firstName", std::string> first_name;
+    rfl::Field<"lastName", std::string> last_name;
+    rfl::Field<"age", Age> age;
+  };
+
+  const auto homer =
+      Person{.first_name = "Homer", .last_name = "Simpson", .age = 45};
+
+  write_and_read(homer);
+}
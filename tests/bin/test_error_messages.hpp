@@ -0,0 +1,72 @@
+#include <iostream>
+#include <rfl.hpp>
+#include <rfl/bin.hpp>
+#include <string>
+#include <vector>
+
+#include "write_and_read.hpp"
+
+void test_error_messages() {
+  std::cout << "test_error_messages" << std::endl;
+
+  struct Person {
+    rfl::Field<"firstName", std::string> first_name;
+    rfl::Field<"lastName", std::string> last_name;
+    rfl::Field<"birthday", rfl::Timestamp<"%Y-%m-%d">> birthday;
+    rfl::Field<"children", std::vector<Person>> children;
+  };
+
+  struct FaultyPerson {
+    rfl::Field<"firstName", std::string> first_name;
+    rfl::Field<"lastName", int> last_name;
+    rfl::Field<"birthday", std::string> birthday;
+  };
+
+  const auto faulty_person = FaultyPerson{
+      .first_name = "Homer", .last_name = 12345, .birthday = "04/19/1987"};
+
+  const auto result =
+      rfl::bin::read<Person>(rfl::bin::write(faulty_person));
+
+  const std::string expected =
+      "Could not parse binary format: The fingerprint in the header does not "
+      "match the type. The data was written for a different schema.";
+
+  if (!result.error()) {
+    std::cout << "Expected an error, got none." << std::endl << std::endl;
+    return;
+  }
+
+  if (result.error().value().what() != expected) {
+    std::cout << "Expected: " << std::endl
+              << expected << std::endl
+              << "Got:" << std::endl
+              << result.error().value().what() << std::endl
+              << std::endl;
+    return;
+  }
+
+  const auto bart = Person{.first_name = "Bart",
+                           .last_name = "Simpson",
+                           .birthday = "1987-04-19",
+                           .children = std::vector<Person>()};
+
+  const auto bytes = rfl::bin::write(bart);
+
+  const auto truncated =
+      std::vector<unsigned char>(bytes.begin(), bytes.end() - 1);
+
+  if (rfl::bin::read<Person>(truncated)) {
+    std::cout << "Expected an error on truncated input, got none." << std::endl
+              << std::endl;
+    return;
+  }
+
+  if (rfl::bin::read<Person>(std::vector<unsigned char>())) {
+    std::cout << "Expected an error on empty input, got none." << std::endl
+              << std::endl;
+    return;
+  }
+
+  std::cout << "OK" << std::endl << std::endl;
+}
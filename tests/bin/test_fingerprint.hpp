@@ -0,0 +1,73 @@
+#include <iostream>
+#include <rfl.hpp>
+#include <rfl/bin.hpp>
+#include <string>
+#include <vector>
+
+#include "write_and_read.hpp"
+
+namespace test_fingerprint_structs {
+
+struct Person {
+  rfl::Field<"firstName", std::string> first_name;
+  rfl::Field<"lastName", std::string> last_name;
+  rfl::Field<"age", int> age;
+  rfl::Field<"children", std::vector<Person>> children;
+};
+
+struct Renamed {
+  rfl::Field<"firstName", std::string> first_name;
+  rfl::Field<"surname", std::string> last_name;
+  rfl::Field<"age", int> age;
+  rfl::Field<"children", std::vector<Renamed>> children;
+};
+
+struct Reordered {
+  rfl::Field<"lastName", std::string> last_name;
+  rfl::Field<"firstName", std::string> first_name;
+  rfl::Field<"age", int> age;
+  rfl::Field<"children", std::vector<Reordered>> children;
+};
+
+struct Retyped {
+  rfl::Field<"firstName", std::string> first_name;
+  rfl::Field<"lastName", std::string> last_name;
+  rfl::Field<"age", double> age;
+  rfl::Field<"children", std::vector<Retyped>> children;
+};
+
+}  // namespace test_fingerprint_structs
+
+void test_fingerprint() {
+  std::cout << "test_fingerprint" << std::endl;
+
+  using namespace test_fingerprint_structs;
+
+  constexpr auto fp = rfl::bin::fingerprint<Person>();
+
+  static_assert(fp != rfl::bin::fingerprint<Renamed>());
+  static_assert(fp != rfl::bin::fingerprint<Reordered>());
+  static_assert(fp != rfl::bin::fingerprint<Retyped>());
+
+  const auto bart = Person{.first_name = "Bart",
+                           .last_name = "Simpson",
+                           .age = 10,
+                           .children = std::vector<Person>()};
+
+  const auto homer = Person{.first_name = "Homer",
+                            .last_name = "Simpson",
+                            .age = 45,
+                            .children = std::vector<Person>({bart})};
+
+  const auto bytes = rfl::bin::write(homer);
+
+  if (rfl::bin::read<Renamed>(bytes) || rfl::bin::read<Reordered>(bytes) ||
+      rfl::bin::read<Retyped>(bytes)) {
+    std::cout << "Expected an error on a schema mismatch, got none."
+              << std::endl
+              << std::endl;
+    return;
+  }
+
+  write_and_read(homer);
+}
@@ -0,0 +1,34 @@
+#include <cstdint>
+#include <iostream>
+#include <limits>
+#include <rfl.hpp>
+#include <rfl/bin.hpp>
+#include <vector>
+
+#include "write_and_read.hpp"
+
+// Makes sure that integers are written as compactly as possible.
+void test_integers() {
+  std::cout << "test_integers" << std::endl;
+
+  const auto ints = std::vector<std::int64_t>(
+      {0, 14, 15, 142, 143, 16398, 16399, -1, -15, -16, -143, -144,
+       std::numeric_limits<std::int64_t>::min()});
+
+  // Not counting the header.
+  const auto expected_sizes =
+      std::vector<size_t>({1, 1, 2, 2, 3, 3, 4, 1, 1, 2, 2, 3, 10});
+
+  for (size_t i = 0; i < ints.size(); ++i) {
+    const auto bytes = rfl::bin::write(ints[i]);
+    if (bytes.size() != rfl::bin::header_size + expected_sizes[i]) {
+      std::cout << "Test failed. Expected " << ints[i] << " to be encoded in "
+                << expected_sizes[i] << " bytes, got "
+                << bytes.size() - rfl::bin::header_size << "." << std::endl
+                << std::endl;
+      return;
+    }
+  }
+
+  write_and_read(ints);
+}
@@ -0,0 +1,25 @@
+#include <iostream>
+#include <memory>
+#include <rfl.hpp>
+#include <rfl/bin.hpp>
+#include <string>
+#include <unordered_map>
+
+#include "write_and_read.hpp"
+
+void test_string_unordered_map() {
+    std::cout << "test_string_unordered_map" << std::endl;
+
+    using Map = std::unordered_map<std::string, std::unique_ptr<std::string>>;
+    Map homer;
+    homer.insert(
+        std::make_pair("firstName", std::make_unique<std::string>("Homer")));
+    homer.insert(
+        std::make_pair("lastName", std::make_unique<std::string>("Simpson")));
+
+    // Unordered maps are unpredictable. We therefore only make sure that this
+    // compiles.
+    const auto bytes = rfl::bin::write(homer);
+    const auto homer2 = rfl::bin::read<Map>(bytes);
+    std::cout << "OK" << std::endl << std::endl;
+}
@@ -0,0 +1,74 @@
+#include <iostream>
+#include <optional>
+#include <rfl.hpp>
+#include <rfl/columnar.hpp>
+#include <string>
+#include <vector>
+
+void test_save_load() {
+  std::cout << "test_save_load" << std::endl;
+
+  struct Person {
+    rfl::Field<"firstName", std::string> first_name;
+    rfl::Field<"lastName", rfl::Literal<"Simpson", "Flanders">> last_name;
+    rfl::Field<"birthday", rfl::Timestamp<"%Y-%m-%d">> birthday;
+    rfl::Field<"age", unsigned int> age;
+    rfl::Field<"height", double> height;
+    rfl::Field<"nickname", std::optional<std::string>> nickname;
+    rfl::Field<"children", std::vector<Person>> children;
+  };
+
+  const auto bart = Person{.first_name = "Bart",
+                           .last_name = rfl::Literal<"Simpson", "Flanders">::
+                               make<"Simpson">(),
+                           .birthday = "1987-04-19",
+                           .age = 10,
+                           .height = 1.2,
+                           .nickname = "El Barto",
+                           .children = std::vector<Person>()};
+
+  const auto people = std::vector<Person>(
+      {Person{.first_name = "Homer",
+              .last_name = rfl::Literal<"Simpson", "Flanders">::
+                  make<"Simpson">(),
+              .birthday = "1956-05-12",
+              .age = 45,
+              .height = 1.8,
+              .nickname = std::nullopt,
+              .children = std::vector<Person>({bart})},
+       Person{.first_name = "Ned",
+              .last_name = rfl::Literal<"Simpson", "Flanders">::
+                  make<"Flanders">(),
+              .birthday = "1950-01-01",
+              .age = 60,
+              .height = 1.75,
+              .nickname = std::nullopt,
+              .children = std::vector<Person>()}});
+
+  rfl::columnar::save("people.rflc", people);
+
+  const auto people2 = rfl::columnar::load<Person>("people.rflc");
+
+  if (!people2) {
+    std::cout << "Test failed on load. Error: "
+              << people2.error().value().what() << std::endl
+              << std::endl;
+    return;
+  }
+
+  if (rfl::columnar::write(people) != rfl::columnar::write(*people2)) {
+    std::cout << "Test failed. Content was not identical." << std::endl
+              << std::endl;
+    return;
+  }
+
+  const auto empty = rfl::columnar::read<Person>(
+      rfl::columnar::write(std::vector<Person>()));
+
+  if (!empty || (*empty).size() != 0) {
+    std::cout << "Test failed on empty vector." << std::endl << std::endl;
+    return;
+  }
+
+  std::cout << "OK" << std::endl << std::endl;
+}
@@ -0,0 +1,103 @@
+#include <iostream>
+#include <numeric>
+#include <rfl.hpp>
+#include <rfl/columnar.hpp>
+#include <string>
+#include <vector>
+
+void test_table() {
+  std::cout << "test_table" << std::endl;
+
+  struct Measurement {
+    rfl::Field<"sensor", std::string> sensor;
+    rfl::Field<"value", double> value;
+    rfl::Field<"tags", std::vector<std::string>> tags;
+  };
+
+  auto measurements = std::vector<Measurement>();
+  for (int i = 0; i < 100; ++i) {
+    measurements.push_back(
+        Measurement{.sensor = "sensor" + std::to_string(i % 7),
+                    .value = static_cast<double>(i),
+                    .tags = std::vector<std::string>(i % 3, "tag")});
+  }
+
+  const auto bytes = rfl::columnar::write(measurements);
+
+  const auto table =
+      rfl::columnar::Table<Measurement>::from_bytes(bytes.data(), bytes.size())
+          .value();
+
+  if (table.size() != measurements.size()) {
+    std::cout << "Test failed. Expected " << measurements.size()
+              << " rows, got " << table.size() << "." << std::endl
+              << std::endl;
+    return;
+  }
+
+  // Arithmetic columns are views into the buffer.
+  const std::span<const double> values = table.column<"value">().value();
+
+  const auto sum = std::accumulate(values.begin(), values.end(), 0.0);
+
+  if (sum != 4950.0) {
+    std::cout << "Test failed. Expected a sum of 4950, got " << sum << "."
+              << std::endl
+              << std::endl;
+    return;
+  }
+
+  const auto sensors = table.column<"sensor">().value();
+
+  if (sensors.size() != 100 || sensors[8] != "sensor1") {
+    std::cout << "Test failed. Unexpected sensor column." << std::endl
+              << std::endl;
+    return;
+  }
+
+  size_t num_sensor0 = 0;
+  for (const auto s : sensors) {
+    if (s == "sensor0") {
+      ++num_sensor0;
+    }
+  }
+
+  if (num_sensor0 != 15) {
+    std::cout << "Test failed. Expected 15 rows for sensor0, got "
+              << num_sensor0 << "." << std::endl
+              << std::endl;
+    return;
+  }
+
+  const auto tags = table.column<"tags">().value();
+
+  if (tags.size() != 100 || tags[2].size() != 2) {
+    std::cout << "Test failed. Unexpected tags column." << std::endl
+              << std::endl;
+    return;
+  }
+
+  struct Other {
+    rfl::Field<"sensor", std::string> sensor;
+    rfl::Field<"value", float> value;
+    rfl::Field<"tags", std::vector<std::string>> tags;
+  };
+
+  if (rfl::columnar::read<Other>(bytes)) {
+    std::cout << "Expected an error on a schema mismatch, got none."
+              << std::endl
+              << std::endl;
+    return;
+  }
+
+  const auto truncated =
+      std::vector<unsigned char>(bytes.begin(), bytes.end() - 1);
+
+  if (rfl::columnar::read<Measurement>(truncated)) {
+    std::cout << "Expected an error on truncated input, got none." << std::endl
+              << std::endl;
+    return;
+  }
+
+  std::cout << "OK" << std::endl << std::endl;
+}
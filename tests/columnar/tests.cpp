@@ -0,0 +1,9 @@
+#include "test_save_load.hpp"
+#include "test_table.hpp"
+
+int main() {
+  test_save_load();
+  test_table();
+
+  return 0;
+}
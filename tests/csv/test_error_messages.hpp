@@ -0,0 +1,61 @@
+#include <iostream>
+#include <rfl.hpp>
+#include <rfl/csv.hpp>
+#include <string>
+
+namespace tem {
+
+struct Person {
+  rfl::Field<"name", std::string> name;
+  rfl::Field<"age", rfl::Validator<int, rfl::Minimum<0>>> age;
+};
+
+bool expect_error(const std::string& _csv_str, const std::string& _expected) {
+  const auto res = rfl::csv::read<Person>(_csv_str);
+  if (res) {
+    std::cout << "Test failed. Expected an error for:" << std::endl
+              << _csv_str << std::endl
+              << std::endl;
+    return false;
+  }
+  if (res.error().value().what() != _expected) {
+    std::cout << "Test failed. Expected:" << std::endl
+              << _expected << std::endl
+              << "Got:" << std::endl
+              << res.error().value().what() << std::endl
+              << std::endl;
+    return false;
+  }
+  return true;
+}
+
+}  // namespace tem
+
+void test_error_messages() {
+  std::cout << "test_error_messages" << std::endl;
+
+  using namespace tem;
+
+  if (!expect_error("name,age\nBart,10\nHomer,abc\n",
+                    "Could not read row 2: Failed to parse field 'age': "
+                    "Could not cast 'abc' to int.")) {
+    return;
+  }
+
+  if (!expect_error("name,age\nBart,10,x\n",
+                    "Could not read row 1: Expected 2 cells, but found 3.")) {
+    return;
+  }
+
+  if (!expect_error("name\nBart\n",
+                    "Could not read row 1: Field named 'age' not found!")) {
+    return;
+  }
+
+  if (!expect_error("name,age\n\"Bart,10\n",
+                    "Could not read row 1: Unterminated quote.")) {
+    return;
+  }
+
+  std::cout << "OK" << std::endl << std::endl;
+}
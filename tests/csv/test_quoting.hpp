@@ -0,0 +1,73 @@
+#include <iostream>
+#include <rfl.hpp>
+#include <rfl/csv.hpp>
+#include <string>
+#include <vector>
+
+namespace tq {
+
+struct Row {
+  rfl::Field<"id", int> id;
+  rfl::Field<"text", std::string> text;
+};
+
+}  // namespace tq
+
+void test_quoting() {
+  std::cout << "test_quoting" << std::endl;
+
+  using tq::Row;
+
+  // Large enough to cross the boundaries of the chunks read from the stream.
+  auto rows = std::vector<Row>();
+  for (int i = 0; i < 20000; ++i) {
+    switch (i % 4) {
+      case 0:
+        rows.push_back(Row{.id = i, .text = "plain text"});
+        break;
+      case 1:
+        rows.push_back(Row{.id = i, .text = "with, comma"});
+        break;
+      case 2:
+        rows.push_back(Row{.id = i, .text = "with \"quotes\""});
+        break;
+      default:
+        rows.push_back(Row{.id = i, .text = "with\nline break"});
+        break;
+    }
+  }
+
+  const auto rows2 = rfl::csv::read<Row>(rfl::csv::write(rows));
+
+  if (!rows2) {
+    std::cout << "Test failed on read. Error: " << rows2.error().value().what()
+              << std::endl
+              << std::endl;
+    return;
+  }
+
+  if (rfl::csv::write(*rows2) != rfl::csv::write(rows)) {
+    std::cout << "Test failed. Content was not identical." << std::endl
+              << std::endl;
+    return;
+  }
+
+  // Windows line endings, blank lines, reordered and unknown columns and a
+  // custom delimiter.
+  const auto csv_str = std::string(
+      "extra;text;id\r\n"
+      "x;\"a;b\";1\r\n"
+      "\r\n"
+      "y;\"say \"\"hi\"\"\";2");
+
+  const auto rows3 =
+      rfl::csv::read<Row>(csv_str, rfl::csv::Settings{.delimiter_ = ';'});
+
+  if (!rows3 || (*rows3).size() != 2 || (*rows3)[0].text() != "a;b" ||
+      (*rows3)[1].id() != 2 || (*rows3)[1].text() != "say \"hi\"") {
+    std::cout << "Test failed on custom delimiter." << std::endl << std::endl;
+    return;
+  }
+
+  std::cout << "OK" << std::endl << std::endl;
+}
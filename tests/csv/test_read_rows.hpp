@@ -0,0 +1,48 @@
+#include <iostream>
+#include <rfl.hpp>
+#include <rfl/csv.hpp>
+#include <sstream>
+#include <string>
+
+void test_read_rows() {
+  std::cout << "test_read_rows" << std::endl;
+
+  struct Measurement {
+    rfl::Field<"sensor", rfl::Literal<"a", "b">> sensor;
+    rfl::Field<"value", double> value;
+  };
+
+  auto stream = std::stringstream();
+  stream << "sensor,value\n";
+  for (int i = 0; i < 100000; ++i) {
+    stream << (i % 2 == 0 ? "a" : "b") << "," << i << ".5\n";
+  }
+
+  size_t count = 0;
+  double sum = 0.0;
+
+  const auto res = rfl::csv::read_rows<Measurement>(
+      stream, [&](Measurement&& _m) {
+        ++count;
+        if (_m.sensor().value() == 0) {
+          sum += _m.value();
+        }
+      });
+
+  if (!res) {
+    std::cout << "Test failed. Error: " << res.error().value().what()
+              << std::endl
+              << std::endl;
+    return;
+  }
+
+  if (count != 100000 || sum != 2499975000.0) {
+    std::cout << "Test failed. Expected 100000 rows and a sum of "
+                 "2499975000, got "
+              << count << " rows and a sum of " << sum << "." << std::endl
+              << std::endl;
+    return;
+  }
+
+  std::cout << "OK" << std::endl << std::endl;
+}
@@ -0,0 +1,95 @@
+#include <iostream>
+#include <optional>
+#include <rfl.hpp>
+#include <rfl/csv.hpp>
+#include <string>
+#include <vector>
+
+void test_save_load() {
+  std::cout << "test_save_load" << std::endl;
+
+  struct Person {
+    rfl::Field<"firstName", std::string> first_name;
+    rfl::Field<"lastName", rfl::Literal<"Simpson", "Flanders">> last_name;
+    rfl::Field<"birthday", rfl::Timestamp<"%Y-%m-%d">> birthday;
+    rfl::Field<"age",
+               rfl::Validator<unsigned int,
+                              rfl::AllOf<rfl::Minimum<0>, rfl::Maximum<130>>>>
+        age;
+    rfl::Field<"height", double> height;
+    rfl::Field<"isChild", bool> is_child;
+    rfl::Field<"nickname", std::optional<std::string>> nickname;
+  };
+
+  const auto people = std::vector<Person>(
+      {Person{.first_name = "Homer",
+              .last_name = rfl::Literal<"Simpson", "Flanders">::
+                  make<"Simpson">(),
+              .birthday = "1956-05-12",
+              .age = 45,
+              .height = 1.8,
+              .is_child = false,
+              .nickname = std::nullopt},
+       Person{.first_name = "Bart",
+              .last_name = rfl::Literal<"Simpson", "Flanders">::
+                  make<"Simpson">(),
+              .birthday = "1987-04-19",
+              .age = 10,
+              .height = 1.2,
+              .is_child = true,
+              .nickname = "El Barto"},
+       Person{.first_name = "Ned",
+              .last_name = rfl::Literal<"Simpson", "Flanders">::
+                  make<"Flanders">(),
+              .birthday = "1950-01-01",
+              .age = 60,
+              .height = 1.75,
+              .is_child = false,
+              .nickname = ""}});
+
+  const auto expected = std::string(
+      R"(firstName,lastName,birthday,age,height,isChild,nickname
+Homer,Simpson,1956-05-12,45,1.8,false,
+Bart,Simpson,1987-04-19,10,1.2,true,El Barto
+Ned,Flanders,1950-01-01,60,1.75,false,""
+)");
+
+  const auto csv_str = rfl::csv::write(people);
+
+  if (csv_str != expected) {
+    std::cout << "Test failed on write. Expected:" << std::endl
+              << expected << std::endl
+              << "Got:" << std::endl
+              << csv_str << std::endl
+              << std::endl;
+    return;
+  }
+
+  rfl::csv::save("people.csv", people);
+
+  const auto people2 = rfl::csv::load<Person>("people.csv");
+
+  if (!people2) {
+    std::cout << "Test failed on load. Error: "
+              << people2.error().value().what() << std::endl
+              << std::endl;
+    return;
+  }
+
+  if (rfl::csv::write(*people2) != expected) {
+    std::cout << "Test failed. Content was not identical." << std::endl
+              << std::endl;
+    return;
+  }
+
+  if ((*people2)[0].nickname() || !(*people2)[2].nickname() ||
+      *(*people2)[2].nickname() != "") {
+    std::cout << "Test failed. Empty strings and missing values were "
+                 "confused."
+              << std::endl
+              << std::endl;
+    return;
+  }
+
+  std::cout << "OK" << std::endl << std::endl;
+}
@@ -0,0 +1,13 @@
+#include "test_error_messages.hpp"
+#include "test_quoting.hpp"
+#include "test_read_rows.hpp"
+#include "test_save_load.hpp"
+
+int main() {
+  test_save_load();
+  test_quoting();
+  test_read_rows();
+  test_error_messages();
+
+  return 0;
+}
@@ -0,0 +1,55 @@
+#include <flatbuffers/flexbuffers.h>
+
+#include <iostream>
+#include <rfl.hpp>
+#include <rfl/flexbuf.hpp>
+#include <string>
+#include <vector>
+
+void test_builder() {
+  std::cout << "test_builder" << std::endl;
+
+  struct Person {
+    rfl::Field<"firstName", std::string> first_name;
+    rfl::Field<"lastName", std::string> last_name;
+    rfl::Field<"age", int> age;
+  };
+
+  auto people = std::vector<Person>();
+  for (int i = 0; i < 100; ++i) {
+    people.push_back(
+        Person{.first_name = "Bart", .last_name = "Simpson", .age = i});
+  }
+
+  flexbuffers::Builder fbb;
+
+  for (const auto& person : {people[0], people[1]}) {
+    const auto& buffer = rfl::flexbuf::write(person, &fbb);
+    const auto bytes = rfl::flexbuf::write(person);
+    if (std::vector<unsigned char>(buffer.begin(), buffer.end()) != bytes) {
+      std::cout << "Test failed. Reusing the builder changed the output."
+                << std::endl
+                << std::endl;
+      return;
+    }
+  }
+
+  const auto shared = rfl::flexbuf::write(
+      people, flexbuffers::BUILDER_FLAG_SHARE_KEYS_AND_STRINGS);
+
+  if (shared.size() >= rfl::flexbuf::write(people).size()) {
+    std::cout << "Test failed. Sharing strings did not reduce the size."
+              << std::endl
+              << std::endl;
+    return;
+  }
+
+  const auto res = rfl::flexbuf::read<std::vector<Person>>(shared);
+
+  if (!res || (*res).size() != 100 || (*res)[99].age() != 99) {
+    std::cout << "Test failed on read." << std::endl << std::endl;
+    return;
+  }
+
+  std::cout << "OK" << std::endl << std::endl;
+}
@@ -0,0 +1,48 @@
+#include <iostream>
+#include <optional>
+#include <rfl.hpp>
+#include <rfl/flexbuf.hpp>
+#include <string>
+
+void test_field_order() {
+  std::cout << "test_field_order" << std::endl;
+
+  struct Written {
+    rfl::Field<"zebra", int> zebra;
+    rfl::Field<"apple", std::string> apple;
+    rfl::Field<"mango", double> mango;
+    rfl::Field<"app", int> app;
+    rfl::Field<"banana", bool> banana;
+  };
+
+  struct Read {
+    rfl::Field<"mango", double> mango;
+    rfl::Field<"apple", std::string> apple;
+    rfl::Field<"zebra", int> zebra;
+    rfl::Field<"cherry", std::optional<int>> cherry;
+  };
+
+  const auto written = Written{
+      .zebra = 26, .apple = "red", .mango = 1.5, .app = 3, .banana = true};
+
+  const auto res = rfl::flexbuf::read<Read>(rfl::flexbuf::write(written));
+
+  if (!res) {
+    std::cout << "Test failed on read. Error: " << res.error().value().what()
+              << std::endl
+              << std::endl;
+    return;
+  }
+
+  const auto& read = *res;
+
+  if (read.mango() != 1.5 || read.apple() != "red" || read.zebra() != 26 ||
+      read.cherry()) {
+    std::cout << "Test failed. The fields were not matched correctly."
+              << std::endl
+              << std::endl;
+    return;
+  }
+
+  std::cout << "OK" << std::endl << std::endl;
+}
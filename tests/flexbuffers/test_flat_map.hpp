@@ -0,0 +1,23 @@
+#include <iostream>
+#include <rfl.hpp>
+#include <rfl/flexbuf.hpp>
+#include <string>
+
+#include "write_and_read.hpp"
+
+void test_flat_map() {
+  std::cout << "test_flat_map" << std::endl;
+
+  struct Config {
+    rfl::Field<"limits", rfl::FlatMap<std::string, int>> limits;
+    rfl::Field<"hosts", rfl::FlatMap<int, std::string>> hosts;
+  };
+
+  const auto config =
+      Config{.limits = rfl::FlatMap<std::string, int>{{"requests", 100},
+                                                      {"connections", 10}},
+             .hosts = rfl::FlatMap<int, std::string>{{3, "gamma"},
+                                                     {1, "alpha"}}};
+
+  write_and_read(config);
+}
@@ -0,0 +1,61 @@
+#include <cstddef>
+#include <iostream>
+#include <memory_resource>
+#include <rfl.hpp>
+#include <rfl/flexbuf.hpp>
+#include <string>
+#include <vector>
+
+namespace tmrf {
+
+struct Layer {
+  rfl::Field<"name", std::pmr::string> name;
+  rfl::Field<"weights", std::pmr::vector<float>> weights;
+  rfl::Field<"tags", std::pmr::vector<std::pmr::string>> tags;
+};
+
+}  // namespace tmrf
+
+void test_memory_resource() {
+  std::cout << "test_memory_resource" << std::endl;
+
+  auto layer = tmrf::Layer{.name = "a layer with a rather long name",
+                           .weights = std::pmr::vector<float>(),
+                           .tags = std::pmr::vector<std::pmr::string>()};
+  for (int i = 0; i < 100; ++i) {
+    layer.weights().push_back(static_cast<float>(i) * 0.5f);
+  }
+  layer.tags().emplace_back("a tag that is too long to fit into the string");
+
+  const auto bytes1 = rfl::flexbuf::write(layer);
+
+  // The upstream resource fails on any allocation, so this only works if
+  // everything fits into the buffer.
+  std::byte buffer[4096];
+  auto arena = std::pmr::monotonic_buffer_resource(
+      buffer, sizeof(buffer), std::pmr::null_memory_resource());
+
+  const auto res = rfl::flexbuf::read<tmrf::Layer>(bytes1, &arena);
+
+  if (!res) {
+    std::cout << "Failed: " << res.error()->what() << std::endl << std::endl;
+    return;
+  }
+
+  if ((*res).name().get_allocator().resource() != &arena ||
+      (*res).weights().get_allocator().resource() != &arena ||
+      (*res).tags().at(0).get_allocator().resource() != &arena) {
+    std::cout << "Failed: Not everything was allocated from the arena."
+              << std::endl
+              << std::endl;
+    return;
+  }
+
+  if (rfl::flexbuf::write(*res) != bytes1) {
+    std::cout << "Failed: Content was not identical." << std::endl
+              << std::endl;
+    return;
+  }
+
+  std::cout << "OK" << std::endl << std::endl;
+}
@@ -0,0 +1,110 @@
+#include <cstdint>
+#include <deque>
+#include <iostream>
+#include <rfl.hpp>
+#include <rfl/flexbuf.hpp>
+#include <string>
+#include <vector>
+
+namespace tnv {
+
+struct Snapshot {
+  std::string name;
+  std::vector<float> weights;
+  std::vector<std::int64_t> offsets;
+  std::vector<std::uint8_t> mask;
+  std::vector<double> empty;
+};
+
+struct Weights {
+  std::string name;
+  std::vector<float> weights;
+};
+
+struct LegacyWeights {
+  std::string name;
+  std::deque<float> weights;
+};
+
+struct Layer {
+  rfl::Field<"name", std::string> name;
+  rfl::Field<"weights", std::vector<float>> weights;
+};
+
+}  // namespace tnv
+
+void test_numeric_vectors() {
+  std::cout << "test_numeric_vectors" << std::endl;
+
+  auto snapshot = tnv::Snapshot{.name = "layer1"};
+  for (int i = 0; i < 1000; ++i) {
+    snapshot.weights.push_back(static_cast<float>(i) * 0.5f);
+    snapshot.offsets.push_back(static_cast<std::int64_t>(i) * -100000000);
+    snapshot.mask.push_back(static_cast<std::uint8_t>(i % 256));
+  }
+
+  const auto bytes = rfl::flexbuf::write(snapshot);
+
+  if (bytes.size() >= 1000 * (sizeof(float) + sizeof(std::int64_t) + 2)) {
+    std::cout << "Test failed. Numeric vectors were not stored compactly."
+              << std::endl
+              << std::endl;
+    return;
+  }
+
+  const auto res = rfl::flexbuf::read<tnv::Snapshot>(bytes);
+
+  if (!res) {
+    std::cout << "Test failed on read. Error: " << res.error().value().what()
+              << std::endl
+              << std::endl;
+    return;
+  }
+
+  if ((*res).weights != snapshot.weights ||
+      (*res).offsets != snapshot.offsets || (*res).mask != snapshot.mask ||
+      !(*res).empty.empty()) {
+    std::cout << "Test failed on read. Content was not identical." << std::endl
+              << std::endl;
+    return;
+  }
+
+  auto target = tnv::Snapshot{.weights = std::vector<float>(5000, 1.0f)};
+  const auto capacity = target.weights.capacity();
+
+  const auto into = rfl::flexbuf::read_into(target, bytes);
+
+  if (!into || target.weights != snapshot.weights ||
+      target.weights.capacity() != capacity) {
+    std::cout << "Test failed on read_into." << std::endl << std::endl;
+    return;
+  }
+
+  const auto layer =
+      tnv::Layer{.name = "layer1", .weights = snapshot.weights};
+  const auto layer_bytes = rfl::flexbuf::write(layer);
+
+  const auto weights =
+      rfl::flexbuf::View<tnv::Layer>::from_bytes(layer_bytes)
+          .and_then([](const auto& _v) { return _v.template get<"weights">(); });
+
+  if (!weights || *weights != snapshot.weights) {
+    std::cout << "Test failed on view." << std::endl << std::endl;
+    return;
+  }
+
+  const auto legacy = tnv::LegacyWeights{.name = "layer1",
+                                          .weights = {1.0f, 2.0f, 3.0f}};
+
+  const auto from_legacy =
+      rfl::flexbuf::read<tnv::Weights>(rfl::flexbuf::write(legacy));
+
+  if (!from_legacy ||
+      (*from_legacy).weights != std::vector<float>({1.0f, 2.0f, 3.0f})) {
+    std::cout << "Test failed. Untyped vectors could not be read." << std::endl
+              << std::endl;
+    return;
+  }
+
+  std::cout << "OK" << std::endl << std::endl;
+}
@@ -0,0 +1,28 @@
+#include <cstdint>
+#include <iostream>
+#include <map>
+#include <rfl.hpp>
+#include <rfl/flexbuf.hpp>
+#include <string>
+
+#include "write_and_read.hpp"
+
+void test_object_map() {
+  std::cout << "test_object_map" << std::endl;
+
+  using Color = rfl::Literal<"red", "green", "blue">;
+
+  struct Tables {
+    rfl::Field<"users", rfl::ObjectMap<std::map<std::int64_t, std::string>>>
+        users;
+    rfl::Field<"counts", rfl::ObjectMap<std::map<Color, int>>> counts;
+  };
+
+  const auto tables = Tables{
+      .users = std::map<std::int64_t, std::string>{{-7, "root"},
+                                                   {42, "homer"}},
+      .counts = std::map<Color, int>{{Color::make<"red">(), 1},
+                                     {Color::make<"blue">(), 3}}};
+
+  write_and_read(tables);
+}
@@ -0,0 +1,52 @@
+#include <iostream>
+#include <map>
+#include <optional>
+#include <rfl.hpp>
+#include <rfl/flexbuf.hpp>
+#include <string>
+#include <vector>
+
+void test_read_into() {
+  std::cout << "test_read_into" << std::endl;
+
+  struct Person {
+    rfl::Field<"firstName", std::string> first_name;
+    rfl::Field<"lastName", std::string> last_name;
+    rfl::Field<"nickname", std::optional<std::string>> nickname;
+    rfl::Field<"scores", std::map<std::string, int>> scores;
+  };
+
+  auto person = Person{.first_name = "Homer",
+                       .last_name = "Simpson",
+                       .nickname = "Homie",
+                       .scores = std::map<std::string, int>(
+                           {{"bowling", 10}, {"work", 1}})};
+
+  const auto marge = Person{.first_name = "Marge",
+                            .last_name = "Simpson",
+                            .nickname = std::nullopt,
+                            .scores = std::map<std::string, int>(
+                                {{"bowling", 3}, {"cooking", 10}})};
+
+  const auto bytes1 = rfl::flexbuf::write(marge);
+
+  const auto res = rfl::flexbuf::read_into(person, bytes1);
+
+  if (!res) {
+    std::cout << "Test failed on read_into. Error: "
+              << res.error().value().what() << std::endl
+              << std::endl;
+    return;
+  }
+
+  const auto bytes2 = rfl::flexbuf::write(person);
+
+  if (bytes1 != bytes2) {
+    std::cout << "Test failed on read_into. Content was not identical."
+              << std::endl
+              << std::endl;
+    return;
+  }
+
+  std::cout << "OK" << std::endl << std::endl;
+}
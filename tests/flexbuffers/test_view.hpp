@@ -0,0 +1,81 @@
+#include <iostream>
+#include <optional>
+#include <rfl.hpp>
+#include <rfl/flexbuf.hpp>
+#include <string>
+#include <vector>
+
+namespace tv {
+
+struct Person {
+  rfl::Field<"firstName", std::string> first_name;
+  rfl::Field<"lastName", std::string> last_name;
+  rfl::Field<"age", int> age;
+  rfl::Field<"nickname", std::optional<std::string>> nickname;
+  rfl::Field<"children", std::vector<Person>> children;
+};
+
+}  // namespace tv
+
+void test_view() {
+  std::cout << "test_view" << std::endl;
+
+  using tv::Person;
+
+  const auto bart = Person{.first_name = "Bart",
+                           .last_name = "Simpson",
+                           .age = 10,
+                           .nickname = "El Barto",
+                           .children = std::vector<Person>()};
+
+  const auto homer = Person{.first_name = "Homer",
+                            .last_name = "Simpson",
+                            .age = 45,
+                            .nickname = std::nullopt,
+                            .children = std::vector<Person>({bart})};
+
+  const auto bytes = rfl::flexbuf::write(homer);
+
+  const auto view = rfl::flexbuf::View<Person>::from_bytes(bytes);
+
+  if (!view) {
+    std::cout << "Test failed. Error: " << view.error().value().what()
+              << std::endl
+              << std::endl;
+    return;
+  }
+
+  const auto& v = *view;
+
+  const auto first_name = v.get<"firstName">();
+  const auto age = v.get<"age">();
+  const auto nickname = v.get<"nickname">();
+
+  if (!first_name || *first_name != "Homer" || !age || *age != 45 ||
+      !nickname || *nickname) {
+    std::cout << "Test failed on the fields of the root." << std::endl
+              << std::endl;
+    return;
+  }
+
+  const auto child_nickname =
+      v.get<"children">()
+          .and_then([](const auto& _children) { return _children.get(0); })
+          .and_then([](const auto& _child) {
+            return _child.template get<"nickname">();
+          });
+
+  if (!child_nickname || !*child_nickname || **child_nickname != "El Barto") {
+    std::cout << "Test failed on the nested view." << std::endl << std::endl;
+    return;
+  }
+
+  const auto homer2 = v.read();
+
+  if (!homer2 || rfl::flexbuf::write(*homer2) != bytes) {
+    std::cout << "Test failed on read." << std::endl << std::endl;
+    return;
+  }
+
+  std::cout << "OK" << std::endl << std::endl;
+}
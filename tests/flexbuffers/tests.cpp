@@ -1,21 +1,28 @@
 #include "test_all_of.hpp"
 #include "test_anonymous_fields.hpp"
 #include "test_box.hpp"
+#include "test_builder.hpp"
 #include "test_custom_class1.hpp"
 #include "test_custom_class2.hpp"
 #include "test_custom_class3.hpp"
 #include "test_custom_constructor.hpp"
 #include "test_deque.hpp"
+#include "test_field_order.hpp"
 #include "test_field_variant.hpp"
+#include "test_flat_map.hpp"
 #include "test_forward_list.hpp"
 #include "test_list.hpp"
 #include "test_literal.hpp"
 #include "test_map.hpp"
+#include "test_memory_resource.hpp"
 #include "test_monster_example1.hpp"
 #include "test_monster_example2.hpp"
 #include "test_multimap.hpp"
 #include "test_multiset.hpp"
+#include "test_numeric_vectors.hpp"
+#include "test_object_map.hpp"
 #include "test_optional_fields.hpp"
+#include "test_read_into.hpp"
 #include "test_readme_example.hpp"
 #include "test_ref.hpp"
 #include "test_save_load.hpp"
@@ -30,6 +37,7 @@
 #include "test_unordered_multiset.hpp"
 #include "test_unordered_set.hpp"
 #include "test_variant.hpp"
+#include "test_view.hpp"
 
 int main() {
   test_readme_example();
@@ -69,5 +77,20 @@ int main() {
 
   test_save_load();
 
+  test_read_into();
+
+  test_builder();
+
+  test_field_order();
+
+  test_view();
+
+  test_numeric_vectors();
+  test_object_map();
+
+  test_memory_resource();
+
+  test_flat_map();
+
   return 0;
 }
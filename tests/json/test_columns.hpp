@@ -0,0 +1,66 @@
+#include <iostream>
+#include <rfl.hpp>
+#include <rfl/json.hpp>
+#include <string>
+#include <vector>
+
+void test_columns() {
+  std::cout << "test_columns" << std::endl;
+
+  struct Address {
+    rfl::Field<"city", std::string> city;
+  };
+
+  struct Person {
+    rfl::Field<"firstName", std::string> first_name;
+    rfl::Field<"age", int> age;
+    rfl::Flatten<Address> address;
+  };
+
+  const auto people = std::vector<Person>(
+      {Person{.first_name = "Homer",
+              .age = 45,
+              .address = Address{.city = "Springfield"}},
+       Person{.first_name = "Ned",
+              .age = 60,
+              .address = Address{.city = "Springfield"}}});
+
+  const rfl::columns_t<Person> columns = rfl::to_columns(people);
+
+  const std::string expected =
+      R"({"firstName":["Homer","Ned"],"age":[45,60],"city":["Springfield","Springfield"]})";
+
+  const auto json_string = rfl::json::write(columns);
+
+  if (json_string != expected) {
+    std::cout << "Test failed. Expected:" << std::endl
+              << expected << std::endl
+              << "Got:" << std::endl
+              << json_string << std::endl
+              << std::endl;
+    return;
+  }
+
+  const auto people2 = rfl::from_columns<Person>(columns);
+
+  if (!people2 || rfl::json::write(*people2) != rfl::json::write(people)) {
+    std::cout << "Test failed on from_columns." << std::endl << std::endl;
+    return;
+  }
+
+  auto moved_columns = rfl::to_columns(std::vector<Person>(people));
+
+  rfl::get<"age">(moved_columns).pop_back();
+
+  const auto res = rfl::from_columns<Person>(std::move(moved_columns));
+
+  if (res) {
+    std::cout << "Expected an error for columns of different lengths, got "
+                 "none."
+              << std::endl
+              << std::endl;
+    return;
+  }
+
+  std::cout << "OK" << std::endl << std::endl;
+}
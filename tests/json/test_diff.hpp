@@ -0,0 +1,81 @@
+#include <iostream>
+#include <map>
+#include <optional>
+#include <rfl.hpp>
+#include <rfl/json.hpp>
+#include <string>
+#include <vector>
+
+void test_diff() {
+  std::cout << "test_diff" << std::endl;
+
+  struct Address {
+    rfl::Field<"street", std::string> street;
+    rfl::Field<"city", std::string> city;
+  };
+
+  struct Person {
+    rfl::Field<"firstName", std::string> first_name;
+    rfl::Field<"lastName", std::string> last_name;
+    rfl::Field<"nickname", std::optional<std::string>> nickname;
+    rfl::Field<"address", Address> address;
+    rfl::Field<"scores", std::map<std::string, int>> scores;
+    rfl::Field<"children", std::vector<std::string>> children;
+  };
+
+  const auto homer1 = Person{
+      .first_name = "Homer",
+      .last_name = "Simpson",
+      .nickname = "Homie",
+      .address = Address{.street = "742 Evergreen Terrace",
+                         .city = "Springfield"},
+      .scores = std::map<std::string, int>({{"bowling", 10}, {"work", 1}}),
+      .children = std::vector<std::string>({"Bart", "Lisa"})};
+
+  auto homer2 = homer1;
+  homer2.nickname = std::nullopt;
+  homer2.address().city = "Capital City";
+  homer2.scores().erase("work");
+  homer2.scores()["donuts"] = 100;
+  homer2.children().push_back("Maggie");
+
+  const auto patch = rfl::json::diff(homer1, homer2);
+
+  const std::string expected =
+      R"({"nickname":null,"address":{"city":"Capital City"},"scores":{"donuts":100,"work":null},"children":["Bart","Lisa","Maggie"]})";
+
+  if (patch != expected) {
+    std::cout << "Test failed on diff. Expected:" << std::endl
+              << expected << std::endl
+              << "Got:" << std::endl
+              << patch << std::endl
+              << std::endl;
+    return;
+  }
+
+  if (rfl::json::diff(homer2, homer2) != "{}") {
+    std::cout << "Test failed on diff. Expected an empty patch." << std::endl
+              << std::endl;
+    return;
+  }
+
+  auto homer3 = homer1;
+
+  const auto res = rfl::json::apply_patch(homer3, patch);
+
+  if (!res) {
+    std::cout << "Test failed on apply_patch. Error: "
+              << res.error().value().what() << std::endl
+              << std::endl;
+    return;
+  }
+
+  if (rfl::json::write(homer2) != rfl::json::write(homer3)) {
+    std::cout << "Test failed on apply_patch. Content was not identical."
+              << std::endl
+              << std::endl;
+    return;
+  }
+
+  std::cout << "OK" << std::endl << std::endl;
+}
@@ -0,0 +1,125 @@
+#include <yyjson.h>
+
+#include <iostream>
+#include <rfl.hpp>
+#include <rfl/json.hpp>
+#include <string>
+#include <variant>
+
+namespace tdv {
+
+struct Circle {
+  rfl::Field<"kind", rfl::Literal<"Circle">> kind = rfl::default_value;
+  rfl::Field<"radius", double> radius;
+};
+
+struct Rectangle {
+  rfl::Field<"kind", rfl::Literal<"Rectangle">> kind = rfl::default_value;
+  rfl::Field<"width", double> width;
+  rfl::Field<"height", double> height;
+};
+
+using Shape = rfl::TaggedUnion<"kind", Circle, Rectangle>;
+
+struct Drawing {
+  rfl::Field<"name", std::string> name;
+  rfl::Field<"shape", Shape> shape;
+  rfl::Field<"fill", std::variant<Circle, Rectangle>> fill;
+};
+
+/// Applies _patch to _target the way any RFC 7396 implementation would,
+/// using the reference implementation in yyjson.
+std::string merge(const std::string& _target, const std::string& _patch) {
+  yyjson_doc* target = yyjson_read(_target.c_str(), _target.size(), 0);
+  yyjson_doc* patch = yyjson_read(_patch.c_str(), _patch.size(), 0);
+  yyjson_mut_doc* merged = yyjson_mut_doc_new(NULL);
+  yyjson_mut_doc_set_root(
+      merged, yyjson_merge_patch(merged, yyjson_doc_get_root(target),
+                                 yyjson_doc_get_root(patch)));
+  const char* json_c_str = yyjson_mut_write(merged, 0, NULL);
+  const auto json_str = std::string(json_c_str);
+  free((void*)json_c_str);
+  yyjson_mut_doc_free(merged);
+  yyjson_doc_free(patch);
+  yyjson_doc_free(target);
+  return json_str;
+}
+
+/// Whether two JSON strings represent the same value, regardless of the
+/// order of the keys.
+bool equals(const std::string& _json1, const std::string& _json2) {
+  yyjson_doc* doc1 = yyjson_read(_json1.c_str(), _json1.size(), 0);
+  yyjson_doc* doc2 = yyjson_read(_json2.c_str(), _json2.size(), 0);
+  const bool eq =
+      yyjson_equals(yyjson_doc_get_root(doc1), yyjson_doc_get_root(doc2));
+  yyjson_doc_free(doc2);
+  yyjson_doc_free(doc1);
+  return eq;
+}
+
+/// Checks that both a standards-conforming receiver and apply_patch turn
+/// _old into _new.
+bool check(const Drawing& _old, const Drawing& _new) {
+  const auto patch = rfl::json::diff(_old, _new);
+  const auto expected = rfl::json::write(_new);
+
+  // Stale keys would be ignored when reading, so we compare the JSON
+  // itself.
+  const auto merged = merge(rfl::json::write(_old), patch);
+
+  if (!equals(merged, expected)) {
+    std::cout << "Failed: The RFC 7396 merge of " << patch
+              << " produced " << merged << " instead of " << expected << "."
+              << std::endl
+              << std::endl;
+    return false;
+  }
+
+  auto patched = _old;
+  const auto res = rfl::json::apply_patch(patched, patch);
+
+  if (!res || rfl::json::write(patched) != expected) {
+    std::cout << "Failed: apply_patch of " << patch << " did not produce "
+              << expected << "." << std::endl
+              << std::endl;
+    return false;
+  }
+
+  return true;
+}
+
+}  // namespace tdv
+
+void test_diff_variants() {
+  std::cout << "test_diff_variants" << std::endl;
+
+  const auto drawing1 = tdv::Drawing{
+      .name = "sketch",
+      .shape = tdv::Circle{.radius = 2.0},
+      .fill = tdv::Rectangle{.width = 1.0, .height = 3.0}};
+
+  // The alternatives switch, so the old fields must be removed.
+  auto drawing2 = drawing1;
+  drawing2.shape = tdv::Rectangle{.width = 4.0, .height = 5.0};
+  drawing2.fill = tdv::Circle{.radius = 1.0};
+
+  // The alternative stays the same, so the patch only contains the change.
+  auto drawing3 = drawing2;
+  drawing3.shape = tdv::Rectangle{.width = 4.0, .height = 6.0};
+
+  if (!tdv::check(drawing1, drawing2) || !tdv::check(drawing2, drawing3) ||
+      !tdv::check(drawing3, drawing1)) {
+    return;
+  }
+
+  const std::string expected = R"({"shape":{"height":6.0}})";
+
+  if (rfl::json::diff(drawing2, drawing3) != expected) {
+    std::cout << "Failed: Expected " << expected << ", got "
+              << rfl::json::diff(drawing2, drawing3) << "." << std::endl
+              << std::endl;
+    return;
+  }
+
+  std::cout << "OK" << std::endl << std::endl;
+}
@@ -0,0 +1,84 @@
+#include <iostream>
+#include <optional>
+#include <rfl.hpp>
+#include <rfl/json.hpp>
+#include <string>
+#include <vector>
+
+namespace tdr {
+
+inline int num_moves = 0;
+
+/// A custom class that counts how often it is moved.
+struct Age {
+  using ReflectionType = int;
+
+  Age() noexcept = default;
+  Age(int _value) : value(_value) {}
+  Age(const Age& _other) = default;
+  Age(Age&& _other) noexcept : value(_other.value) { ++num_moves; }
+  Age& operator=(const Age& _other) = default;
+  Age& operator=(Age&& _other) noexcept = default;
+
+  int reflection() const { return value; }
+
+  int value = 0;
+};
+
+struct Person {
+  rfl::Field<"firstName", std::string> first_name;
+  rfl::Field<"age", Age> age;
+  rfl::Field<"nickname", std::optional<std::string>> nickname;
+  rfl::Field<"children", std::vector<Person>> children;
+};
+
+}  // namespace tdr
+
+void test_direct_read() {
+  std::cout << "test_direct_read" << std::endl;
+
+  const auto homer = rfl::json::read<tdr::Person>(
+      R"({"firstName":"Homer","age":45,"children":[]})");
+
+  // The age is constructed inside the result of its parser, moved into the
+  // struct and moved again when the struct is returned.
+  if (!homer || tdr::num_moves != 2) {
+    std::cout << "Failed: Expected 2 moves, got " << tdr::num_moves << "."
+              << std::endl
+              << std::endl;
+    return;
+  }
+
+  const auto marge = rfl::json::read<tdr::Person>(
+      R"({"firstName":"Marge","age":42,"children":[{"firstName":"Bart",)"
+      R"("age":10,"nickname":"El Barto","children":[]}]})");
+
+  if (!marge) {
+    std::cout << "Failed: " << marge.error()->what() << std::endl << std::endl;
+    return;
+  }
+
+  const auto& bart = (*marge).children().at(0);
+
+  if ((*marge).first_name() != "Marge" || (*marge).age().value != 42 ||
+      (*marge).nickname() || bart.nickname() != "El Barto" ||
+      bart.age().value != 10) {
+    std::cout << "Failed: Unexpected values." << std::endl << std::endl;
+    return;
+  }
+
+  const auto faulty =
+      rfl::json::read<tdr::Person>(R"({"firstName":1,"children":[]})");
+
+  const std::string expected = R"(Found 2 errors:
+1) Failed to parse field 'firstName': Could not cast to string.
+2) Field named 'age' not found.)";
+
+  if (!faulty.error() || faulty.error()->what() != expected) {
+    std::cout << "Failed: Expected '" << expected << "'." << std::endl
+              << std::endl;
+    return;
+  }
+
+  std::cout << "OK" << std::endl << std::endl;
+}
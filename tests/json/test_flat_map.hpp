@@ -0,0 +1,49 @@
+#include <iostream>
+#include <rfl.hpp>
+#include <rfl/json.hpp>
+#include <string>
+
+namespace tfm {
+
+struct Config {
+  rfl::Field<"limits", rfl::FlatMap<std::string, int>> limits;
+  rfl::Field<"hosts", rfl::FlatMap<int, std::string>> hosts;
+};
+
+}  // namespace tfm
+
+void test_flat_map() {
+  std::cout << "test_flat_map" << std::endl;
+
+  // The entries are unsorted and one key is duplicated. Just like std::map,
+  // the FlatMap keeps the first entry.
+  const auto res = rfl::json::read<tfm::Config>(
+      R"({"limits":{"requests":100,"connections":10,"requests":5},)"
+      R"("hosts":[[3,"gamma"],[1,"alpha"],[2,"beta"]]})");
+
+  if (!res) {
+    std::cout << "Failed: " << res.error()->what() << std::endl << std::endl;
+    return;
+  }
+
+  const auto& config = *res;
+
+  if (config.limits().size() != 2 || config.limits().at("requests") != 100 ||
+      config.hosts().at(2) != "beta" || config.hosts().contains(4)) {
+    std::cout << "Failed: Unexpected values." << std::endl << std::endl;
+    return;
+  }
+
+  const std::string expected =
+      R"({"limits":{"connections":10,"requests":100},)"
+      R"("hosts":[[1,"alpha"],[2,"beta"],[3,"gamma"]]})";
+
+  if (rfl::json::write(config) != expected) {
+    std::cout << "Failed: Expected '" << expected << "', got '"
+              << rfl::json::write(config) << "'." << std::endl
+              << std::endl;
+    return;
+  }
+
+  std::cout << "OK" << std::endl << std::endl;
+}
@@ -0,0 +1,83 @@
+#include <iostream>
+#include <map>
+#include <optional>
+#include <rfl.hpp>
+#include <string>
+#include <unordered_set>
+#include <vector>
+
+void test_hash() {
+  std::cout << "test_hash" << std::endl;
+
+  struct Person {
+    rfl::Field<"firstName", std::string> first_name;
+    rfl::Field<"lastName", rfl::Literal<"Simpson", "Flanders">> last_name;
+    rfl::Field<"age", rfl::Validator<int, rfl::Minimum<0>>> age;
+    rfl::Field<"scores", std::vector<int>> scores;
+    rfl::Field<"height", double> height;
+    rfl::Field<"pets", std::map<std::string, std::string>> pets;
+    rfl::Field<"nickname", std::optional<std::string>> nickname;
+    rfl::Field<"child", std::variant<int, rfl::Ref<Person>>> child;
+  };
+
+  const auto bart = Person{.first_name = "Bart",
+                           .last_name = rfl::Literal<"Simpson", "Flanders">::
+                               make<"Simpson">(),
+                           .age = 10,
+                           .scores = std::vector<int>({1, 2, 3}),
+                           .height = 0.0,
+                           .pets = std::map<std::string, std::string>(
+                               {{"dog", "Santa's Little Helper"}}),
+                           .nickname = std::nullopt,
+                           .child = 0};
+
+  auto homer1 = Person{.first_name = "Homer",
+                       .last_name = rfl::Literal<"Simpson", "Flanders">::
+                           make<"Simpson">(),
+                       .age = 45,
+                       .scores = std::vector<int>({4, 5}),
+                       .height = -0.0,
+                       .pets = std::map<std::string, std::string>(),
+                       .nickname = "Homie",
+                       .child = rfl::Ref<Person>::make(bart)};
+
+  auto homer2 = Person{.first_name = "Homer",
+                       .last_name = rfl::Literal<"Simpson", "Flanders">::
+                           make<"Simpson">(),
+                       .age = 45,
+                       .scores = std::vector<int>({4, 5}),
+                       .height = 0.0,
+                       .pets = std::map<std::string, std::string>(),
+                       .nickname = "Homie",
+                       .child = rfl::Ref<Person>::make(bart)};
+
+  if (!rfl::equal(homer1, homer2) || rfl::hash(homer1) != rfl::hash(homer2)) {
+    std::cout << "Test failed. Expected equal objects with equal hashes."
+              << std::endl
+              << std::endl;
+    return;
+  }
+
+  homer2.scores().push_back(6);
+
+  if (rfl::equal(homer1, homer2) || rfl::hash(homer1) == rfl::hash(homer2)) {
+    std::cout << "Test failed. Expected different objects with different "
+                 "hashes."
+              << std::endl
+              << std::endl;
+    return;
+  }
+
+  std::unordered_set<Person, rfl::Hash<Person>, rfl::Equal<Person>> people;
+  people.insert(bart);
+  people.insert(bart);
+
+  if (people.size() != 1) {
+    std::cout << "Test failed. Expected the set to contain one element."
+              << std::endl
+              << std::endl;
+    return;
+  }
+
+  std::cout << "OK" << std::endl << std::endl;
+}
@@ -0,0 +1,91 @@
+#include <iostream>
+#include <rfl.hpp>
+#include <rfl/json.hpp>
+#include <string>
+
+#include "write_and_read.hpp"
+
+namespace tmf {
+
+/// Large enough to exceed the default template instantiation depth, if the
+/// field names were compared recursively.
+struct Wide {
+  rfl::Field<"f1", int> f1;
+  rfl::Field<"f2", int> f2;
+  rfl::Field<"f3", int> f3;
+  rfl::Field<"f4", int> f4;
+  rfl::Field<"f5", int> f5;
+  rfl::Field<"f6", int> f6;
+  rfl::Field<"f7", int> f7;
+  rfl::Field<"f8", int> f8;
+  rfl::Field<"f9", int> f9;
+  rfl::Field<"f10", int> f10;
+  rfl::Field<"f11", int> f11;
+  rfl::Field<"f12", int> f12;
+  rfl::Field<"f13", int> f13;
+  rfl::Field<"f14", int> f14;
+  rfl::Field<"f15", int> f15;
+  rfl::Field<"f16", int> f16;
+  rfl::Field<"f17", int> f17;
+  rfl::Field<"f18", int> f18;
+  rfl::Field<"f19", int> f19;
+  rfl::Field<"f20", int> f20;
+  rfl::Field<"f21", int> f21;
+  rfl::Field<"f22", int> f22;
+  rfl::Field<"f23", int> f23;
+  rfl::Field<"f24", int> f24;
+  rfl::Field<"f25", int> f25;
+  rfl::Field<"f26", int> f26;
+  rfl::Field<"f27", int> f27;
+  rfl::Field<"f28", int> f28;
+  rfl::Field<"f29", int> f29;
+  rfl::Field<"f30", int> f30;
+  rfl::Field<"f31", int> f31;
+  rfl::Field<"f32", int> f32;
+  rfl::Field<"f33", int> f33;
+  rfl::Field<"f34", int> f34;
+  rfl::Field<"f35", int> f35;
+  rfl::Field<"f36", int> f36;
+  rfl::Field<"f37", int> f37;
+  rfl::Field<"f38", int> f38;
+  rfl::Field<"f39", int> f39;
+  rfl::Field<"f40", int> f40;
+  rfl::Field<"f41", int> f41;
+  rfl::Field<"f42", int> f42;
+  rfl::Field<"f43", int> f43;
+  rfl::Field<"f44", int> f44;
+  rfl::Field<"f45", int> f45;
+  rfl::Field<"f46", int> f46;
+  rfl::Field<"f47", int> f47;
+  rfl::Field<"f48", int> f48;
+  rfl::Field<"f49", int> f49;
+  rfl::Field<"f50", int> f50;
+};
+
+}  // namespace tmf
+
+void test_many_fields() {
+  std::cout << "test_many_fields" << std::endl;
+
+  static_assert(rfl::internal::num_fields<tmf::Wide> == 50);
+
+  const auto wide = tmf::Wide{
+      .f1 = 1, .f2 = 2, .f3 = 3, .f4 = 4, .f5 = 5, .f6 = 6, .f7 = 7, .f8 = 8,
+      .f9 = 9, .f10 = 10, .f11 = 11, .f12 = 12, .f13 = 13, .f14 = 14,
+      .f15 = 15, .f16 = 16, .f17 = 17, .f18 = 18, .f19 = 19, .f20 = 20,
+      .f21 = 21, .f22 = 22, .f23 = 23, .f24 = 24, .f25 = 25, .f26 = 26,
+      .f27 = 27, .f28 = 28, .f29 = 29, .f30 = 30, .f31 = 31, .f32 = 32,
+      .f33 = 33, .f34 = 34, .f35 = 35, .f36 = 36, .f37 = 37, .f38 = 38,
+      .f39 = 39, .f40 = 40, .f41 = 41, .f42 = 42, .f43 = 43, .f44 = 44,
+      .f45 = 45, .f46 = 46, .f47 = 47, .f48 = 48, .f49 = 49, .f50 = 50};
+
+  write_and_read(
+      wide,
+      R"({"f1":1,"f2":2,"f3":3,"f4":4,"f5":5,"f6":6,"f7":7,"f8":8,"f9":9,)"
+      R"("f10":10,"f11":11,"f12":12,"f13":13,"f14":14,"f15":15,"f16":16,)"
+      R"("f17":17,"f18":18,"f19":19,"f20":20,"f21":21,"f22":22,"f23":23,)"
+      R"("f24":24,"f25":25,"f26":26,"f27":27,"f28":28,"f29":29,"f30":30,)"
+      R"("f31":31,"f32":32,"f33":33,"f34":34,"f35":35,"f36":36,"f37":37,)"
+      R"("f38":38,"f39":39,"f40":40,"f41":41,"f42":42,"f43":43,"f44":44,)"
+      R"("f45":45,"f46":46,"f47":47,"f48":48,"f49":49,"f50":50})");
+}
@@ -0,0 +1,69 @@
+#include <cstddef>
+#include <iostream>
+#include <map>
+#include <memory_resource>
+#include <rfl.hpp>
+#include <rfl/json.hpp>
+#include <string>
+#include <vector>
+
+namespace tmr {
+
+struct Person {
+  rfl::Field<"firstName", std::pmr::string> first_name;
+  rfl::Field<"nicknames", std::pmr::vector<std::pmr::string>> nicknames;
+  rfl::Field<"scores", std::pmr::map<std::pmr::string, int>> scores;
+  rfl::Field<"children", std::pmr::vector<Person>> children;
+};
+
+bool uses(const std::pmr::string& _str, std::pmr::memory_resource* _arena) {
+  return _str.get_allocator().resource() == _arena;
+}
+
+}  // namespace tmr
+
+void test_memory_resource() {
+  std::cout << "test_memory_resource" << std::endl;
+
+  const std::string json_string =
+      R"({"firstName":"Homer Jay Simpson, Safety Inspector",)"
+      R"("nicknames":["Mr. Plow","Max Power, the man with the name"],)"
+      R"("scores":{"bowling, on Tuesday evenings":3},)"
+      R"("children":[{"firstName":"Bartholomew JoJo Simpson",)"
+      R"("nicknames":[],"scores":{},"children":[]}]})";
+
+  // The upstream resource fails on any allocation, so this only works if
+  // everything fits into the buffer.
+  std::byte buffer[8192];
+  auto arena = std::pmr::monotonic_buffer_resource(
+      buffer, sizeof(buffer), std::pmr::null_memory_resource());
+
+  const auto res = rfl::json::read<tmr::Person>(json_string, &arena);
+
+  if (!res) {
+    std::cout << "Failed: " << res.error()->what() << std::endl << std::endl;
+    return;
+  }
+
+  const auto& homer = *res;
+
+  if (!tmr::uses(homer.first_name(), &arena) ||
+      !tmr::uses(homer.nicknames().at(1), &arena) ||
+      !tmr::uses(homer.scores().begin()->first, &arena) ||
+      !tmr::uses(homer.children().at(0).first_name(), &arena) ||
+      homer.children().get_allocator().resource() != &arena) {
+    std::cout << "Failed: Not everything was allocated from the arena."
+              << std::endl
+              << std::endl;
+    return;
+  }
+
+  if (rfl::json::write(homer) != json_string) {
+    std::cout << "Failed: Expected '" << json_string << "', got '"
+              << rfl::json::write(homer) << "'." << std::endl
+              << std::endl;
+    return;
+  }
+
+  std::cout << "OK" << std::endl << std::endl;
+}
@@ -0,0 +1,82 @@
+#include <cstdint>
+#include <iostream>
+#include <map>
+#include <rfl.hpp>
+#include <rfl/json.hpp>
+#include <string>
+#include <unordered_map>
+
+namespace tom {
+
+using Color = rfl::Literal<"red", "green", "blue">;
+
+struct Tables {
+  rfl::Field<"users", rfl::ObjectMap<std::map<int, std::string>>> users;
+  rfl::Field<"counts", rfl::ObjectMap<std::map<Color, int>>> counts;
+};
+
+}  // namespace tom
+
+void test_object_map() {
+  std::cout << "test_object_map" << std::endl;
+
+  const auto tables = tom::Tables{
+      .users = std::map<int, std::string>{{-7, "root"}, {42, "homer"}},
+      .counts = std::map<tom::Color, int>{
+          {tom::Color::make<"red">(), 1}, {tom::Color::make<"blue">(), 3}}};
+
+  const std::string expected =
+      R"({"users":{"-7":"root","42":"homer"},"counts":{"red":1,"blue":3}})";
+
+  const auto json_string = rfl::json::write(tables);
+
+  if (json_string != expected) {
+    std::cout << "Failed: Expected '" << expected << "', got '"
+              << json_string << "'." << std::endl
+              << std::endl;
+    return;
+  }
+
+  const auto res = rfl::json::read<tom::Tables>(json_string);
+
+  if (!res) {
+    std::cout << "Failed: " << res.error()->what() << std::endl << std::endl;
+    return;
+  }
+
+  if (!rfl::equal(*res, tables)) {
+    std::cout << "Failed: Round trip changed the values." << std::endl
+              << std::endl;
+    return;
+  }
+
+  const auto unordered =
+      rfl::json::read<rfl::ObjectMap<std::unordered_map<std::uint64_t, int>>>(
+          R"({"18446744073709551615":1,"0":2})");
+
+  if (!unordered || (*unordered)().size() != 2) {
+    std::cout << "Failed: Could not read unordered map." << std::endl
+              << std::endl;
+    return;
+  }
+
+  // Keys that are not integers or exceed the range of the key type are
+  // rejected.
+  for (const auto bad : {R"({"1x":1})", R"({"":1})", R"({"300":1})"}) {
+    if (rfl::json::read<rfl::ObjectMap<std::map<std::uint8_t, int>>>(bad)) {
+      std::cout << "Failed: Expected an error for " << bad << "." << std::endl
+                << std::endl;
+      return;
+    }
+  }
+
+  if (rfl::json::read<rfl::ObjectMap<std::map<tom::Color, int>>>(
+          R"({"purple":1})")) {
+    std::cout << "Failed: Expected an error for an unknown literal."
+              << std::endl
+              << std::endl;
+    return;
+  }
+
+  std::cout << "OK" << std::endl << std::endl;
+}
@@ -0,0 +1,44 @@
+#include <iostream>
+#include <rfl.hpp>
+#include <rfl/json.hpp>
+#include <string>
+#include <vector>
+
+#include "write_and_read.hpp"
+
+void test_pattern() {
+  std::cout << "test_pattern" << std::endl;
+
+  using TableName = rfl::Pattern<R"(^[A-Z]+(?:_[A-Z]+)*$)", "TableName">;
+
+  // Backreferences are not supported by the DFA, so this uses std::regex.
+  using Repeated = rfl::Pattern<R"(^(ab|cd)\1$)", "Repeated">;
+
+  struct Table {
+    rfl::Field<"id", rfl::UUIDv4> id;
+    rfl::Field<"name", TableName> name;
+    rfl::Field<"tag", Repeated> tag;
+  };
+
+  for (const auto str : {"", "_", "PEOPLE_", "PEOPLE__TABLE", "people"}) {
+    if (TableName::from_value(str)) {
+      std::cout << "Failed: Expected an error for '" << str << "'."
+                << std::endl;
+      return;
+    }
+  }
+
+  if (Repeated::from_value("abcd") ||
+      rfl::UUIDv4::from_value("123e4567-e89b-12d3-a456-426614174000")) {
+    std::cout << "Failed: Expected an error." << std::endl;
+    return;
+  }
+
+  const auto table = Table{.id = "123e4567-e89b-42d3-a456-426614174000",
+                           .name = "PEOPLE_TABLE",
+                           .tag = "cdcd"};
+
+  write_and_read(
+      table,
+      R"({"id":"123e4567-e89b-42d3-a456-426614174000","name":"PEOPLE_TABLE","tag":"cdcd"})");
+}
@@ -0,0 +1,174 @@
+#include <functional>
+#include <iostream>
+#include <regex>
+#include <rfl.hpp>
+#include <rfl/internal/pattern_matchers.hpp>
+#include <rfl/internal/regex/DFA.hpp>
+#include <rfl/internal/regex/Matcher.hpp>
+#include <rfl/internal/regex/NFA.hpp>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace tpm {
+
+/// Calls _f for every string of up to _max_size characters from _alphabet.
+inline bool for_each_string(const std::string& _alphabet,
+                            const size_t _max_size,
+                            const std::function<bool(const std::string&)>& _f) {
+  auto str = std::string();
+  const std::function<bool()> recurse = [&]() {
+    if (!_f(str)) {
+      return false;
+    }
+    if (str.size() == _max_size) {
+      return true;
+    }
+    for (const char c : _alphabet) {
+      str.push_back(c);
+      const bool ok = recurse();
+      str.pop_back();
+      if (!ok) {
+        return false;
+      }
+    }
+    return true;
+  };
+  return recurse();
+}
+
+/// Expects _match to accept exactly the strings std::regex_match accepts for
+/// _regex.
+inline bool agrees_with_std_regex(
+    const std::string& _regex, const std::string& _str,
+    const std::function<bool(std::string_view)>& _match,
+    const std::regex& _std_regex) {
+  const bool expected = std::regex_match(_str, _std_regex);
+  if (_match(_str) != expected) {
+    std::cout << "Failed: '" << _regex << "' on '" << _str << "' should "
+              << (expected ? "" : "not ") << "match." << std::endl;
+    return false;
+  }
+  return true;
+}
+
+/// A regex that must be compiled into a DFA and the characters its inputs
+/// are made of.
+struct Case {
+  std::string regex_;
+  std::string alphabet_;
+  size_t max_size_;
+};
+
+}  // namespace tpm
+
+void test_pattern_matchers() {
+  std::cout << "test_pattern_matchers" << std::endl;
+
+  using namespace rfl::internal;
+
+  const auto cases = std::vector<tpm::Case>(
+      {{R"(a{2})", "ab", 4},
+       {R"(a{2,})", "ab", 5},
+       {R"(a{1,3}b?)", "ab", 5},
+       {R"((ab){0,2}c)", "abc", 6},
+       {R"([^abc]+)", "abcd-", 4},
+       {R"([a-c-]*x)", "abdx-", 4},
+       {R"([^a-c]?[0-2]{2})", "ad013", 4},
+       {R"(\d+\D)", "1a ", 4},
+       {R"(\w*\W)", "a_1-", 4},
+       {R"(\s\S+)", " \tab", 4},
+       {R"([\d\s]+)", "1 a", 4},
+       {R"([^\w]+)", "a_-!", 4},
+       {R"(\x41\x2d+)", "A-a", 4},
+       {R"(a+?b*?c??)", "abc", 5},
+       {R"((?:ab|a)(?:bc|c))", "abc", 5},
+       {R"(x(a|bc|)y)", "abcxy", 5},
+       {R"(^(ab|cd)*$)", "abcd", 6},
+       {R"(^a|b$)", "ab", 3},
+       {R"(a.c)", "abc\n", 4},
+       {R"(\.\+\*\?\(\)\[\]\{\}\|\\)", ".+*?", 4},
+       {R"([.+*?()|])", ".+(a", 2},
+       {R"(\t\n?)", "\t\na", 3}});
+
+  for (const auto& c : cases) {
+    const auto nfa = regex::NFABuilder::build(c.regex_);
+    if (!nfa || !regex::DFA::from_nfa(*nfa)) {
+      std::cout << "Failed: '" << c.regex_ << "' was not compiled into a DFA."
+                << std::endl;
+      return;
+    }
+    const auto matcher = regex::Matcher::make(c.regex_);
+    const auto std_regex = std::regex(c.regex_);
+    const auto match = [&](std::string_view _str) {
+      return matcher->match(_str);
+    };
+    const bool agrees =
+        tpm::for_each_string(c.alphabet_, c.max_size_, [&](const auto& _str) {
+          return tpm::agrees_with_std_regex(c.regex_, _str, match, std_regex);
+        });
+    if (!agrees) {
+      return;
+    }
+  }
+
+  // Backreferences, lookaheads and anchors in the middle of a regex are not
+  // supported by the DFA, so these fall back to std::regex.
+  for (const auto str : {R"((a)\1)", R"(a(?=b)b)", R"(a^b)", R"(a$b)"}) {
+    if (regex::NFABuilder::build(str) || !regex::Matcher::make(str)) {
+      std::cout << "Failed: Expected '" << str << "' to use std::regex."
+                << std::endl;
+      return;
+    }
+  }
+
+  const auto compare = [](const std::string& _regex, const auto& _match,
+                          const std::string& _alphabet,
+                          const size_t _max_size) {
+    const auto std_regex = std::regex(_regex);
+    return tpm::for_each_string(_alphabet, _max_size, [&](const auto& _str) {
+      return tpm::agrees_with_std_regex(_regex, _str, _match, std_regex);
+    });
+  };
+
+  if (!compare(rfl::patterns::base64_encoded.str(), match_base64, "aZ9+/=-",
+               5) ||
+      !compare(rfl::patterns::email.str(), match_email, "a@.-_1%", 7)) {
+    return;
+  }
+
+  // UUIDs are too long to enumerate, so every character of a valid UUID is
+  // replaced in turn.
+  const auto uuid_chars = std::string("0189abfgABFG-z");
+  const auto uuids = std::vector<std::pair<std::string, std::string>>(
+      {{rfl::patterns::uuid_v1.str(), "123e4567-e89b-12d3-a456-426614174000"},
+       {rfl::patterns::uuid_v2.str(), "123e4567-e89b-22d3-B456-426614174000"},
+       {rfl::patterns::uuid_v3.str(), "123E4567-E89B-32D3-9456-42661417400F"},
+       {rfl::patterns::uuid_v4.str(), "123e4567-e89b-42d3-8456-426614174000"}});
+  const auto match_uuids =
+      std::vector<std::function<bool(std::string_view)>>(
+          {match_uuid<'1'>, match_uuid<'2'>, match_uuid<'3'>,
+           match_uuid<'4'>});
+
+  for (size_t i = 0; i < uuids.size(); ++i) {
+    const auto& [regex, valid] = uuids[i];
+    const auto std_regex = std::regex(regex);
+    auto inputs = std::vector<std::string>(
+        {valid, valid.substr(1), valid + "0", "", "-"});
+    for (size_t j = 0; j < valid.size(); ++j) {
+      for (const char c : uuid_chars) {
+        auto str = valid;
+        str[j] = c;
+        inputs.push_back(str);
+      }
+    }
+    for (const auto& str : inputs) {
+      if (!tpm::agrees_with_std_regex(regex, str, match_uuids[i],
+                                      std_regex)) {
+        return;
+      }
+    }
+  }
+
+  std::cout << "OK" << std::endl << std::endl;
+}
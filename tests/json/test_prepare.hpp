@@ -0,0 +1,119 @@
+#include <iostream>
+#include <map>
+#include <optional>
+#include <rfl.hpp>
+#include <rfl/json.hpp>
+#include <string>
+#include <vector>
+
+namespace tprep {
+
+/// Builds its state on first use, like a compiled regex, and counts how
+/// often it is prepared and built.
+struct Even {
+  static inline int num_prepared = 0;
+
+  static inline int num_built = 0;
+
+  static rfl::Result<rfl::Nothing> check(const int& _i) noexcept {
+    if (_i % divisor() != 0) {
+      return rfl::Error("Value " + std::to_string(_i) + " is not even.");
+    }
+    return rfl::Nothing{};
+  }
+
+  static void prepare() {
+    ++num_prepared;
+    divisor();
+  }
+
+ private:
+  static const int& divisor() noexcept {
+    return divisor_.value([](int* _d) {
+      ++num_built;
+      *_d = 2;
+    });
+  }
+
+  static inline rfl::internal::Memoization<int> divisor_;
+};
+
+using Level = rfl::Validator<int, Even>;
+
+using Code = rfl::Pattern<"^[A-Z]{3}-[0-9]+$", "Code">;
+
+struct Node {
+  rfl::Field<"code", Code> code;
+  rfl::Field<"email", rfl::Email> email;
+  rfl::Field<"level", Level> level;
+  rfl::Field<"children", std::vector<rfl::Box<Node>>> children;
+};
+
+struct Circle {
+  rfl::Field<"shape", rfl::Literal<"Circle">> shape;
+  rfl::Field<"radius", double> radius;
+};
+
+struct Square {
+  rfl::Field<"shape", rfl::Literal<"Square">> shape;
+  rfl::Field<"width", double> width;
+};
+
+struct Document {
+  rfl::Field<"root", Node> root;
+  rfl::Field<"shapes", std::map<std::string, rfl::TaggedUnion<"shape", Circle,
+                                                            Square>>>
+      shapes;
+  rfl::Field<"parent", std::optional<rfl::Ref<Node>>> parent;
+  rfl::Field<"levels", std::vector<Level>> levels;
+};
+
+}  // namespace tprep
+
+void test_prepare() {
+  std::cout << "test_prepare" << std::endl;
+
+  // Node is recursive and Level occurs in several places, so this only
+  // terminates and prepares Even once, if every type is visited once.
+  rfl::prepare<tprep::Document>();
+
+  if (tprep::Even::num_prepared != 1 || tprep::Even::num_built != 1) {
+    std::cout << "Failed: Expected Even to be prepared and built once, got "
+              << tprep::Even::num_prepared << " and "
+              << tprep::Even::num_built << "." << std::endl
+              << std::endl;
+    return;
+  }
+
+  const auto res = rfl::json::read<tprep::Document>(
+      R"({"root":{"code":"ABC-1","email":"homer@simpson.com","level":2,)"
+      R"("children":[{"code":"DEF-2","email":"bart@simpson.com","level":4,)"
+      R"("children":[]}]},"shapes":{"a":{"shape":"Circle","radius":2.0}},)"
+      R"("levels":[6,8]})");
+
+  if (!res) {
+    std::cout << "Failed: " << res.error()->what() << std::endl << std::endl;
+    return;
+  }
+
+  // The state was built by prepare, so checking the values must not build
+  // it again.
+  if (tprep::Even::num_built != 1) {
+    std::cout << "Failed: Expected the first check not to build Even again."
+              << std::endl
+              << std::endl;
+    return;
+  }
+
+  const auto faulty = rfl::json::read<tprep::Document>(
+      R"({"root":{"code":"abc","email":"homer@simpson.com","level":2,)"
+      R"("children":[]},"shapes":{},"levels":[]})");
+
+  if (faulty) {
+    std::cout << "Failed: Expected the code not to match." << std::endl
+              << std::endl;
+    return;
+  }
+
+  std::cout << "OK" << std::endl << std::endl;
+}
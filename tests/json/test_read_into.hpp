@@ -0,0 +1,67 @@
+#include <iostream>
+#include <map>
+#include <optional>
+#include <rfl.hpp>
+#include <rfl/json.hpp>
+#include <string>
+#include <vector>
+
+void test_read_into() {
+  std::cout << "test_read_into" << std::endl;
+
+  struct Person {
+    rfl::Field<"firstName", std::string> first_name;
+    rfl::Field<"lastName", std::string> last_name;
+    rfl::Field<"nickname", std::optional<std::string>> nickname;
+    rfl::Field<"scores", std::map<std::string, int>> scores;
+    rfl::Field<"children", std::vector<Person>> children;
+  };
+
+  const std::string json_string1 =
+      R"({"firstName":"Homer","lastName":"Simpson","nickname":"Homie","scores":{"bowling":10,"work":1},"children":[{"firstName":"Bart","lastName":"Simpson","scores":{},"children":[]},{"firstName":"Lisa","lastName":"Simpson","scores":{},"children":[]}]})";
+
+  const std::string json_string2 =
+      R"({"firstName":"Marge","lastName":"Simpson","scores":{"bowling":3,"cooking":10},"children":[{"firstName":"Maggie","lastName":"Simpson","scores":{},"children":[]}]})";
+
+  auto person = rfl::json::read<Person>(json_string1).value();
+
+  const auto children_data = person.children().data();
+
+  const auto res = rfl::json::read_into(person, json_string2);
+
+  if (!res) {
+    std::cout << "Test failed on read_into. Error: "
+              << res.error().value().what() << std::endl
+              << std::endl;
+    return;
+  }
+
+  const auto json_string3 = rfl::json::write(person);
+
+  if (json_string2 != json_string3) {
+    std::cout << "Test failed on read_into. Expected:" << std::endl
+              << json_string2 << std::endl
+              << "Got:" << std::endl
+              << json_string3 << std::endl
+              << std::endl;
+    return;
+  }
+
+  if (person.children().data() != children_data) {
+    std::cout << "Test failed on read_into. The vector was reallocated."
+              << std::endl
+              << std::endl;
+    return;
+  }
+
+  const auto err = rfl::json::read_into(person, R"({"firstName":"Ned"})");
+
+  if (err) {
+    std::cout << "Test failed on read_into. Expected an error, got none."
+              << std::endl
+              << std::endl;
+    return;
+  }
+
+  std::cout << "OK" << std::endl << std::endl;
+}
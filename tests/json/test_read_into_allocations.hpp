@@ -0,0 +1,109 @@
+#include <yyjson.h>
+
+#include <array>
+#include <cstddef>
+#include <iostream>
+#include <map>
+#include <memory_resource>
+#include <optional>
+#include <rfl.hpp>
+#include <rfl/json.hpp>
+#include <string>
+#include <vector>
+
+namespace tria {
+
+/// Counts every allocation, so that the test does not have to replace the
+/// global allocation functions.
+class CountingResource : public std::pmr::memory_resource {
+ public:
+  size_t num_allocations() const { return num_allocations_; }
+
+ private:
+  void* do_allocate(size_t _bytes, size_t _alignment) override {
+    ++num_allocations_;
+    return std::pmr::new_delete_resource()->allocate(_bytes, _alignment);
+  }
+
+  void do_deallocate(void* _ptr, size_t _bytes, size_t _alignment) override {
+    std::pmr::new_delete_resource()->deallocate(_ptr, _bytes, _alignment);
+  }
+
+  bool do_is_equal(
+      const std::pmr::memory_resource& _other) const noexcept override {
+    return this == &_other;
+  }
+
+ private:
+  size_t num_allocations_ = 0;
+};
+
+struct Person {
+  rfl::Field<"firstName", std::pmr::string> first_name;
+  rfl::Field<"lastName", std::pmr::string> last_name;
+  rfl::Field<"nickname", std::optional<std::pmr::string>> nickname;
+  rfl::Field<"scores", std::pmr::map<std::pmr::string, int>> scores;
+  rfl::Field<"position", std::array<double, 3>> position;
+  rfl::Field<"children", std::pmr::vector<Person>> children;
+};
+
+}  // namespace tria
+
+void test_read_into_allocations() {
+  std::cout << "test_read_into_allocations" << std::endl;
+
+  const std::string json_string1 =
+      R"({"firstName":"Homer","lastName":"Simpson","nickname":"Homie","scores":{"bowling":10,"work":1},"position":[1.0,2.0,3.0],"children":[{"firstName":"Bart","lastName":"Simpson","scores":{"pranks":10},"position":[0.0,0.0,0.0],"children":[]},{"firstName":"Lisa","lastName":"Simpson","scores":{},"position":[0.0,0.0,0.0],"children":[]}]})";
+
+  const std::string json_string2 =
+      R"({"firstName":"Marge","lastName":"Bouvier","nickname":"Midge","scores":{"bowling":3,"work":7},"position":[4.0,5.0,6.0],"children":[{"firstName":"Maggie","lastName":"Simpson","scores":{"pranks":0},"position":[1.0,1.0,1.0],"children":[]},{"firstName":"Lisa","lastName":"Simpson","scores":{},"position":[2.0,2.0,2.0],"children":[]}]})";
+
+  // Containers that are created during read_into use the default resource,
+  // so it is replaced until read_into is done.
+  auto resource = tria::CountingResource();
+
+  auto* const default_resource = std::pmr::set_default_resource(&resource);
+
+  auto person = rfl::json::read<tria::Person>(json_string1, &resource).value();
+
+  // Parsing the document allocates, so it is parsed up front and only
+  // read_into itself is measured.
+  yyjson_doc* doc = yyjson_read(json_string2.c_str(), json_string2.size(), 0);
+
+  const auto var = rfl::json::Reader::InputVarType(yyjson_doc_get_root(doc));
+
+  const auto before = resource.num_allocations();
+
+  const auto res = rfl::json::read_into(person, var);
+
+  const auto allocations = resource.num_allocations() - before;
+
+  std::pmr::set_default_resource(default_resource);
+
+  yyjson_doc_free(doc);
+
+  if (!res) {
+    std::cout << "Test failed on read_into." << std::endl << std::endl;
+    return;
+  }
+
+  if (allocations != 0) {
+    std::cout << "Test failed. Expected no allocations, got " << allocations
+              << "." << std::endl
+              << std::endl;
+    return;
+  }
+
+  const auto json_string3 = rfl::json::write(person);
+
+  if (json_string2 != json_string3) {
+    std::cout << "Test failed. Expected:" << std::endl
+              << json_string2 << std::endl
+              << "Got:" << std::endl
+              << json_string3 << std::endl
+              << std::endl;
+    return;
+  }
+
+  std::cout << "OK" << std::endl << std::endl;
+}
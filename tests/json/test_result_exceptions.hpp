@@ -0,0 +1,73 @@
+#include <iostream>
+#include <rfl.hpp>
+#include <stdexcept>
+#include <string>
+#include <type_traits>
+
+namespace trex {
+
+inline int num_alive = 0;
+
+/// A type whose copy constructor throws and that counts its live instances,
+/// so destroying an instance that was never constructed would show up.
+struct ThrowsOnCopy {
+  ThrowsOnCopy() { ++num_alive; }
+  ThrowsOnCopy(const ThrowsOnCopy&) { throw std::runtime_error("No copies."); }
+  ThrowsOnCopy(ThrowsOnCopy&&) noexcept { ++num_alive; }
+  ~ThrowsOnCopy() { --num_alive; }
+  ThrowsOnCopy& operator=(const ThrowsOnCopy&) = default;
+  ThrowsOnCopy& operator=(ThrowsOnCopy&&) noexcept = default;
+};
+
+/// A type whose move constructor may throw.
+struct ThrowingMove {
+  ThrowingMove() = default;
+  ThrowingMove(ThrowingMove&&) noexcept(false) {}
+  ThrowingMove& operator=(ThrowingMove&&) noexcept(false) { return *this; }
+};
+
+}  // namespace trex
+
+void test_result_exceptions() {
+  std::cout << "test_result_exceptions" << std::endl;
+
+  static_assert(
+      std::is_nothrow_move_assignable_v<rfl::Result<std::string>>,
+      "Results of types that can be moved without throwing should be "
+      "noexcept.");
+
+  static_assert(
+      !std::is_nothrow_move_assignable_v<rfl::Result<trex::ThrowingMove>> &&
+          !std::is_nothrow_move_constructible_v<
+              rfl::Result<trex::ThrowingMove>>,
+      "Moving a result must not be noexcept, if moving the value can throw.");
+
+  {
+    const auto val = rfl::Result<trex::ThrowsOnCopy>(trex::ThrowsOnCopy());
+    auto res = rfl::Result<trex::ThrowsOnCopy>(rfl::Error("Some error."));
+
+    try {
+      res = val;
+      std::cout << "Failed: Expected the copy to throw." << std::endl
+                << std::endl;
+      return;
+    } catch (std::runtime_error&) {
+    }
+
+    if (res || res.error()->what() != "Some error.") {
+      std::cout << "Failed: Expected the result to keep its old error."
+                << std::endl
+                << std::endl;
+      return;
+    }
+  }
+
+  if (trex::num_alive != 0) {
+    std::cout << "Failed: Expected no live instances, got "
+              << trex::num_alive << "." << std::endl
+              << std::endl;
+    return;
+  }
+
+  std::cout << "OK" << std::endl << std::endl;
+}
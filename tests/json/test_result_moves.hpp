@@ -0,0 +1,85 @@
+#include <iostream>
+#include <rfl.hpp>
+#include <rfl/json.hpp>
+#include <string>
+#include <vector>
+
+namespace trm {
+
+inline int num_copies = 0;
+
+/// A container that counts how often it is copied.
+struct Counted {
+  Counted(std::vector<int> _values) : values(std::move(_values)) {}
+  Counted(const Counted& _other) : values(_other.values) { ++num_copies; }
+  Counted(Counted&& _other) noexcept = default;
+  Counted& operator=(const Counted& _other) {
+    values = _other.values;
+    ++num_copies;
+    return *this;
+  }
+  Counted& operator=(Counted&& _other) noexcept = default;
+
+  std::vector<int> values;
+};
+
+inline rfl::Result<Counted> make_counted() {
+  return Counted(std::vector<int>({1, 2, 3}));
+}
+
+}  // namespace trm
+
+void test_result_moves() {
+  std::cout << "test_result_moves" << std::endl;
+
+  static_assert(sizeof(rfl::Result<rfl::Nothing>) <= 2 * sizeof(void*),
+                "Results of small types should be small.");
+
+  const auto sum = trm::make_counted()
+                       .transform([](trm::Counted&& _c) {
+                         _c.values.push_back(4);
+                         return std::move(_c);
+                       })
+                       .and_then([](trm::Counted&& _c) -> rfl::Result<int> {
+                         int s = 0;
+                         for (const auto v : _c.values) {
+                           s += v;
+                         }
+                         return s;
+                       })
+                       .or_else([](rfl::Error&& _e) -> rfl::Result<int> {
+                         return std::move(_e);
+                       });
+
+  if (!sum || *sum != 10 || trm::num_copies != 0) {
+    std::cout << "Failed: Expected the value to be moved through the chain, "
+                 "got "
+              << trm::num_copies << " copies." << std::endl
+              << std::endl;
+    return;
+  }
+
+  // Lvalues are passed by reference and remain intact.
+  auto counted = trm::make_counted();
+  const auto size = counted.transform(
+      [](const trm::Counted& _c) { return _c.values.size(); });
+
+  if (!size || *size != 3 || (*counted).values.size() != 3 ||
+      trm::num_copies != 0) {
+    std::cout << "Failed: Expected the lvalue to remain intact." << std::endl
+              << std::endl;
+    return;
+  }
+
+  const auto err = rfl::Result<trm::Counted>(rfl::Error("Some error."))
+                       .transform([](trm::Counted&& _c) { return _c; })
+                       .value_or(trm::Counted(std::vector<int>()));
+
+  if (err.values.size() != 0 || trm::num_copies != 0) {
+    std::cout << "Failed: Expected the default value." << std::endl
+              << std::endl;
+    return;
+  }
+
+  std::cout << "OK" << std::endl << std::endl;
+}
@@ -0,0 +1,5 @@
+#include "test_serializers_types.hpp"
+
+// The serializers for tser::Order are only compiled in this translation
+// unit. test_serializers.hpp only sees the declaration.
+RFL_DEFINE_SERIALIZERS(tser::Order, json)
@@ -0,0 +1,45 @@
+#include <iostream>
+#include <memory_resource>
+#include <string>
+#include <vector>
+
+#include "test_serializers_types.hpp"
+
+void test_serializers() {
+  std::cout << "test_serializers" << std::endl;
+
+  const auto order = tser::Order{.id = 1, .items = std::vector<std::string>{
+                                              "apple", "banana"}};
+
+  const auto json_string = rfl::json::write(order);
+
+  const std::string expected = R"({"id":1,"items":["apple","banana"]})";
+
+  if (json_string != expected) {
+    std::cout << "Failed: Expected '" << expected << "', got '" << json_string
+              << "'." << std::endl
+              << std::endl;
+    return;
+  }
+
+  const auto res = rfl::json::read<tser::Order>(json_string);
+
+  if (!res || (*res).id() != 1 || (*res).items().size() != 2) {
+    std::cout << "Failed: Could not read the order back." << std::endl
+              << std::endl;
+    return;
+  }
+
+  std::pmr::monotonic_buffer_resource resource;
+
+  const auto pmr_res = rfl::json::read<tser::Order>(json_string, &resource);
+
+  if (!pmr_res || (*pmr_res).items().size() != 2) {
+    std::cout << "Failed: Could not read the order using a memory resource."
+              << std::endl
+              << std::endl;
+    return;
+  }
+
+  std::cout << "OK" << std::endl << std::endl;
+}
@@ -0,0 +1,20 @@
+#ifndef TEST_SERIALIZERS_TYPES_
+#define TEST_SERIALIZERS_TYPES_
+
+#include <rfl.hpp>
+#include <rfl/json.hpp>
+#include <string>
+#include <vector>
+
+namespace tser {
+
+struct Order {
+  rfl::Field<"id", int> id;
+  rfl::Field<"items", std::vector<std::string>> items;
+};
+
+}  // namespace tser
+
+RFL_DECLARE_SERIALIZERS(tser::Order, json)
+
+#endif
@@ -0,0 +1,78 @@
+#include <iostream>
+#include <map>
+#include <rfl.hpp>
+#include <rfl/json.hpp>
+#include <string>
+#include <unordered_map>
+
+namespace tsmr {
+
+/// Builds an object with _n entries, sorted by key.
+std::string make_object(const int _n) {
+  std::string json = "{";
+  for (int i = 0; i < _n; ++i) {
+    const auto k = std::to_string(i);
+    json += (i == 0 ? "\"key" : ",\"key") + std::string(4 - k.size(), '0') +
+            k + "\":" + k;
+  }
+  return json + "}";
+}
+
+}  // namespace tsmr
+
+void test_string_map_read() {
+  std::cout << "test_string_map_read" << std::endl;
+
+  const auto json = tsmr::make_object(1000);
+
+  const auto ordered = rfl::json::read<std::map<std::string, int>>(json);
+
+  if (!ordered) {
+    std::cout << "Failed: " << ordered.error()->what() << std::endl
+              << std::endl;
+    return;
+  }
+
+  const auto unordered =
+      rfl::json::read<std::unordered_map<std::string, int>>(json);
+
+  if (!unordered) {
+    std::cout << "Failed: " << unordered.error()->what() << std::endl
+              << std::endl;
+    return;
+  }
+
+  if ((*ordered).size() != 1000 || (*ordered).at("key0999") != 999 ||
+      (*unordered).size() != 1000 || (*unordered).at("key0500") != 500) {
+    std::cout << "Failed: Unexpected values." << std::endl << std::endl;
+    return;
+  }
+
+  if (rfl::json::write(*ordered) != json) {
+    std::cout << "Failed: Round trip changed the map." << std::endl
+              << std::endl;
+    return;
+  }
+
+  // The first of several entries with the same key is kept.
+  const auto duplicates = rfl::json::read<std::map<std::string, int>>(
+      R"({"b":1,"a":2,"b":3})");
+
+  if (!duplicates || (*duplicates).size() != 2 ||
+      (*duplicates).at("b") != 1) {
+    std::cout << "Failed: Duplicate keys were not handled." << std::endl
+              << std::endl;
+    return;
+  }
+
+  // Errors in the values are passed on without throwing.
+  const auto broken = rfl::json::read<std::unordered_map<std::string, int>>(
+      R"({"a":1,"b":"two","c":3})");
+
+  if (broken) {
+    std::cout << "Failed: Expected an error." << std::endl << std::endl;
+    return;
+  }
+
+  std::cout << "OK" << std::endl << std::endl;
+}
@@ -25,7 +25,21 @@ void test_timestamp() {
         return;
     }
 
-    const auto bart = Person{.first_name = "Bart", .birthday = "1987-04-19"};
+    auto tm = TS("1987-04-19").tm();
+    tm.tm_mday = 1;
+
+    auto birthday = TS("2000-01-01");
+    birthday.set_tm(tm);
+
+    if (birthday.str() != "1987-04-01") {
+        std::cout << "Failed: Expected 1987-04-01, got " << birthday.str()
+                  << std::endl;
+        return;
+    }
+
+    birthday.set_time_point(TS("1987-04-19").time_point());
+
+    const auto bart = Person{.first_name = "Bart", .birthday = birthday};
 
     write_and_read(
         bart,
@@ -0,0 +1,55 @@
+#include <chrono>
+#include <iostream>
+#include <rfl.hpp>
+#include <rfl/json.hpp>
+#include <string>
+
+#include "write_and_read.hpp"
+
+void test_timestamp_iso() {
+    std::cout << "test_timestamp_iso" << std::endl;
+
+    using TS = rfl::Timestamp<"%Y-%m-%dT%H:%M:%S%z">;
+
+    // %a and %b are not compiled, so this uses strptime and strftime.
+    using Verbose = rfl::Timestamp<"%a, %d %b %Y %T">;
+
+    struct Event {
+        rfl::Field<"name", std::string> name;
+        rfl::Field<"time", TS> time;
+    };
+
+    const auto time = TS::from_string("1987-04-19T10:11:12+0200");
+
+    if (!time) {
+        std::cout << "Failed: " << time.error().value().what() << std::endl;
+        return;
+    }
+
+    if (time.value().str() != "1987-04-19T08:11:12+0000") {
+        std::cout << "Failed: Expected the time stamp to be in UTC, got "
+                  << time.value().str() << std::endl;
+        return;
+    }
+
+    const auto verbose = Verbose(time.value().time_point());
+
+    if (verbose.str() != "Sun, 19 Apr 1987 08:11:12" ||
+        Verbose(verbose.str()) != verbose) {
+        std::cout << "Failed: Got " << verbose.str() << std::endl;
+        return;
+    }
+
+    for (const auto str : {"1987-13-19T10:11:12Z", "1987-04-19T10:11:12",
+                           "1987-04-19T10:11:12Z trailing"}) {
+        if (TS::from_string(str)) {
+            std::cout << "Failed: Expected an error for " << str << std::endl;
+            return;
+        }
+    }
+
+    const auto event = Event{.name = "launch", .time = time.value()};
+
+    write_and_read(
+        event, R"({"name":"launch","time":"1987-04-19T08:11:12+0000"})");
+}
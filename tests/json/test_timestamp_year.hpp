@@ -0,0 +1,51 @@
+#include <chrono>
+#include <iostream>
+#include <rfl.hpp>
+#include <rfl/json.hpp>
+#include <string>
+
+void test_timestamp_year() {
+    std::cout << "test_timestamp_year" << std::endl;
+
+    using Dashed = rfl::Timestamp<"%Y-%m-%d">;
+
+    using Compact = rfl::Timestamp<"%Y%m%d">;
+
+    using namespace std::chrono;
+
+    // Every year that can be formatted must be read back as the same year.
+    for (const int y : {-32767, -1, 0, 999, 1000, 9999, 10000, 32767}) {
+        const auto time_point = sys_seconds(sys_days(year(y) / 12 / 31));
+
+        const auto dashed = Dashed::from_string(Dashed(time_point).str());
+        const auto compact = Compact::from_string(Compact(time_point).str());
+
+        if (!dashed || dashed.value().time_point() != time_point ||
+            !compact || compact.value().time_point() != time_point) {
+            std::cout << "Failed: Could not read back the year " << y
+                      << std::endl;
+            return;
+        }
+    }
+
+    if (Dashed(sys_days(year(10000) / 1 / 1)).str() != "10000-01-01" ||
+        Compact(sys_days(year(10000) / 1 / 1)).str() != "100000101") {
+        std::cout << "Failed: Unexpected format of the year 10000."
+                  << std::endl;
+        return;
+    }
+
+    for (const auto str : {"32768-01-01", "100000-01-01", "-01-01"}) {
+        if (Dashed::from_string(str)) {
+            std::cout << "Failed: Expected an error for " << str << std::endl;
+            return;
+        }
+    }
+
+    if (Compact::from_string("0101")) {
+        std::cout << "Failed: Expected an error for 0101" << std::endl;
+        return;
+    }
+
+    std::cout << "OK" << std::endl << std::endl;
+}
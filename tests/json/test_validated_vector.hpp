@@ -0,0 +1,110 @@
+#include <iostream>
+#include <rfl.hpp>
+#include <rfl/json.hpp>
+#include <span>
+#include <string>
+#include <vector>
+
+#include "write_and_read.hpp"
+
+namespace tvv {
+
+/// Counts how often the values are checked in a single pass.
+struct CountedMinimum {
+  static inline int num_batch_checks = 0;
+
+  template <class T>
+  static rfl::Result<rfl::Nothing> check(const T& _value) noexcept {
+    return rfl::Minimum<0>::check(_value);
+  }
+
+  template <class T>
+  static bool check_all(const std::span<const T>& _values) noexcept {
+    ++num_batch_checks;
+    return rfl::Minimum<0>::check_all(_values);
+  }
+};
+
+}  // namespace tvv
+
+void test_validated_vector() {
+  std::cout << "test_validated_vector" << std::endl;
+
+  using Probability =
+      rfl::Validator<double, rfl::AllOf<rfl::Minimum<0>, rfl::Maximum<1>>>;
+
+  // No single alternative holds for all values, but every value satisfies
+  // one of them.
+  using Extreme =
+      rfl::Validator<int, rfl::AnyOf<rfl::Maximum<10>, rfl::Minimum<90>>>;
+
+  struct Readings {
+    rfl::Field<"probabilities", std::vector<Probability>> probabilities;
+    rfl::Field<"extremes", std::vector<Extreme>> extremes;
+  };
+
+  const auto readings =
+      Readings{.probabilities = std::vector<Probability>({0.0, 0.25, 1.0}),
+               .extremes = std::vector<Extreme>({1, 95, 10})};
+
+  write_and_read(readings,
+                 R"({"probabilities":[0.0,0.25,1.0],"extremes":[1,95,10]})");
+
+  const auto res = rfl::json::read<Readings>(
+      R"({"probabilities":[0.5,1.5],"extremes":[1]})");
+
+  const std::string expected =
+      "Failed to parse field 'probabilities': Value expected to be less than "
+      "or equal to 1.000000, but got 1.500000.";
+
+  if (!res.error() || res.error()->what() != expected) {
+    std::cout << "Test failed. Expected: " << expected << std::endl
+              << std::endl;
+    return;
+  }
+
+  if (rfl::json::read<Readings>(
+          R"({"probabilities":[],"extremes":[1,50]})")) {
+    std::cout << "Test failed. Expected an error." << std::endl << std::endl;
+    return;
+  }
+
+  using Nested =
+      rfl::AllOf<rfl::Minimum<0>,
+                 rfl::AnyOf<rfl::Maximum<10>, rfl::EqualTo<20>>>;
+
+  const auto valid = std::vector<int>({0, 20, 10});
+  const auto invalid = std::vector<int>({0, 15});
+
+  if (!Nested::check_all(std::span<const int>(valid)) ||
+      Nested::check_all(std::span<const int>(invalid))) {
+    std::cout << "Test failed. Nested validators checked incorrectly."
+              << std::endl
+              << std::endl;
+    return;
+  }
+
+  using Count = rfl::Validator<int, tvv::CountedMinimum>;
+
+  struct Counts {
+    rfl::Field<"first", std::vector<Count>> first;
+    rfl::Field<"second", std::vector<Count>> second;
+  };
+
+  auto counts = rfl::json::read<Counts>(R"({"first":[1,2],"second":[3]})");
+
+  auto& num_batch_checks =
+      tvv::CountedMinimum::num_batch_checks;
+
+  if (!counts || num_batch_checks != 2 ||
+      !rfl::json::read_into(*counts, R"({"first":[4],"second":[5,6]})") ||
+      num_batch_checks != 4 || (*counts).second().size() != 2) {
+    std::cout << "Test failed. Expected every field to be checked in a "
+                 "single pass, got "
+              << num_batch_checks << " batch checks." << std::endl
+              << std::endl;
+    return;
+  }
+
+  std::cout << "OK" << std::endl << std::endl;
+}
@@ -0,0 +1,88 @@
+#include <iostream>
+#include <rfl.hpp>
+#include <rfl/json.hpp>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace tvc {
+
+inline int num_copies = 0;
+
+/// A container that counts how often it is copied.
+struct Counted {
+  Counted() = default;
+  Counted(std::vector<std::string> _values) : values(std::move(_values)) {}
+  Counted(const Counted& _other) : values(_other.values) { ++num_copies; }
+  Counted(Counted&& _other) noexcept = default;
+  Counted& operator=(const Counted& _other) {
+    values = _other.values;
+    ++num_copies;
+    return *this;
+  }
+  Counted& operator=(Counted&& _other) noexcept = default;
+
+  size_t size() const { return values.size(); }
+
+  std::vector<std::string> values;
+};
+
+/// A validator written against the older protocol, which returns the value.
+struct NotEmpty {
+  static rfl::Result<std::string> validate(const std::string& _str) {
+    if (_str.empty()) {
+      return rfl::Error("String must not be empty.");
+    }
+    return _str;
+  }
+};
+
+}  // namespace tvc
+
+void test_validator_copies() {
+  std::cout << "test_validator_copies" << std::endl;
+
+  using Names = rfl::Validator<
+      tvc::Counted,
+      rfl::Size<rfl::AllOf<rfl::Minimum<1>, rfl::Maximum<100000>,
+                           rfl::AnyOf<rfl::EqualTo<3>, rfl::EqualTo<4>>>>>;
+
+  auto counted = tvc::Counted({"Bart", "Lisa", "Maggie"});
+
+  const auto names1 = Names(std::move(counted));
+  const auto names2 = Names::from_value(tvc::Counted({"a", "b", "c"}));
+
+  if (!names2 || tvc::num_copies != 0) {
+    std::cout << "Failed: Expected no copies, got " << tvc::num_copies << "."
+              << std::endl
+              << std::endl;
+    return;
+  }
+
+  if (Names::from_value(tvc::Counted({"a"}))) {
+    std::cout << "Failed: Expected an error." << std::endl << std::endl;
+    return;
+  }
+
+  // The built-in validators still support the older protocol, so code
+  // calling validate directly keeps working.
+  if (!rfl::Minimum<1>::validate(3) || rfl::Minimum<1>::validate(0) ||
+      !rfl::Size<rfl::EqualTo<3>>::validate(std::string("abc")) ||
+      !rfl::AnyOf<rfl::EqualTo<1>, rfl::EqualTo<2>>::validate(2) ||
+      rfl::PatternValidator<"^[a-z]+$", "Lowercase">::validate("ABC") ||
+      rfl::Maximum<10>::validate(7).value() != 7) {
+    std::cout << "Failed: validate did not work." << std::endl << std::endl;
+    return;
+  }
+
+  using Name = rfl::Validator<std::string, tvc::NotEmpty>;
+
+  if (!Name::from_value("Homer") || Name::from_value("")) {
+    std::cout << "Failed: The older validation protocol did not work."
+              << std::endl
+              << std::endl;
+    return;
+  }
+
+  std::cout << "OK" << std::endl << std::endl;
+}
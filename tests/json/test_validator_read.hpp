@@ -0,0 +1,82 @@
+#include <iostream>
+#include <rfl.hpp>
+#include <rfl/json.hpp>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace tvr {
+
+inline int num_constructed = 0;
+
+inline int num_copies = 0;
+
+inline int num_moves = 0;
+
+/// Counts how often it is constructed from its reflection type, copied and
+/// moved.
+struct Counted {
+  using ReflectionType = std::vector<std::string>;
+
+  Counted(std::vector<std::string> _values) : values(std::move(_values)) {
+    ++num_constructed;
+  }
+
+  Counted(const Counted& _other) : values(_other.values) { ++num_copies; }
+
+  Counted(Counted&& _other) noexcept : values(std::move(_other.values)) {
+    ++num_moves;
+  }
+
+  Counted& operator=(const Counted& _other) {
+    values = _other.values;
+    ++num_copies;
+    return *this;
+  }
+
+  Counted& operator=(Counted&& _other) noexcept {
+    values = std::move(_other.values);
+    ++num_moves;
+    return *this;
+  }
+
+  const ReflectionType& reflection() const { return values; }
+
+  size_t size() const { return values.size(); }
+
+  std::vector<std::string> values;
+};
+
+using Names = rfl::Validator<Counted, rfl::Size<rfl::Minimum<1>>>;
+
+}  // namespace tvr
+
+void test_validator_read() {
+  std::cout << "test_validator_read" << std::endl;
+
+  const auto res = rfl::json::read<tvr::Names>(R"(["Bart","Lisa","Maggie"])");
+
+  if (!res || res.value().value().size() != 3) {
+    std::cout << "Failed: Could not read the names." << std::endl << std::endl;
+    return;
+  }
+
+  // The value is constructed once, moved into the Result returned by its
+  // parser, into the Validator and into the Result returned by read.
+  if (tvr::num_constructed != 1 || tvr::num_copies != 0 ||
+      tvr::num_moves > 3) {
+    std::cout << "Failed: Expected one construction, no copies and at most 3 "
+                 "moves, got "
+              << tvr::num_constructed << ", " << tvr::num_copies << " and "
+              << tvr::num_moves << "." << std::endl
+              << std::endl;
+    return;
+  }
+
+  if (rfl::json::read<tvr::Names>("[]")) {
+    std::cout << "Failed: Expected an error." << std::endl << std::endl;
+    return;
+  }
+
+  std::cout << "OK" << std::endl << std::endl;
+}
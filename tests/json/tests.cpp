@@ -5,45 +5,68 @@
 #include "test_as.hpp"
 #include "test_as_flatten.hpp"
 #include "test_box.hpp"
+#include "test_columns.hpp"
 #include "test_custom_class1.hpp"
 #include "test_custom_class2.hpp"
 #include "test_custom_class3.hpp"
 #include "test_custom_class4.hpp"
 #include "test_custom_constructor.hpp"
 #include "test_default_values.hpp"
+#include "test_diff.hpp"
+#include "test_diff_variants.hpp"
+#include "test_direct_read.hpp"
 #include "test_deque.hpp"
 #include "test_email.hpp"
 #include "test_error_messages.hpp"
 #include "test_field_variant.hpp"
+#include "test_flat_map.hpp"
 #include "test_flatten.hpp"
 #include "test_forward_list.hpp"
+#include "test_hash.hpp"
 #include "test_list.hpp"
 #include "test_literal.hpp"
+#include "test_many_fields.hpp"
 #include "test_map.hpp"
+#include "test_memory_resource.hpp"
 #include "test_monster_example.hpp"
 #include "test_multimap.hpp"
 #include "test_multiset.hpp"
+#include "test_object_map.hpp"
 #include "test_one_of.hpp"
 #include "test_optional_fields.hpp"
+#include "test_pattern.hpp"
+#include "test_pattern_matchers.hpp"
+#include "test_prepare.hpp"
+#include "test_read_into.hpp"
+#include "test_read_into_allocations.hpp"
 #include "test_readme_example.hpp"
 #include "test_ref.hpp"
 #include "test_replace.hpp"
 #include "test_replace_flatten.hpp"
 #include "test_replace_with_other_struct.hpp"
 #include "test_result.hpp"
+#include "test_result_exceptions.hpp"
+#include "test_result_moves.hpp"
 #include "test_save_load.hpp"
+#include "test_serializers.hpp"
 #include "test_set.hpp"
 #include "test_size.hpp"
 #include "test_string_map.hpp"
+#include "test_string_map_read.hpp"
 #include "test_string_unordered_map.hpp"
 #include "test_tagged_union.hpp"
 #include "test_timestamp.hpp"
+#include "test_timestamp_iso.hpp"
+#include "test_timestamp_year.hpp"
 #include "test_unique_ptr.hpp"
 #include "test_unique_ptr2.hpp"
 #include "test_unordered_map.hpp"
 #include "test_unordered_multimap.hpp"
 #include "test_unordered_multiset.hpp"
 #include "test_unordered_set.hpp"
+#include "test_validated_vector.hpp"
+#include "test_validator_copies.hpp"
+#include "test_validator_read.hpp"
 #include "test_variant.hpp"
 
 int main() {
@@ -60,10 +83,13 @@ int main() {
   test_box();
   test_array();
   test_timestamp();
+  test_timestamp_iso();
+  test_timestamp_year();
   test_flatten();
   test_deque();
   test_forward_list();
   test_list();
+  test_many_fields();
   test_map();
   test_unordered_map();
   test_set();
@@ -71,11 +97,19 @@ int main() {
   test_multimap();
   test_unordered_multimap();
   test_multiset();
+  test_object_map();
   test_unordered_multiset();
   test_string_map();
+  test_string_map_read();
   test_string_unordered_map();
   test_error_messages();
   test_result();
+  test_result_exceptions();
+  test_result_moves();
+  test_serializers();
+  test_prepare();
+  test_memory_resource();
+  test_flat_map();
   test_anonymous_fields();
   test_monster_example();
 
@@ -96,9 +130,22 @@ int main() {
   test_any_of();
   test_one_of();
   test_email();
+  test_pattern();
+  test_pattern_matchers();
   test_size();
+  test_validator_copies();
+  test_validator_read();
+  test_validated_vector();
 
   test_save_load();
 
+  test_read_into();
+  test_read_into_allocations();
+  test_diff();
+  test_diff_variants();
+  test_direct_read();
+  test_hash();
+  test_columns();
+
   return 0;
 }
@@ -0,0 +1,61 @@
+#include <iostream>
+#include <rfl.hpp>
+#include <rfl/msgpack.hpp>
+#include <string>
+#include <vector>
+
+#include "write_and_read.hpp"
+
+void test_error_messages() {
+  std::cout << "test_error_messages" << std::endl;
+
+  struct Person {
+    rfl::Field<"firstName", std::string> first_name;
+    rfl::Field<"lastName", std::string> last_name;
+    rfl::Field<"birthday", rfl::Timestamp<"%Y-%m-%d">> birthday;
+    rfl::Field<"children", std::vector<Person>> children;
+  };
+
+  struct FaultyPerson {
+    rfl::Field<"firstName", std::string> first_name;
+    rfl::Field<"lastName", int> last_name;
+    rfl::Field<"birthday", std::string> birthday;
+  };
+
+  const auto faulty_person = FaultyPerson{
+      .first_name = "Homer", .last_name = 12345, .birthday = "04/19/1987"};
+
+  const auto bytes = rfl::msgpack::write(faulty_person);
+
+  const auto result = rfl::msgpack::read<Person>(bytes);
+
+  const std::string expected = R"(Found 3 errors:
+1) Failed to parse field 'lastName': Could not cast to string.
+2) Failed to parse field 'birthday': String '04/19/1987' did not match format '%Y-%m-%d'.
+3) Field named 'children' not found.)";
+
+  if (!result.error()) {
+    std::cout << "Expected an error, got none." << std::endl << std::endl;
+    return;
+  }
+
+  if (result.error().value().what() != expected) {
+    std::cout << "Expected: " << std::endl
+              << expected << std::endl
+              << "Got:" << std::endl
+              << result.error().value().what() << std::endl
+              << std::endl;
+    return;
+  }
+
+  const auto truncated =
+      std::vector<unsigned char>(bytes.begin(), bytes.end() - 1);
+
+  if (rfl::msgpack::read<Person>(truncated)) {
+    std::cout << "Expected an error on truncated input, got none." << std::endl
+              << std::endl;
+    return;
+  }
+
+  std::cout << "OK" << std::endl << std::endl;
+}
@@ -0,0 +1,32 @@
+#include <cstdint>
+#include <iostream>
+#include <rfl.hpp>
+#include <rfl/msgpack.hpp>
+#include <vector>
+
+#include "write_and_read.hpp"
+
+// Makes sure that integers are written using the smallest possible encoding.
+void test_integers() {
+  std::cout << "test_integers" << std::endl;
+
+  const auto ints = std::vector<std::int64_t>(
+      {0, 127, 128, 255, 256, 65535, 65536, 4294967296, -1, -32, -33, -128,
+       -129, -32768, -32769, -2147483649});
+
+  const auto expected_sizes =
+      std::vector<size_t>({1, 1, 2, 2, 3, 3, 5, 9, 1, 1, 2, 2, 3, 3, 5, 9});
+
+  for (size_t i = 0; i < ints.size(); ++i) {
+    const auto bytes = rfl::msgpack::write(ints[i]);
+    if (bytes.size() != expected_sizes[i]) {
+      std::cout << "Test failed. Expected " << ints[i] << " to be encoded in "
+                << expected_sizes[i] << " bytes, got " << bytes.size() << "."
+                << std::endl
+                << std::endl;
+      return;
+    }
+  }
+
+  write_and_read(ints);
+}